@@ -0,0 +1,150 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include <libclsp/server.hpp>
+
+using namespace std;
+using namespace clsp;
+
+// Every allocation of the program goes through here
+static size_t allocations = 0;
+
+void* operator new(size_t size)
+{
+	allocations++;
+
+	if(void* p = malloc(size))
+	{
+		return p;
+	}
+
+	throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+	free(p);
+}
+
+struct Sample
+{
+	const char* name;
+	const Capability& capability;
+	const char* json;
+};
+
+const Sample corpus[] =
+{
+	{
+		"initialize",
+		Capability::initialize,
+		R"({"jsonrpc":"2.0","id":0,"method":"initialize","params":{)"
+		R"("processId":1234,"rootUri":"file:///home/user/project",)"
+		R"("capabilities":{"workspace":{"applyEdit":true,)"
+		R"("workspaceEdit":{"documentChanges":true,)"
+		R"("resourceOperations":["create","rename","delete"]},)"
+		R"("symbol":{"dynamicRegistration":false,"symbolKind":{"valueSet":)"
+		R"([1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,)"
+		R"(25,26]}}},"textDocument":{"synchronization":{"willSave":true,)"
+		R"("didSave":true},"completion":{"completionItem":{)"
+		R"("snippetSupport":true,"documentationFormat":["markdown",)"
+		R"("plaintext"]}},"hover":{"contentFormat":["markdown","plaintext"]}}},)"
+		R"("trace":"off","workspaceFolders":[{"uri":"file:///home/user/project",)"
+		R"("name":"project"}]}})"
+	},
+	{
+		"textDocument/didOpen",
+		Capability::textDocumentDidOpen,
+		R"({"jsonrpc":"2.0","method":"textDocument/didOpen","params":{)"
+		R"("textDocument":{"uri":"file:///home/user/project/main.cpp",)"
+		R"("languageId":"cpp","version":1,"text":"#include <iostream>\n\n)"
+		R"(int main()\n{\n\tstd::cout << \"Hello world\" << std::endl;\n}\n"}}})"
+	},
+	{
+		"textDocument/didChange",
+		Capability::textDocumentDidChange,
+		R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{)"
+		R"("textDocument":{"uri":"file:///home/user/project/main.cpp",)"
+		R"("version":2},"contentChanges":[{"range":{"start":{"line":3,)"
+		R"("character":1},"end":{"line":3,"character":1}},"rangeLength":0,)"
+		R"("text":"s"},{"range":{"start":{"line":3,"character":2},"end":{)"
+		R"("line":3,"character":2}},"rangeLength":0,"text":"t"}]}})"
+	},
+	{
+		"textDocument/completion",
+		Capability::textDocumentCompletion,
+		R"({"jsonrpc":"2.0","id":1,"method":"textDocument/completion",)"
+		R"("params":{"textDocument":{"uri":"file:///home/user/project/main.cpp"},)"
+		R"("position":{"line":3,"character":6},"context":{"triggerKind":2,)"
+		R"("triggerCharacter":":"}}})"
+	},
+	{
+		"textDocument/codeAction",
+		Capability::textDocumentCodeAction,
+		R"({"jsonrpc":"2.0","id":2,"method":"textDocument/codeAction",)"
+		R"("params":{"textDocument":{"uri":"file:///home/user/project/main.cpp"},)"
+		R"("range":{"start":{"line":3,"character":0},"end":{"line":3,)"
+		R"("character":10}},"context":{"diagnostics":[{"range":{"start":{)"
+		R"("line":3,"character":1},"end":{"line":3,"character":4}},)"
+		R"("severity":1,"code":"undeclared_var_use","source":"clang",)"
+		R"("message":"use of undeclared identifier 'st'","tags":[1],)"
+		R"("relatedInformation":[{"location":{"uri":)"
+		R"("file:///home/user/project/main.cpp","range":{"start":{"line":0,)"
+		R"("character":0},"end":{"line":0,"character":1}}},"message":"here"}]}],)"
+		R"("only":["quickfix"]}}})"
+	}
+};
+
+int main()
+{
+	size_t total = 0;
+
+	for(auto& sample: corpus)
+	{
+		auto buffer = make_shared<MessageBuffer>(string_view(sample.json));
+
+		optional<any> params;
+
+		size_t before = allocations;
+
+		auto envelope = MessageEnvelope::parse(buffer);
+
+		if(!envelope || envelope->decodeParams(sample.capability.params,
+			params).IsError())
+		{
+			cerr << sample.name << ": parse error\n";
+			return EXIT_FAILURE;
+		}
+
+		size_t count = allocations - before;
+		total += count;
+
+		cout << sample.name << ": " << count << " allocations\n";
+	}
+
+	cout << "total: " << total << " allocations\n";
+
+	return EXIT_SUCCESS;
+}
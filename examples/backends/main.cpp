@@ -0,0 +1,303 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <linux/perf_event.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <libclsp/server.hpp>
+#include <libclsp/types.hpp>
+
+using namespace std;
+using namespace clsp;
+
+// The number of hover requests of each run
+constexpr size_t messageCount = 100000;
+
+// The number of requests that the client waits for at the same time
+constexpr size_t window = 16;
+
+/// Adds the Content-Length header to a json
+static string frame(const string& json)
+{
+	return "Content-Length: " + to_string(json.length()) + "\r\n\r\n" + json;
+}
+
+/// A hover request
+static string hover(size_t id)
+{
+	return frame(
+		R"({"jsonrpc":"2.0","id":)" + to_string(id) +
+		R"(,"method":"textDocument/hover","params":{"textDocument":)"
+		R"({"uri":"file:///home/user/project/main.cpp"},)"
+		R"("position":{"line":10,"character":4}}})");
+}
+
+/// Writes all of a string to a socket
+static void writeAll(int fd, const string& input)
+{
+	for(size_t i = 0; i < input.length();)
+	{
+		ssize_t n = write(fd, input.data() + i, input.length() - i);
+
+		if(n <= 0)
+		{
+			return;
+		}
+
+		i += n;
+	}
+}
+
+/// Counts the system calls of the calling thread and the threads that it
+/// makes after this, -1 if perf events aren't allowed
+static int countSyscalls()
+{
+	ifstream idFile("/sys/kernel/tracing/events/raw_syscalls/sys_enter/id");
+
+	if(!idFile)
+	{
+		idFile.open("/sys/kernel/debug/tracing/events/raw_syscalls/sys_enter/id");
+	}
+
+	uint64_t id;
+
+	if(!(idFile >> id))
+	{
+		return -1;
+	}
+
+	perf_event_attr attributes = {};
+
+	attributes.type          = PERF_TYPE_TRACEPOINT;
+	attributes.size          = sizeof(attributes);
+	attributes.config        = id;
+	attributes.inherit       = 1;
+	attributes.sample_period = 0;
+
+	return syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+/// Replays the session to a server with a backend and prints what it
+/// measured
+static void replay(const char* name, IoBackend backend)
+{
+	Server server;
+
+	server.ioBackend = backend;
+
+	server.addCapability(Methods::initialize.handle(
+		[](InitializeParams&)
+		{
+			return InitializeResult();
+		}));
+
+	server.addCapability(Methods::textDocumentHover.handle(
+		[](HoverParams&)
+		{
+			return variant<Hover, Null>(Null());
+		}));
+
+	auto transport = make_unique<TcpTransport>("127.0.0.1", 0);
+	TcpTransport& tcp = *transport;
+
+	server.addTransport(move(transport));
+
+	long long syscalls = -1;
+
+	thread serving([&server, &syscalls]()
+	{
+		// Only the threads of the server are counted
+		int counter = countSyscalls();
+
+		server.serve();
+
+		if(counter >= 0)
+		{
+			read(counter, &syscalls, sizeof(syscalls));
+			close(counter);
+		}
+	});
+
+	// serve() opens the transport
+	while(tcp.port() == 0)
+	{
+		this_thread::yield();
+	}
+
+	sockaddr_in address = {};
+
+	address.sin_family = AF_INET;
+	address.sin_port   = htons(tcp.port());
+	inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+
+	int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+	connect(fd, (sockaddr*)&address, sizeof(address));
+
+	int noDelay = 1;
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+	using Clock = chrono::steady_clock;
+
+	vector<Clock::time_point> sent(messageCount + 1);
+	vector<double> latencies;
+	latencies.reserve(messageCount);
+
+	atomic<size_t> received{0};
+
+	// Reads the responses and times them by their id
+	thread reader([fd, &sent, &latencies, &received]()
+	{
+		string input;
+		char buffer[1 << 16];
+		ssize_t n;
+
+		while((n = read(fd, buffer, sizeof(buffer))) > 0)
+		{
+			auto now = Clock::now();
+
+			input.append(buffer, n);
+
+			size_t head = 0;
+
+			while(true)
+			{
+				size_t headerEnd = input.find("\r\n\r\n", head);
+
+				if(headerEnd == string::npos)
+				{
+					break;
+				}
+
+				size_t length = strtoul(input.c_str() + head + 16, nullptr, 10);
+				size_t body   = headerEnd + 4;
+
+				if(body + length > input.length())
+				{
+					break;
+				}
+
+				size_t id = input.find("\"id\":", body);
+
+				if(id != string::npos && id < body + length)
+				{
+					size_t request = strtoul(input.c_str() + id + 5, nullptr, 10);
+
+					if(request > 0 && request <= messageCount)
+					{
+						latencies.push_back(
+							chrono::duration<double, micro>(
+								now - sent[request]).count());
+					}
+
+					received++;
+				}
+
+				head = body + length;
+			}
+
+			input.erase(0, head);
+		}
+	});
+
+	auto start = Clock::now();
+
+	writeAll(fd, frame(
+		R"({"jsonrpc":"2.0","id":0,"method":"initialize","params":{)"
+		R"("processId":null,"rootUri":null,"capabilities":{}}})"));
+
+	for(size_t i = 1; i <= messageCount; i++)
+	{
+		// The initialize response is one of the received
+		while(i - received.load() >= window)
+		{
+			this_thread::yield();
+		}
+
+		sent[i] = Clock::now();
+
+		writeAll(fd, hover(i));
+	}
+
+	while(received.load() <= messageCount)
+	{
+		this_thread::yield();
+	}
+
+	chrono::duration<double> time = Clock::now() - start;
+
+	writeAll(fd, frame(R"({"jsonrpc":"2.0","method":"exit"})"));
+
+	// The server closes the connection after the exit notification
+	reader.join();
+	close(fd);
+
+	server.stop();
+	serving.join();
+
+	sort(latencies.begin(), latencies.end());
+
+	cout << name << ": "
+		<< messageCount / time.count() << " messages/s\n";
+
+	if(syscalls >= 0)
+	{
+		cout << "  " << (double)syscalls / messageCount
+			<< " system calls/message\n";
+	}
+	else
+	{
+		cout << "  system calls not counted\n";
+	}
+
+	if(!latencies.empty())
+	{
+		cout << "  latency p50 " << latencies[latencies.size() / 2]
+			<< " us, p99 " << latencies[latencies.size() * 99 / 100]
+			<< " us\n";
+	}
+}
+
+int main()
+{
+	replay("Standard", IoBackend::standard);
+
+	if(!uringAvailable())
+	{
+		cout << "io_uring isn't available, the next run falls back\n";
+	}
+
+	replay("io_uring", IoBackend::uring);
+
+	return 0;
+}
@@ -0,0 +1,346 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <libclsp/server.hpp>
+#include <libclsp/types.hpp>
+
+using namespace std;
+using namespace clsp;
+
+// The number of hover requests of each run
+constexpr size_t messageCount = 200000;
+
+// The number of clients of the run with many connections
+constexpr size_t clientCount = 4;
+
+/// Adds the Content-Length header to a json
+static string frame(const string& json)
+{
+	return "Content-Length: " + to_string(json.length()) + "\r\n\r\n" + json;
+}
+
+/// The input of a whole session with some hover requests
+static string makeSession(size_t hovers = messageCount)
+{
+	string session = frame(
+		R"({"jsonrpc":"2.0","id":0,"method":"initialize","params":{)"
+		R"("processId":null,"rootUri":null,"capabilities":{}}})");
+
+	for(size_t i = 1; i <= hovers; i++)
+	{
+		session += frame(
+			R"({"jsonrpc":"2.0","id":)" + to_string(i) +
+			R"(,"method":"textDocument/hover","params":{"textDocument":)"
+			R"({"uri":"file:///home/user/project/main.cpp"},)"
+			R"("position":{"line":10,"character":4}}})");
+	}
+
+	session += frame(R"({"jsonrpc":"2.0","method":"exit"})");
+
+	return session;
+}
+
+/// Writes all the input in a thread
+static thread writeAll(int fd, const string& input)
+{
+	return thread([fd, &input]()
+	{
+		for(size_t i = 0; i < input.length();)
+		{
+			ssize_t n = write(fd, input.data() + i, input.length() - i);
+
+			if(n <= 0)
+			{
+				break;
+			}
+
+			i += n;
+		}
+
+		close(fd);
+	});
+}
+
+/// Writes all the input of a socket and reads its output in a thread
+static thread talk(int fd, const string& input, size_t& bytes)
+{
+	return thread([fd, &input, &bytes]()
+	{
+		thread writer([fd, &input]()
+		{
+			for(size_t i = 0; i < input.length();)
+			{
+				ssize_t n = write(fd, input.data() + i, input.length() - i);
+
+				if(n <= 0)
+				{
+					break;
+				}
+
+				i += n;
+			}
+		});
+
+		char buffer[1 << 16];
+		ssize_t n;
+
+		// The server closes the connection after the exit notification
+		while((n = read(fd, buffer, sizeof(buffer))) > 0)
+		{
+			bytes += n;
+		}
+
+		writer.join();
+		close(fd);
+	});
+}
+
+/// Reads all the output in a thread
+static thread readAll(int fd, size_t& bytes)
+{
+	return thread([fd, &bytes]()
+	{
+		char buffer[1 << 16];
+		ssize_t n;
+
+		while((n = read(fd, buffer, sizeof(buffer))) > 0)
+		{
+			bytes += n;
+		}
+
+		close(fd);
+	});
+}
+
+static void report(const char* name, chrono::duration<double> time)
+{
+	cout << name << ": "
+		<< messageCount / time.count() << " messages/s ("
+		<< time.count() * 1e9 / messageCount << " ns/message)\n";
+}
+
+/// Runs a server with the session as its input
+static void runServer(const char* name, Server& server, const string& session)
+{
+	int input[2];
+	int output[2];
+	pipe(input);
+	pipe(output);
+
+	size_t bytes = 0;
+
+	thread writer = writeAll(input[1], session);
+	thread reader = readAll(output[0], bytes);
+
+	auto start = chrono::steady_clock::now();
+
+	server.startIO(input[0], output[1]);
+
+	report(name, chrono::steady_clock::now() - start);
+
+	close(input[0]);
+	close(output[1]);
+
+	writer.join();
+	reader.join();
+
+	cout << "  " << bytes << " bytes written\n";
+}
+
+int main()
+{
+	string session = makeSession();
+
+	// Only the frames and the envelopes
+	{
+		int input[2];
+		pipe(input);
+
+		thread writer = writeAll(input[1], session);
+
+		auto start = chrono::steady_clock::now();
+
+		FrameReader reader(input[0]);
+		size_t messages = 0;
+
+		while(reader.read() > 0)
+		{
+			while(auto buffer = reader.next())
+			{
+				messages += MessageEnvelope::parse(move(buffer)).has_value();
+			}
+		}
+
+		report("Framing", chrono::steady_clock::now() - start);
+
+		writer.join();
+		close(input[0]);
+
+		cout << "  " << messages << " messages\n";
+	}
+
+	// The whole server, with the params decoded and the responses written
+	{
+		Server server;
+
+		Capability initialize = Capability::initialize;
+		initialize.handler = [](optional<any>&)
+		{
+			return any(InitializeResult());
+		};
+
+		Capability hover = Capability::textDocumentHover;
+		hover.handler = [](optional<any>&)
+		{
+			return any(variant<Hover, Null>(Null()));
+		};
+
+		server.addCapability(initialize);
+		server.addCapability(hover);
+
+		runServer("Server", server, session);
+	}
+
+	// The same with typed handlers, without std::any
+	{
+		Server server;
+
+		server.addCapability(Methods::initialize.handle(
+			[](InitializeParams&)
+			{
+				return InitializeResult();
+			}));
+
+		server.addCapability(Methods::textDocumentHover.handle(
+			[](HoverParams&)
+			{
+				return variant<Hover, Null>(Null());
+			}));
+
+		runServer("Typed server", server, session);
+	}
+
+	// The same with the messages decoded by the dispatcher, without decoder
+	// threads
+	{
+		Server server;
+
+		server.decoderCount = 1;
+
+		server.addCapability(Methods::initialize.handle(
+			[](InitializeParams&)
+			{
+				return InitializeResult();
+			}));
+
+		server.addCapability(Methods::textDocumentHover.handle(
+			[](HoverParams&)
+			{
+				return variant<Hover, Null>(Null());
+			}));
+
+		runServer("Typed server, one decoder", server, session);
+	}
+
+	// The same session split between clients over TCP on the loopback, so
+	// their handlers share one pool
+	{
+		Server server;
+
+		server.addCapability(Methods::initialize.handle(
+			[](InitializeParams&)
+			{
+				return InitializeResult();
+			}));
+
+		server.addCapability(Methods::textDocumentHover.handle(
+			[](HoverParams&)
+			{
+				return variant<Hover, Null>(Null());
+			}));
+
+		auto transport = make_unique<TcpTransport>("127.0.0.1", 0);
+		TcpTransport& tcp = *transport;
+
+		server.addTransport(move(transport));
+
+		thread serving([&server]()
+		{
+			server.serve();
+		});
+
+		// serve() opens the transport
+		while(tcp.port() == 0)
+		{
+			this_thread::yield();
+		}
+
+		sockaddr_in address = {};
+
+		address.sin_family = AF_INET;
+		address.sin_port   = htons(tcp.port());
+		inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+
+		string clientSession = makeSession(messageCount / clientCount);
+
+		vector<size_t> bytes(clientCount, 0);
+		vector<thread> clients;
+
+		auto start = chrono::steady_clock::now();
+
+		for(size_t i = 0; i < clientCount; i++)
+		{
+			int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+			connect(fd, (sockaddr*)&address, sizeof(address));
+
+			clients.emplace_back(talk(fd, clientSession, bytes[i]));
+		}
+
+		for(thread& client: clients)
+		{
+			client.join();
+		}
+
+		report("Connections", chrono::steady_clock::now() - start);
+
+		server.stop();
+		serving.join();
+
+		size_t total = 0;
+
+		for(size_t clientBytes: bytes)
+		{
+			total += clientBytes;
+		}
+
+		cout << "  " << total << " bytes written to " << clientCount
+			<< " clients\n";
+	}
+
+	return 0;
+}
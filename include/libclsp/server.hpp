@@ -16,7 +16,32 @@
 
 #pragma once
 
+#include <libclsp/server/accessScheduler.hpp>
+#include <libclsp/server/cancellationToken.hpp>
 #include <libclsp/server/capability.hpp>
+#include <libclsp/server/connection.hpp>
+#include <libclsp/server/deferredResponse.hpp>
+#include <libclsp/server/frameReader.hpp>
+#include <libclsp/server/frameWriter.hpp>
+#include <libclsp/server/ioBackend.hpp>
 #include <libclsp/server/jsonHandler.hpp>
+#include <libclsp/server/jsonValue.hpp>
 #include <libclsp/server/jsonWriter.hpp>
+#include <libclsp/server/messageBuffer.hpp>
+#include <libclsp/server/messageEnvelope.hpp>
+#include <libclsp/server/methodId.hpp>
+#include <libclsp/server/methods.hpp>
+#include <libclsp/server/objectDescriptor.hpp>
+#include <libclsp/server/outbox.hpp>
+#include <libclsp/server/priorityScheduler.hpp>
+#include <libclsp/server/requestTable.hpp>
+#include <libclsp/server/responseFuture.hpp>
 #include <libclsp/server/server.hpp>
+#include <libclsp/server/spscQueue.hpp>
+#include <libclsp/server/statistics.hpp>
+#include <libclsp/server/task.hpp>
+#include <libclsp/server/threadPool.hpp>
+#include <libclsp/server/timerWheel.hpp>
+#include <libclsp/server/tracer.hpp>
+#include <libclsp/server/transport.hpp>
+#include <libclsp/server/typedCapability.hpp>
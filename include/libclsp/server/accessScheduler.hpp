@@ -0,0 +1,189 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include <libclsp/server/capability.hpp>
+#include <libclsp/server/priorityScheduler.hpp>
+#include <libclsp/server/threadPool.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// Orders the handlers of a connection by the documents that they use.
+///
+/// A handler uses the document of its params, or the whole workspace if it
+/// doesn't have one, and reads or writes it (see Access). Each document and
+/// the workspace have a queue in the order of the input, and a handler
+/// starts when it doesn't conflict with the ones before it in its queues:
+/// reads of a document run together, a write runs alone, and a handler of
+/// the workspace waits for the handlers of every document.
+///
+/// So the handlers of different documents run in parallel, and the ones
+/// that conflict still run in the order of their messages, without locks in
+/// the handlers.
+class AccessScheduler
+{
+private:
+	/// How a handler uses one of its queues
+	enum class Mode
+	{
+		/// It reads a document of the workspace
+		intentRead,
+
+		/// It writes a document of the workspace
+		intentWrite,
+
+		/// It reads
+		read,
+
+		/// It writes
+		write
+	};
+
+	/// The number of modes
+	constexpr static size_t modeCount = 4;
+
+	/// A handler in its queues
+	struct Ticket
+	{
+		/// The handler
+		function<void()> task;
+
+		/// The priority in the PriorityScheduler
+		Priority priority;
+
+		/// The document, nullopt for the whole workspace
+		optional<String> document;
+
+		/// How it uses the workspace
+		Mode workspaceMode = Mode::read;
+
+		/// How it uses its document
+		Mode documentMode = Mode::read;
+
+		/// The queues where it waits, it starts at 0
+		unsigned waiting = 0;
+
+		/// Where it is in the tickets of the scheduler
+		list<unique_ptr<Ticket>>::iterator self;
+	};
+
+	/// A handler in one of its queues
+	struct Entry
+	{
+		Ticket* ticket;
+
+		/// How it uses the queue
+		Mode mode;
+	};
+
+	/// A queue of a document or the workspace.
+	///
+	/// The handlers that don't conflict with the ones before them are only
+	/// counted by mode. A ready handler after one that waits was checked
+	/// against it, and compatibility goes both ways, so a handler that waits
+	/// only checks the modes of the ready ones and of the ones that wait
+	/// before it.
+	struct Queue
+	{
+		/// The ready handlers of each mode
+		array<size_t, modeCount> ready{};
+
+		/// The handlers of each mode that wait
+		array<size_t, modeCount> waitingModes{};
+
+		/// The handlers that wait, in order
+		list<Entry> waiting;
+
+		/// If it doesn't have handlers
+		bool empty() const;
+	};
+
+	/// Runs the handlers that can start
+	PriorityScheduler& scheduler;
+
+	/// The group of the handlers
+	TaskGroup& group;
+
+	/// A mutex for the queues
+	mutex queueMutex;
+
+	/// The handlers of the whole workspace, and the ones of the documents
+	/// with an intent mode
+	Queue workspace;
+
+	/// The handlers of each document
+	map<String, Queue> documents;
+
+	/// The tickets of the handlers that didn't finish
+	list<unique_ptr<Ticket>> tickets;
+
+	/// If two modes can be in the same queue at the same time
+	static bool compatible(Mode first, Mode second);
+
+	/// A bit for each mode with handlers
+	static unsigned maskOf(const array<size_t, modeCount>& modes);
+
+	/// If a mode is compatible with a set of modes, a bit for each one
+	static bool compatible(unsigned modes, Mode mode);
+
+	/// Adds a ticket to a queue, it's ready if it doesn't conflict with
+	/// anything before it
+	void enqueue(Queue& queue, Ticket* ticket, Mode mode);
+
+	/// Moves the tickets that stopped conflicting to the ready ones, and
+	/// starts the ones that are ready in all their queues.
+	/// It stops at the first write, nothing after it can start.
+	void startReady(Queue& queue);
+
+	/// Gives a ticket to the PriorityScheduler
+	void start(Ticket* ticket);
+
+	/// Removes a ticket that finished from its queues
+	void finish(Ticket* ticket);
+
+public:
+	/// The handlers run in a PriorityScheduler as tasks of a group, so
+	/// waiting for the group waits for the ones that didn't start too.
+	AccessScheduler(PriorityScheduler& scheduler, TaskGroup& group);
+
+	AccessScheduler(const AccessScheduler&) = delete;
+	AccessScheduler& operator=(const AccessScheduler&) = delete;
+
+	virtual ~AccessScheduler();
+
+	/// Runs a handler after the ones submitted before it that conflict.
+	/// The task must not throw.
+	void submit(function<void()> task,
+		Priority priority,
+		Access access,
+		optional<String> document);
+};
+
+}
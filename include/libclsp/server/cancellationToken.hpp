@@ -0,0 +1,97 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace clsp
+{
+
+using namespace std;
+
+enum class ErrorCodes;
+
+struct ResponseError;
+
+/// A flag that tells a handler that its request was cancelled.
+///
+/// Copies share the same flag. Checking it is one relaxed atomic load, so
+/// a handler can poll it often.
+class CancellationToken
+{
+private:
+	/// The ErrorCodes of the cancellation, or 0 if it isn't cancelled
+	shared_ptr<atomic<int>> cancelled;
+
+	/// Cancels with a reason, the first reason stays
+	void cancel(ErrorCodes reason);
+
+	/// The token of the handler that runs in this thread
+	static thread_local const CancellationToken* currentToken;
+
+	friend class CancellationScope;
+
+public:
+	/// A token that isn't cancelled yet
+	CancellationToken();
+
+	virtual ~CancellationToken();
+
+	/// If the request was cancelled
+	bool isCancelled() const;
+
+	/// Cancels the request because the client asked for it
+	void cancel();
+
+	/// Cancels the request because its document changed
+	void supersede();
+
+	/// ErrorCodes::RequestCancelled or ErrorCodes::ContentModified.
+	/// Only valid if the request was cancelled.
+	ErrorCodes reason() const;
+
+	/// The error that answers a cancelled request
+	ResponseError error() const;
+
+	/// Throws error() if the request was cancelled.
+	/// A handler can call this to stop, the server answers the error.
+	void throwIfCancelled() const;
+
+	/// The token of the request of the handler that runs in this thread.
+	/// The subtasks of a handler must copy it, they can run in other
+	/// threads.
+	static const CancellationToken& current();
+};
+
+/// Makes a token the current one of this thread while it lives
+class CancellationScope
+{
+private:
+	/// The token before this scope
+	const CancellationToken* previous;
+
+public:
+	CancellationScope(const CancellationToken& token);
+
+	CancellationScope(const CancellationScope&) = delete;
+	CancellationScope& operator=(const CancellationScope&) = delete;
+
+	~CancellationScope();
+};
+
+}
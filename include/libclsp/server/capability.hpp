@@ -17,9 +17,11 @@
 #pragma once
 
 #include <any>
+#include <memory>
 
 #include <libclsp/server/jsonHandler.hpp>
 #include <libclsp/server/jsonWriter.hpp>
+#include <libclsp/server/methodId.hpp>
 #include <libclsp/types/objectT.hpp>
 
 namespace clsp
@@ -27,11 +29,71 @@ namespace clsp
 
 using namespace std;
 
+struct MessageEnvelope;
+
+/// How soon the requests of a capability run, see PriorityScheduler
+enum class Priority
+{
+	/// Requests that the user waits for while typing, like a completion
+	interactive,
+
+	/// Everything else
+	normal,
+
+	/// Requests that can wait, like the symbols of the whole workspace
+	background
+};
+
+/// What the handler of a capability does with the document of its params,
+/// or with the whole workspace if they don't have one.
+/// See AccessScheduler.
+enum class Access
+{
+	/// It only reads it, many readers can run at the same time
+	read,
+
+	/// It changes it, it runs alone and in the order of the messages
+	write
+};
+
+/// The params of a message decoded by a TypedHandler, with their own type.
+/// See DecodedParamsOf.
+struct DecodedParams
+{
+	/// The params if their type is T, or nullptr
+	template<class T>
+	T* as();
+
+	virtual ~DecodedParams();
+};
+
+/// A handler that knows the types of its params and result, made by
+/// TypedCapability::handle().
+/// It decodes and writes them without std::any or std::function.
+class TypedHandler
+{
+public:
+	/// Decodes the params of a message.
+	/// nullptr if they are invalid.
+	virtual unique_ptr<DecodedParams> decode(
+		const MessageEnvelope& envelope) const = 0;
+
+	/// Runs the handler and writes its result as a json value, if it has
+	/// one. Errors are thrown as a ResponseError.
+	virtual void run(DecodedParams& params, JsonWriter& result) const = 0;
+
+	virtual ~TypedHandler();
+};
+
 struct Capability
 {
 	/// The name of the method
 	String method;
 
+	/// The interned id of the method.
+	/// Server::addCapability() makes it again, in case the method changed.
+	MethodId methodId;
+
 	struct JsonIO
 	{
 		/// A function to write the params or result.
@@ -54,8 +116,32 @@ struct Capability
 	/// Ommited for notifications.
 	optional<JsonIO> result;
 
+	/// The function that handles the message when it comes from the client.
+	///
+	/// It gets the params and returns the result of a request, the result of
+	/// a notification is ignored. Errors are thrown as a ResponseError.
+	optional<function<any(optional<any>& params)>> handler;
+
+	/// A handler that uses the types of the params and the result, see
+	/// TypedCapability::handle().
+	/// The server uses it instead of the handler above.
+	shared_ptr<const TypedHandler> typedHandler;
+
+	/// If a request is answered with ErrorCodes::ContentModified when a
+	/// didChange makes its document newer than the one it was made for.
+	bool cancelOnChange = true;
+
+	/// How soon its requests run when the pool is busy
+	Priority priority = Priority::normal;
+
+	/// If its handler reads or writes the document of the params
+	Access access = Access::read;
+
 	Capability(String method, JsonIO params, optional<JsonIO> result);
 
+	/// If the capability has a handler, typed or not
+	bool hasHandler() const;
+
 	virtual ~Capability();
 
 	// Default capabilities
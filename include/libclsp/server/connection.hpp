@@ -0,0 +1,420 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <libclsp/server/accessScheduler.hpp>
+#include <libclsp/server/cancellationToken.hpp>
+#include <libclsp/server/capability.hpp>
+#include <libclsp/server/deferredResponse.hpp>
+#include <libclsp/server/frameReader.hpp>
+#include <libclsp/server/frameWriter.hpp>
+#include <libclsp/server/ioBackend.hpp>
+#include <libclsp/server/messageEnvelope.hpp>
+#include <libclsp/server/outbox.hpp>
+#include <libclsp/server/requestTable.hpp>
+#include <libclsp/server/responseFuture.hpp>
+#include <libclsp/server/server.hpp>
+#include <libclsp/server/spscQueue.hpp>
+#include <libclsp/server/threadPool.hpp>
+#include <libclsp/server/tracer.hpp>
+#include <libclsp/server/transport.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// A client of the server, with its own framing state, request tables and
+/// documents.
+///
+/// The event loop of the server reads its input and splits it in messages.
+/// The rest of the pipeline belongs to the connection: decoders that parse
+/// the messages, a dispatcher that routes them in the order of the input,
+/// and a writer that serializes the responses. With one decoder, or on one
+/// core, the dispatcher decodes the messages itself. The handlers run in
+/// the pool of the server, which every connection shares, in the order
+/// that its AccessScheduler allows.
+class Connection
+{
+private:
+	/// The server of the capabilities and the pool
+	Server& server;
+
+	/// The file descriptors
+	Channel channel;
+
+	/// Splits the input, only used by the event loop
+	unique_ptr<FrameReader> reader;
+
+	/// Writes the output
+	unique_ptr<FrameWriter> writer;
+
+
+	/// The requests sent to the client
+	RequestTable requestsSent;
+
+	/// The requests recieved from the client, with their cancellation
+	/// tokens.
+	RequestTable requestsRecieved;
+
+	/// The responses that sendRequest() waits from the client, by the id of
+	/// their request
+	unordered_map<int, shared_ptr<ResponseFuture::State>> awaited;
+
+	/// A mutex for the awaited responses
+	mutex awaitedMutex;
+
+	/// If the connection ended and doesn't wait for more responses
+	bool awaitedClosed = false;
+
+
+	/// A message from the client between the threads of the connection
+	struct IncomingMessage
+	{
+		/// If the input had an invalid header instead of a message
+		bool invalidHeader = false;
+
+		/// The envelope, nullopt if the json is invalid
+		optional<MessageEnvelope> envelope;
+
+		/// The capability of the method, nullptr if there isn't one
+		const Capability* capability = nullptr;
+
+		/// The params, decoded if the capability has a handler
+		optional<any> params;
+
+		/// The params, decoded if the capability has a typed handler
+		shared_ptr<DecodedParams> typedParams;
+
+		/// If the params were decoded without errors
+		bool validParams = false;
+
+		/// The token of a request
+		optional<CancellationToken> token;
+
+		/// The document of the params
+		optional<DocumentRef> document;
+
+		/// If the handler deferred its response, see DeferredResponse
+		bool deferred = false;
+
+		/// When the dispatcher gave it to the scheduler
+		chrono::steady_clock::time_point dispatched;
+
+		/// The arena of the handler, see Server::requestArenas
+		shared_ptr<pmr::memory_resource> arena;
+	};
+
+	/// A message to the client between the threads of the connection
+	struct OutgoingMessage
+	{
+		/// The arena of the handler that made the response.
+		/// It's first so it outlives the response, see operator=().
+		shared_ptr<pmr::memory_resource> arena;
+
+		/// A response that is written by the writer thread
+		unique_ptr<ResponseMessage> response;
+
+		/// A message that is already written
+		string json;
+
+		/// The token of the request of the response
+		optional<CancellationToken> token;
+
+		/// The method of a response, for the statistics
+		optional<MethodId> method;
+
+		/// The id of a response that is already written, for the traces
+		optional<variant<Number, String>> id;
+
+		OutgoingMessage();
+
+		OutgoingMessage(unique_ptr<ResponseMessage> response,
+			string json,
+			optional<CancellationToken> token,
+			optional<MethodId> method = nullopt,
+			optional<variant<Number, String>> id = nullopt,
+			shared_ptr<pmr::memory_resource> arena = nullptr);
+
+		OutgoingMessage(OutgoingMessage&& other);
+
+		/// Drops the old response before its arena
+		OutgoingMessage& operator=(OutgoingMessage&& other);
+
+		virtual ~OutgoingMessage();
+	};
+
+	/// The messages for the decoders, given in turns by the event loop
+	vector<unique_ptr<SpscQueue<shared_ptr<MessageBuffer>>>> frames;
+
+	/// The messages for the dispatcher, in the same turns.
+	/// Empty if the dispatcher decodes the messages.
+	vector<unique_ptr<SpscQueue<IncomingMessage>>> decoded;
+
+	/// The messages for the writer thread.
+	/// The handlers of many workers can send messages.
+	Outbox<OutgoingMessage> outbox;
+
+	/// The handlers that run in the pool
+	TaskGroup runningHandlers;
+
+	/// Orders the handlers by the documents that they read and write
+	AccessScheduler accessScheduler;
+
+	/// A document that the client opened
+	struct DocumentState
+	{
+		/// The last version of the document
+		int version = 0;
+
+		/// The requests on the document that may be running, with the
+		/// version they were made for
+		vector<pair<variant<Number, String>, int>> requests;
+
+		/// The number of requests that makes the list be cleaned
+		size_t cleanSize = 32;
+	};
+
+	/// The documents with running requests or a version.
+	/// Only used by the dispatcher.
+	map<String, DocumentState> documents;
+
+	/// Updates the version of a document with a didOpen, didChange or
+	/// didClose, and answers the requests of older versions with
+	/// ErrorCodes::ContentModified.
+	void updateDocument(const String& method, const DocumentRef& document);
+
+	/// Remembers the version that a request was made for
+	void addDocumentRequest(const DocumentRef& document,
+		variant<Number, String> id);
+
+	/// If the Initialize request was received.
+	bool initialized = false;
+
+	/// If the connection reads more messages.
+	/// The exit notification stops it.
+	atomic<bool> running{true};
+
+	/// If the threads of the connection are done
+	atomic<bool> finished{false};
+
+
+	/// The messages that didn't fit in the queues of the decoders.
+	/// Only used by the event loop.
+	deque<shared_ptr<MessageBuffer>> backlog;
+
+	/// The queue of the next message
+	size_t nextFrame = 0;
+
+	/// If the event loop waits for the decoders to make space for the
+	/// backlog. The decoder that makes it wakes the event loop.
+	atomic<bool> stalled{false};
+
+	/// If the event loop watches the input.
+	/// It doesn't while the backlog waits for the decoders.
+	bool watched = false;
+
+	/// If the input ended or can't be split anymore
+	bool inputEnded = false;
+
+	/// If the queues of the decoders were closed
+	bool inputClosed = false;
+
+	/// If the input can't be watched, like a regular file, and is read
+	/// every turn of the event loop
+	bool alwaysReadable = false;
+
+	/// Reads the input once and queues its messages.
+	/// Runs in the event loop.
+	void readInput();
+
+	/// Gives a message to the decoders or keeps it in the backlog
+	void queueFrame(shared_ptr<MessageBuffer> buffer);
+
+	/// Gives the backlog to the decoders.
+	/// false if some messages are still waiting.
+	bool flushBacklog();
+
+	/// Closes the queues of the decoders.
+	/// The backlog is dropped.
+	void closeInput();
+
+
+	/// The decoder threads
+	vector<thread> decoderThreads;
+
+	/// The dispatcher thread
+	thread dispatcherThread;
+
+	/// The writer thread
+	thread writerThread;
+
+	/// The connection of the thread, see current()
+	static thread_local Connection* currentConnection;
+
+	/// The message whose handler runs in this thread
+	static thread_local IncomingMessage* currentMessage;
+
+	/// Takes a message from a queue of the event loop.
+	/// false if the queue is closed, or empty and it doesn't wait.
+	bool popFrame(SpscQueue<shared_ptr<MessageBuffer>>& frames,
+		shared_ptr<MessageBuffer>& buffer,
+		bool wait);
+
+	/// A decoder thread
+	void decodeMessages(SpscQueue<shared_ptr<MessageBuffer>>& frames,
+		SpscQueue<IncomingMessage>& decoded);
+
+	/// Parses the envelope and the params of a message
+	IncomingMessage decodeMessage(shared_ptr<MessageBuffer> buffer);
+
+	/// Records a span of a message from the client, with its tags
+	static void traceMessage(Tracer& tracer,
+		const char* name,
+		const IncomingMessage& message,
+		chrono::steady_clock::time_point start,
+		chrono::steady_clock::time_point end);
+
+	/// Records a span of a message to the client, with its tags
+	static void traceMessage(Tracer& tracer,
+		const char* name,
+		const OutgoingMessage& message,
+		chrono::steady_clock::time_point start,
+		chrono::steady_clock::time_point end);
+
+	/// Merges a queued didChange into the one before it, if both change the
+	/// same document. Returns false if next isn't merged.
+	static bool coalesceChange(IncomingMessage& change, IncomingMessage& next);
+
+	/// The dispatcher thread.
+	/// Takes the messages in the same turns as the event loop, so they keep
+	/// the order of the input.
+	void dispatchMessages();
+
+	/// Routes a message to the handler of its capability.
+	/// Runs in the dispatcher thread.
+	void dispatchMessage(IncomingMessage& message);
+
+	/// Runs the handler of a message and sends its response
+	void runHandler(IncomingMessage& message);
+
+	/// Runs a typed handler, it writes the response in the calling thread
+	void runTypedHandler(IncomingMessage& message,
+		variant<Number, String, Null> id);
+
+	/// Gives a message to the writer thread, in a lane of the outbox.
+	/// A queued message with the same key is replaced.
+	void post(OutgoingMessage message,
+		Priority lane = Priority::normal,
+		string key = {});
+
+	/// The writer thread
+	void writeMessages();
+
+	/// Defers the response of the handler that runs in this thread (see
+	/// DeferredResponse::defer()).
+	optional<DeferredResponse> deferResponse();
+
+	/// Resolves the response of a request to the client and runs its
+	/// continuation in the pool
+	void resolve(shared_ptr<ResponseFuture::State> state,
+		ClientResponse response);
+
+	/// Reads a response of the client.
+	/// Runs in the dispatcher thread.
+	void readResponse(MessageEnvelope& envelope);
+
+	/// Gives up on a request that the client didn't answer in time, and
+	/// cancels it in the client.
+	/// Runs in the event loop, with the timers.
+	void expireRequest(int id);
+
+	/// Resolves the responses that are still awaited with an error.
+	/// The requests sent after it are resolved right away.
+	void closeAwaited();
+
+	/// Answers a request with an error.
+	void sendError(variant<Number, String, Null> id,
+		ErrorCodes code,
+		String message);
+
+	friend class Server;
+	friend class DeferredResponse;
+	friend class HandlerContext;
+
+public:
+	/// Starts the threads of a connection.
+	/// The server must be serving, the connection uses its pool.
+	Connection(Server& server, Channel channel);
+
+	Connection(const Connection&) = delete;
+	Connection& operator=(const Connection&) = delete;
+
+	/// Waits for the threads and closes the file descriptors if they are
+	/// owned
+	virtual ~Connection();
+
+	/// Writes a message to the client.
+	/// The diagnostics and progress go behind the responses, and wait while
+	/// the outbox has more than Server::outboxLimit bytes.
+	void send(ObjectT& message);
+
+	/// Sends a request to the client (see Server::sendRequest()).
+	ResponseFuture sendRequest(const Capability& capability,
+		optional<any> params,
+		chrono::milliseconds timeout);
+
+	/// Adds a request to one of the two request tables.
+	void addRequest(variant<Number, String> id, String method, RequestKind kind);
+
+	/// Adds a request to the client with a new id and returns the id.
+	int addRequest(String method);
+
+	/// Completes a request and returns the method name, or an empty name if
+	/// there isn't a request with the id.
+	string_view completeRequest(variant<Number, String> id, RequestKind kind);
+
+	/// Cancels a request from the client (see Server::cancelRequest()).
+	void cancelRequest(variant<Number, String> id);
+
+	/// The bytes of the messages that wait for the writer
+	size_t pendingBytes() const;
+
+	/// If the connection ended and its messages were written
+	bool isFinished() const;
+
+	/// The connection whose handler or thread runs in this thread, or
+	/// nullptr.
+	/// The subtasks of a handler must copy it, they can run in other
+	/// threads.
+	static Connection* current();
+};
+
+}
@@ -0,0 +1,151 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <any>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <variant>
+
+#include <libclsp/server/cancellationToken.hpp>
+#include <libclsp/server/capability.hpp>
+#include <libclsp/server/methodId.hpp>
+#include <libclsp/types/jsonTypes.hpp>
+#include <libclsp/types/responseMessage.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+class Connection;
+
+/// The response of a handler that answers after it returns.
+///
+/// A handler calls defer() and keeps the response, then it can return
+/// while it waits for the client or for other work, and its connection
+/// doesn't end until the response is given. The return value of the
+/// handler is ignored. A notification can be deferred too, to keep its
+/// connection while it runs.
+///
+/// The document of the request isn't held while it's deferred, the
+/// messages after it can change it.
+class DeferredResponse
+{
+private:
+	/// What the copies of a response share
+	struct State
+	{
+		/// The arena of the handler, first so it outlives the rest
+		shared_ptr<pmr::memory_resource> arena;
+
+		/// The connection of the request
+		Connection& connection;
+
+		/// The id, nullopt for a notification
+		optional<variant<Number, String>> id;
+
+		/// The method of the request
+		MethodId method;
+
+		/// The lane of the response
+		Priority priority;
+
+		/// The token of the request
+		CancellationToken token;
+
+		/// Lets the connection end
+		function<void()> release;
+
+		/// If the response was given
+		atomic<bool> done{false};
+
+		State(Connection& connection,
+			optional<variant<Number, String>> id,
+			MethodId method,
+			Priority priority,
+			CancellationToken token,
+			function<void()> release,
+			shared_ptr<pmr::memory_resource> arena);
+
+		/// Answers with an error if the response wasn't given
+		virtual ~State();
+	};
+
+	shared_ptr<State> state;
+
+	DeferredResponse(shared_ptr<State> state);
+
+	/// Gives the response once, with a result or an error, and lets the
+	/// connection end
+	static void finish(State& state,
+		optional<any> result,
+		optional<ResponseError> error);
+
+	friend class Connection;
+
+public:
+	virtual ~DeferredResponse();
+
+	/// Defers the response of the handler that runs in this thread.
+	/// nullopt if there isn't one, or if it was already deferred.
+	static optional<DeferredResponse> defer();
+
+	/// Answers with a result, written by the capability of the request.
+	/// Only the first answer is sent.
+	void resolve(any result);
+
+	/// Answers with an error
+	void fail(ResponseError error);
+
+	/// If the response was given
+	bool isDone() const;
+
+	/// The token of the request
+	const CancellationToken& token() const;
+};
+
+/// What a handler sees of its thread: its connection and the token of its
+/// request.
+///
+/// Work that continues the handler in another thread, like a continuation
+/// or a coroutine that resumes, runs with the context of the handler.
+class HandlerContext
+{
+private:
+	/// The connection, see Connection::current()
+	Connection* connection;
+
+	/// The token, see CancellationToken::current()
+	CancellationToken token;
+
+public:
+	/// The context of the calling thread
+	static HandlerContext current();
+
+	/// Runs a function with the context in the calling thread
+	void run(const function<void()>& function) const;
+
+	HandlerContext(Connection* connection, CancellationToken token);
+
+	virtual ~HandlerContext();
+};
+
+}
@@ -0,0 +1,130 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+
+#include <sys/types.h>
+
+#include <libclsp/server/messageBuffer.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// Splits the input of a file descriptor in messages with a Content-Length
+/// header.
+///
+/// The input is read in large chunks and each message is a MessageBuffer
+/// inside its chunk, so the json is never copied. A chunk is reused when
+/// there aren't messages in it, a new one is made otherwise. Only the start
+/// of an incomplete message is moved to the next chunk.
+class FrameReader
+{
+protected:
+	/// The file descriptor of the input
+	int fd;
+
+	/// Reads at most length bytes of the input into a buffer.
+	/// Returns like ::read(), other backends override it.
+	virtual ssize_t readSome(char* buffer, size_t length);
+
+	/// If a buffer of some length is inside the chunk.
+	/// A backend that copies to the buffer checks it first.
+	bool inChunk(const char* buffer, size_t length) const;
+
+private:
+	/// The input that was read.
+	/// It has an extra byte for the '\0' of a message at the end.
+	shared_ptr<char[]> chunk;
+
+	/// The size of the chunk without the extra byte
+	size_t chunkSize;
+
+	/// The start of the next message
+	size_t head = 0;
+
+	/// The end of the input that was read
+	size_t tail = 0;
+
+	/// The start of the json of the next message.
+	/// Only valid if its header was parsed.
+	size_t bodyStart = 0;
+
+	/// The length of the json of the next message, or npos if its header
+	/// wasn't parsed.
+	size_t bodyLength;
+
+	/// The first byte of the next message.
+	/// It's replaced by the '\0' of the previous message.
+	char carry = '\0';
+
+	/// If the first byte of the next message is in carry
+	bool carried = false;
+
+	/// If the input has an invalid header
+	bool invalid = false;
+
+	/// Makes space for at least n bytes after the tail
+	void reserve(size_t n);
+
+	/// Parses the header at the head.
+	/// false if the header isn't complete.
+	bool parseHeader();
+
+public:
+	/// The size of the chunks if there isn't a bigger message
+	constexpr static size_t defaultChunkSize = 1 << 20;
+
+	/// The minimum space for each read()
+	constexpr static size_t minReadSize = 1 << 16;
+
+	/// The maximum length of a header
+	constexpr static size_t maxHeaderLength = 1 << 12;
+
+	/// The maximum length of the json of a message.
+	/// A longer Content-Length is an invalid header, so a client can't make
+	/// the server allocate anything it asks for.
+	constexpr static size_t maxBodyLength = 1 << 28;
+
+	FrameReader(int fd, size_t chunkSize = defaultChunkSize);
+
+	FrameReader(const FrameReader&) = delete;
+	FrameReader& operator=(const FrameReader&) = delete;
+
+	virtual ~FrameReader();
+
+	/// Reads as much input as possible with one read().
+	/// Returns the number of bytes, 0 at the end of the input and -1 on
+	/// errors.
+	ssize_t read();
+
+	/// The next complete message.
+	/// nullptr if it wasn't read yet or the input is invalid.
+	shared_ptr<MessageBuffer> next();
+
+	/// If the input has an invalid header.
+	/// Nothing else can be read after it.
+	bool failed() const;
+
+	/// The file descriptor that is readable when read() doesn't wait.
+	/// The input itself, unless a backend reads it in the background.
+	virtual int pollFd() const;
+};
+
+}
@@ -0,0 +1,79 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string_view>
+
+#include <sys/uio.h>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// Writes messages with a Content-Length header to a file descriptor.
+///
+/// The header and the json of a message are written with one writev(), so
+/// small messages only need one system call. It can be used by many threads.
+class FrameWriter
+{
+public:
+	/// The maximum length of a header
+	constexpr static size_t maxHeaderLength = 40;
+
+protected:
+	/// The file descriptor of the output
+	int fd;
+
+	/// If the output is a socket
+	bool socket;
+
+	/// The header of the message that is written.
+	/// Only used with the writeMutex.
+	char header[maxHeaderLength];
+
+	/// Writes some of the parts of a message.
+	/// Returns the number of bytes like writev(), other backends override
+	/// it.
+	virtual ssize_t writeParts(iovec* parts, int count);
+
+private:
+	/// A mutex to write one message at a time
+	mutex writeMutex;
+
+	/// If the output can't be written anymore
+	atomic<bool> broken{false};
+
+public:
+	FrameWriter(int fd);
+
+	FrameWriter(const FrameWriter&) = delete;
+	FrameWriter& operator=(const FrameWriter&) = delete;
+
+	virtual ~FrameWriter();
+
+	/// Writes a message.
+	/// false if the output can't be written.
+	bool write(string_view json);
+
+	/// If the output can't be written anymore
+	bool failed() const;
+};
+
+}
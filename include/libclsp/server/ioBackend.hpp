@@ -0,0 +1,58 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <memory>
+
+#include <libclsp/server/frameReader.hpp>
+#include <libclsp/server/frameWriter.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// How the connections read and write their file descriptors
+enum class IoBackend
+{
+	/// read() and writev() (or sendmsg() on sockets), with the input
+	/// watched by the epoll event loop
+	standard,
+
+	/// io_uring, if libclsp was built with liburing and the kernel has it.
+	///
+	/// Pipes and sockets are read by a multishot read into buffers that are
+	/// registered with the ring, and the event loop watches the ring
+	/// instead of the input. The header and the json of a message are two
+	/// linked writes, the header from a registered buffer, submitted with
+	/// one system call. Anything else falls back to IoBackend::standard.
+	uring
+};
+
+/// If the io_uring backend can be used in this system
+bool uringAvailable();
+
+/// Makes the reader of an input with a backend, or with the standard one
+/// if the backend can't read it
+unique_ptr<FrameReader> makeFrameReader(int fd, IoBackend backend);
+
+/// Makes the writer of an output with a backend, or with the standard one
+/// if the backend can't write it
+unique_ptr<FrameWriter> makeFrameWriter(int fd, IoBackend backend);
+
+}
@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <cstddef>
 #include <variant>
 #include <optional>
 #include <functional>
 #include <map>
+#include <memory_resource>
 #include <stack>
+#include <string_view>
+#include <vector>
 
 #include <rapidjson/reader.h>
 
@@ -32,7 +36,11 @@ namespace clsp
 using namespace std;
 using namespace rapidjson;
 
+class ObjectT;
 struct JsonHandler;
+struct ObjectDescriptor;
+struct FieldSetter;
+struct FieldDescriptor;
 
 /// Functions to initialize a json member
 struct ValueSetter
@@ -57,22 +65,39 @@ struct ValueSetter
 
 };
 
+/// Destroys a maker made by JsonHandler::pushMaker().
+/// Its memory is released with the arena of the handler.
+struct MakerDeleter
+{
+	void operator()(ObjectT* maker) const;
+};
+
 /// Data for the object initialization
 struct ObjectInitializer
 {
-	/// The key from which the object is the value
-	Key key;
-
-	/// A map with the keys of the object and it's initializers
-	map<Key, ValueSetter> setterMap;
-
-	/// A map with the keys of the members that need to be initialized.
-	/// The bool is set to true when the value is initialized.
-	map<Key, bool> neededMap;
+	/// A bit for each required member that isn't initialized yet, indexed
+	/// like DescribedMember::index.
+	uint64_t neededMask;
 
 	/// The object or array being initialized
 	ObjectT* object;
 
+	/// The same object as a pointer to its own type
+	void* self;
+
+	/// The static description of the members of the object
+	const ObjectDescriptor* descriptor;
+
+	/// The member of the last key, resolved by JsonHandler::Key().
+	/// nullptr if the key isn't in the descriptor.
+	const FieldDescriptor* field;
+
+	/// The object that owns field, it can be a parent of self
+	void* fieldObject;
+
+	/// The index of field in the descriptor
+	size_t fieldIndex;
+
 	/// The handler of the json parsing
 	JsonHandler* handler;
 
@@ -81,20 +106,47 @@ struct ObjectInitializer
 
 	// An optional object that makes another type of object or an array.
 	// This is owned by the initializer.
-	optional<unique_ptr<ObjectT>> objectMaker;
+	unique_ptr<ObjectT, MakerDeleter> objectMaker;
+
+
+	/// Sets the object being initialized and the descriptor of its members.
+	/// ObjectT::fillInitializer() overrides call this with their own type.
+	template<class T>
+	void bind(T* object, const ObjectDescriptor& descriptor)
+	{
+		bind(object, static_cast<void*>(object), descriptor);
+	}
 
+	void bind(ObjectT* object, void* self, const ObjectDescriptor& descriptor);
+
+	/// The keys of the required members that aren't initialized
+	vector<string_view> missingMembers() const;
 };
 
 struct JsonHandler: public BaseReaderHandler<UTF8<>, JsonHandler>
 {
+private:
+	/// Memory for the first initializers and makers
+	byte arenaBuffer[4096];
+
+public:
+	/// The memory of the initializers and the makers.
+	/// It's released all at once when the handler is destroyed.
+	pmr::monotonic_buffer_resource arena;
 
 	/// The top of this stack represents the path of the object being
 	/// constructed and the functions to initialize it's members
-	stack<ObjectInitializer> objectStack;
+	stack<ObjectInitializer, pmr::vector<ObjectInitializer>> objectStack;
 
-	/// Last key obtained by Key()
+	/// Last key obtained by Key() that isn't in the descriptor of the
+	/// object.
+	/// The keys with a known member aren't copied.
 	clsp::String lastKey;
 
+	/// The required members left uninitialized in the object that made the
+	/// parsing fail
+	vector<string_view> missingMembers;
+
 	// Functions needed by the RapidJson reader.
 
 	bool Null();
@@ -120,6 +172,40 @@ struct JsonHandler: public BaseReaderHandler<UTF8<>, JsonHandler>
 	/// A new ObjectInitializer is put at the top of the stack.
 	/// This function must be called before an object calls fillInitializer().
 	void pushInitializer();
+
+	/// Puts a new ObjectInitializer for the object at the top of the stack.
+	void pushObject(ObjectT& object);
+
+	/// Makes a maker in the arena and puts a new ObjectInitializer for it
+	/// at the top of the stack.
+	/// The initializer owns the maker.
+	template<class Maker, class... Args>
+	Maker& pushMaker(Args&&... args)
+	{
+		void* memory = arena.allocate(sizeof(Maker), alignof(Maker));
+
+		auto* maker = new(memory) Maker(forward<Args>(args)...);
+
+		pushObject(*maker);
+		objectStack.top().objectMaker.reset(maker);
+
+		return *maker;
+	}
+
+	JsonHandler();
+
+	JsonHandler(const JsonHandler&) = delete;
+	JsonHandler& operator=(const JsonHandler&) = delete;
+
+private:
+	/// Calls the setter of the last key on the object at the top of the
+	/// stack.
+	/// The setter is the member resolved by Key() or the extraSetter of the
+	/// descriptor and then the extraSetter of the initializer.
+	template<class StaticSetter, class DynamicSetter, class... Args>
+	bool setValue(StaticSetter FieldSetter::* staticSetter,
+		DynamicSetter ValueSetter::* dynamicSetter,
+		Args&&... args);
 };
 
 }
@@ -0,0 +1,242 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <initializer_list>
+#include <type_traits>
+#include <variant>
+
+#include <libclsp/server/jsonHandler.hpp>
+#include <libclsp/server/jsonWriter.hpp>
+#include <libclsp/types/genericObject.hpp>
+#include <libclsp/types/objectT.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// How a value of a known type is read from and written to json, without
+/// std::any.
+///
+/// write() writes the value. The read functions initialize the value from
+/// the json type of their name, they exist only if the matching reads
+/// member is true.
+template<class T, class Enable = void>
+struct JsonValue;
+
+/// An ObjectT
+template<class T>
+struct JsonValue<T, enable_if_t<is_base_of_v<ObjectT, T>>>
+{
+	constexpr static bool readsNull   = false;
+	constexpr static bool readsArray  = false;
+	constexpr static bool readsObject = true;
+
+	static void write(JsonWriter& writer, T& value)
+	{
+		writer.Object(value);
+	}
+
+	static void readObject(JsonHandler& handler, T& value)
+	{
+		handler.pushInitializer();
+		value.fillInitializer(handler.objectStack.top());
+	}
+};
+
+/// Null
+template<>
+struct JsonValue<Null>
+{
+	constexpr static bool readsNull   = true;
+	constexpr static bool readsArray  = false;
+	constexpr static bool readsObject = false;
+
+	static void write(JsonWriter& writer, Null&)
+	{
+		writer.Null();
+	}
+
+	static void readNull(Null&)
+	{
+	}
+};
+
+/// A generic array
+template<>
+struct JsonValue<Array>
+{
+	constexpr static bool readsNull   = false;
+	constexpr static bool readsArray  = true;
+	constexpr static bool readsObject = false;
+
+	static void write(JsonWriter& writer, Array& value)
+	{
+		writer.Array(value);
+	}
+
+	static void readArray(JsonHandler& handler, Array& value)
+	{
+		handler.pushMaker<ArrayMaker>(value);
+	}
+};
+
+/// Any json value, it's only written
+template<>
+struct JsonValue<Any>
+{
+	constexpr static bool readsNull   = false;
+	constexpr static bool readsArray  = false;
+	constexpr static bool readsObject = false;
+
+	static void write(JsonWriter& writer, Any& value)
+	{
+		writer.Any(value);
+	}
+};
+
+/// An array of a known type, only an array of ObjectT can be read
+template<class T>
+struct JsonValue<Vector<T>>
+{
+	constexpr static bool readsNull   = false;
+	constexpr static bool readsArray  = is_base_of_v<ObjectT, T>;
+	constexpr static bool readsObject = false;
+
+	static void write(JsonWriter& writer, Vector<T>& value)
+	{
+		writer.StartArray();
+
+		for(auto& element: value)
+		{
+			JsonValue<T>::write(writer, element);
+		}
+
+		writer.EndArray();
+	}
+
+	static void readArray(JsonHandler& handler, Vector<T>& value)
+	{
+		handler.pushMaker<ObjectArrayMaker<T>>(value);
+	}
+};
+
+/// One of many types.
+/// A json value is read as the first alternative that reads its json type.
+template<class... Ts>
+struct JsonValue<variant<Ts...>>
+{
+	constexpr static bool readsNull   = (JsonValue<Ts>::readsNull || ...);
+	constexpr static bool readsArray  = (JsonValue<Ts>::readsArray || ...);
+	constexpr static bool readsObject = (JsonValue<Ts>::readsObject || ...);
+
+	/// The index of the first alternative that reads a json type
+	constexpr static size_t firstOf(initializer_list<bool> reads)
+	{
+		size_t i = 0;
+
+		for(bool read: reads)
+		{
+			if(read)
+			{
+				break;
+			}
+			i++;
+		}
+
+		return i;
+	}
+
+	template<size_t I>
+	using Alternative = variant_alternative_t<I, variant<Ts...>>;
+
+	static void write(JsonWriter& writer, variant<Ts...>& value)
+	{
+		visit([&writer](auto& alternative)
+		{
+			using T = decay_t<decltype(alternative)>;
+
+			JsonValue<T>::write(writer, alternative);
+		}, value);
+	}
+
+	static void readNull(variant<Ts...>& value)
+	{
+		constexpr size_t i = firstOf({JsonValue<Ts>::readsNull...});
+
+		JsonValue<Alternative<i>>::readNull(value.template emplace<i>());
+	}
+
+	static void readArray(JsonHandler& handler, variant<Ts...>& value)
+	{
+		constexpr size_t i = firstOf({JsonValue<Ts>::readsArray...});
+
+		JsonValue<Alternative<i>>::readArray(handler,
+			value.template emplace<i>());
+	}
+
+	static void readObject(JsonHandler& handler, variant<Ts...>& value)
+	{
+		constexpr size_t i = firstOf({JsonValue<Ts>::readsObject...});
+
+		JsonValue<Alternative<i>>::readObject(handler,
+			value.template emplace<i>());
+	}
+};
+
+/// If a type can be read from json
+template<class T>
+constexpr bool isJsonReadable =
+	JsonValue<T>::readsNull ||
+	JsonValue<T>::readsArray ||
+	JsonValue<T>::readsObject;
+
+/// The setter that reads the root json value into a value of a known type
+template<class T>
+ValueSetter jsonReader(JsonHandler& handler, T& value)
+{
+	ValueSetter setter;
+
+	if constexpr(JsonValue<T>::readsNull)
+	{
+		setter.setNull = [&value]()
+		{
+			JsonValue<T>::readNull(value);
+		};
+	}
+
+	if constexpr(JsonValue<T>::readsArray)
+	{
+		setter.setArray = [&handler, &value]()
+		{
+			JsonValue<T>::readArray(handler, value);
+		};
+	}
+
+	if constexpr(JsonValue<T>::readsObject)
+	{
+		setter.setObject = [&handler, &value]()
+		{
+			JsonValue<T>::readObject(handler, value);
+		};
+	}
+
+	return setter;
+}
+
+}
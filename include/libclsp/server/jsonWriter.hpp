@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string_view>
+
 #include <rapidjson/writer.h>
 
 #include <libclsp/types/jsonTypes.hpp>
@@ -60,18 +62,44 @@ public:
 	/// Writes almost anything
 	bool Any(Any &a);
 
+	using Writer<StringBuffer>::String;
+
+	/// Writes a String
+	bool String(const clsp::String& str)
+	{
+		return Writer<StringBuffer>::String(str.data(), str.size());
+	}
+
+	/// Writes a String with any allocator
+	bool String(string_view str)
+	{
+		return Writer<StringBuffer>::String(str.data(), str.size());
+	}
+
 	/// Writes a new key
 	bool Key(clsp::Key& str)
 	{
 		return Writer<StringBuffer>::Key(str.c_str(), str.size());
 	}
 
+	/// Writes a new key
+	bool Key(string_view str)
+	{
+		return Writer<StringBuffer>::Key(str.data(), str.size());
+	}
+
 
 	/// Gets the json
 	const StringBuffer::Ch* GetString() const
 	{
 		return buffer.GetString();
 	}
+
+	/// Gets the length of the json
+	size_t GetSize() const
+	{
+		return buffer.GetSize();
+	}
 };
 
 
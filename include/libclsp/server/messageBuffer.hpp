@@ -0,0 +1,61 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The json content of one message.
+///
+/// It's shared with a shared_ptr<> by everything that still needs the
+/// message. The json is only read, so the same buffer can be decoded by
+/// parts (see MessageEnvelope) and a message split from a chunk of input
+/// is never copied.
+struct MessageBuffer
+{
+	/// The memory of a json that only this buffer uses
+	unique_ptr<char[]> owned;
+
+	/// The memory of a json that is shared with other buffers, like a chunk
+	/// of input with many messages (see FrameReader).
+	shared_ptr<char[]> shared;
+
+	/// The json, terminated by a '\0'
+	char* data;
+
+	/// The length of the json without the '\0'
+	size_t length;
+
+	/// A buffer for a json of the given length, filled later by the reader
+	MessageBuffer(size_t length);
+
+	/// A buffer with a copy of the json
+	MessageBuffer(string_view json);
+
+	/// A buffer inside a shared memory.
+	/// The json must be terminated by a '\0'.
+	MessageBuffer(shared_ptr<char[]> shared, char* data, size_t length);
+
+	virtual ~MessageBuffer();
+};
+
+}
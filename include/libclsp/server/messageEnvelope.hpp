@@ -0,0 +1,120 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <any>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <variant>
+
+#include <libclsp/server/capability.hpp>
+#include <libclsp/server/jsonValue.hpp>
+#include <libclsp/server/messageBuffer.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// A json value inside a MessageBuffer that isn't parsed yet
+struct JsonSlice
+{
+	/// The offset of the first byte of the value
+	size_t begin;
+
+	/// The offset after the last byte of the value
+	size_t end;
+
+	/// If the member isn't in the message
+	bool empty() const;
+};
+
+/// The document of a message, from the textDocument of its params
+struct DocumentRef
+{
+	/// The uri of the document
+	String uri;
+
+	/// The version, only in some messages like didOpen and didChange
+	optional<Number> version;
+};
+
+/// The members of a message that are needed to route it.
+///
+/// Only jsonrpc, id and method are parsed, params, result and error are
+/// kept as slices of the buffer, so a message that is cancelled or has no
+/// handler never decodes them.
+struct MessageEnvelope
+{
+	/// The whole message
+	shared_ptr<MessageBuffer> buffer;
+
+	/// The id of requests and responses
+	optional<variant<Number, String>> id;
+
+	/// The method of requests and notifications
+	optional<String> method;
+
+	/// The params of requests and notifications
+	JsonSlice params;
+
+	/// The result of a successful response
+	JsonSlice result;
+
+	/// The error of a failed response
+	JsonSlice error;
+
+	/// Parses the envelope of the message in the buffer.
+	/// The buffer isn't modified.
+	/// nullopt if the message isn't a valid json object.
+	static optional<MessageEnvelope> parse(shared_ptr<MessageBuffer> buffer);
+
+	/// The json text of a slice
+	string_view text(JsonSlice slice) const;
+
+	/// Reads params.textDocument without decoding the params.
+	/// nullopt if the params don't have one.
+	optional<DocumentRef> document() const;
+
+	/// Decodes a slice with the reader of a capability.
+	/// The buffer isn't modified.
+	ParseResult decode(JsonSlice slice,
+		const Capability::JsonIO& io,
+		optional<any>& data) const;
+
+	/// Decodes the params with the reader of a capability.
+	ParseResult decodeParams(const Capability::JsonIO& io,
+		optional<any>& data) const;
+
+	/// Decodes a slice with a handler that already has the setter of the
+	/// root value.
+	ParseResult decode(JsonSlice slice, JsonHandler& handler) const;
+
+	/// Decodes the params into a value of their own type, see JsonValue
+	template<class T>
+	ParseResult decodeParams(T& data) const
+	{
+		JsonHandler handler;
+
+		handler.objectStack.emplace().extraSetter = jsonReader(handler, data);
+
+		return decode(params, handler);
+	}
+};
+
+}
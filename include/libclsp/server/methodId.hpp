@@ -0,0 +1,47 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// A number for each method name, so a method can be kept and compared
+/// without copying its string.
+///
+/// The methods of the LSP have fixed ids, found with a perfect hash made at
+/// compile time. Other methods get theirs the first time they are interned.
+using MethodId = uint32_t;
+
+/// The MethodId of a method name.
+/// A name gets its id the first time, and keeps it while the program runs.
+MethodId internMethod(string_view method);
+
+/// The MethodId of a method of the LSP, or nullopt if the name isn't one.
+/// It's a hash probe without locks.
+optional<MethodId> knownMethod(string_view method);
+
+/// The name of a MethodId.
+/// The name lives while the program runs.
+string_view methodName(MethodId method);
+
+}
@@ -0,0 +1,196 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <libclsp/server/typedCapability.hpp>
+#include <libclsp/types.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The methods of the LSP with the types of their params and results.
+///
+/// Capability has the same methods without types, made from these.
+struct Methods
+{
+	const static TypedCapability<CancelParams, void> cancelRequest;
+
+	const static TypedCapability<ProgressParams, void> progress;
+
+	const static TypedCapability<InitializeParams, InitializeResult> initialize;
+
+	const static TypedCapability<InitializedParams, void> initialized;
+
+	const static TypedCapability<void, Null> shutdown;
+
+	const static TypedCapability<void, void> exit;
+
+	const static TypedCapability<ShowMessageParams, void> windowShowMessage;
+
+	const static TypedCapability<ShowMessageRequestParams,
+		variant<MessageActionItem, Null>>
+		windowShowMessageRequest;
+
+	const static TypedCapability<LogMessageParams, void> windowLogMessage;
+
+	const static TypedCapability<WorkDoneProgressCreateParams, Null>
+		windowWorkDoneProgressCreate;
+
+	const static TypedCapability<WorkDoneProgressCancelParams, void>
+		windowWorkDoneProgressCancel;
+
+	const static TypedCapability<Any, void> telemetryEvent;
+
+	const static TypedCapability<RegistrationParams, Null>
+		clientRegisterCapability;
+
+	const static TypedCapability<UnregistrationParams, Null>
+		clientUnregisterCapability;
+
+	const static TypedCapability<void, variant<Vector<WorkspaceFolder>, Null>>
+		workspaceWorkspaceFolders;
+
+	const static TypedCapability<DidChangeWorkspaceFoldersParams, void>
+		workspaceDidChangeWorkspaceFolders;
+
+	const static TypedCapability<DidChangeConfigurationParams, void>
+		workspaceDidChangeConfiguration;
+
+	const static TypedCapability<ConfigurationParams, Array>
+		workspaceConfiguration;
+
+	const static TypedCapability<DidChangeWatchedFilesParams, void>
+		workspaceDidChangeWatchedFiles;
+
+	const static TypedCapability<WorkspaceSymbolParams,
+		variant<Vector<SymbolInformation>, Null>>
+		workspaceSymbol;
+
+	const static TypedCapability<ExecuteCommandParams, variant<Any, Null>>
+		workspaceExecuteCommand;
+
+	const static TypedCapability<ApplyWorkspaceEditParams,
+		ApplyWorkspaceEditResponse>
+		workspaceApplyEdit;
+
+	const static TypedCapability<DidOpenTextDocumentParams, void>
+		textDocumentDidOpen;
+
+	const static TypedCapability<DidChangeTextDocumentParams, void>
+		textDocumentDidChange;
+
+	const static TypedCapability<WillSaveTextDocumentParams, void>
+		textDocumentWillSave;
+
+	const static TypedCapability<WillSaveTextDocumentParams,
+		variant<Vector<TextEdit>, Null>>
+		textDocumentWillSaveWaitUntil;
+
+	const static TypedCapability<DidSaveTextDocumentParams, void>
+		textDocumentDidSave;
+
+	const static TypedCapability<DidCloseTextDocumentParams, void>
+		textDocumentDidClose;
+
+	const static TypedCapability<PublishDiagnosticsParams, void>
+		textDocumentPublishDiagnostics;
+
+	const static TypedCapability<CompletionParams,
+		variant<Vector<CompletionItem>, CompletionList, Null>>
+		textDocumentCompletion;
+
+	const static TypedCapability<CompletionItem, CompletionItem>
+		completionItemResolve;
+
+	const static TypedCapability<HoverParams, variant<Hover, Null>>
+		textDocumentHover;
+
+	const static TypedCapability<SignatureHelpParams,
+		variant<SignatureHelp, Null>>
+		textDocumentSignatureHelp;
+
+	const static TypedCapability<DeclarationParams,
+		variant<Location, Vector<Location>, Vector<LocationLink>, Null>>
+		textDocumentDeclaration;
+
+	const static TypedCapability<DefinitionParams,
+		variant<Location, Vector<Location>, Vector<LocationLink>, Null>>
+		textDocumentDefinition;
+
+	const static TypedCapability<TypeDefinitionParams,
+		variant<Location, Vector<Location>, Vector<LocationLink>, Null>>
+		textDocumentTypeDefinition;
+
+	const static TypedCapability<ImplementationParams,
+		variant<Location, Vector<Location>, Vector<LocationLink>, Null>>
+		textDocumentImplementation;
+
+	const static TypedCapability<ReferenceParams,
+		variant<Vector<Location>, Null>>
+		textDocumentReferences;
+
+	const static TypedCapability<DocumentHighlightParams,
+		variant<Vector<DocumentHighlight>, Null>>
+		textDocumentDocumentHighlight;
+
+	const static TypedCapability<DocumentSymbolParams,
+		variant<Vector<DocumentSymbol>, Vector<SymbolInformation>, Null>>
+		textDocumentDocumentSymbol;
+
+	const static TypedCapability<CodeActionParams,
+		variant<Vector<variant<Command, CodeAction>>, Null>>
+		textDocumentCodeAction;
+
+	const static TypedCapability<CodeLensParams,
+		variant<Vector<CodeLens>, Null>>
+		textDocumentCodeLens;
+
+	const static TypedCapability<CodeLens, CodeLens> codeLensResolve;
+
+	const static TypedCapability<DocumentLinkParams,
+		variant<Vector<DocumentLink>, Null>>
+		textDocumentDocumentLink;
+
+	const static TypedCapability<DocumentLink, DocumentLink>
+		documentLinkResolve;
+
+	const static TypedCapability<DocumentColorParams, Vector<ColorInformation>>
+		textDocumentDocumentColor;
+
+	const static TypedCapability<ColorPresentationParams,
+		Vector<ColorPresentation>>
+		textDocumentColorPresentation;
+
+	const static TypedCapability<DocumentFormattingParams,
+		variant<Vector<TextEdit>, Null>>
+		textDocumentFormatting;
+
+	const static TypedCapability<DocumentRangeFormattingParams,
+		variant<Vector<TextEdit>, Null>>
+		textDocumentRangeFormatting;
+
+	const static TypedCapability<DocumentOnTypeFormattingParams,
+		variant<Vector<TextEdit>, Null>>
+		textDocumentOnTypeFormatting;
+
+	const static TypedCapability<RenameParams, variant<WorkspaceEdit, Null>>
+		textDocumentRename;
+};
+
+}
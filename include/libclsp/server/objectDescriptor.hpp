@@ -0,0 +1,355 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <libclsp/server/jsonHandler.hpp>
+#include <libclsp/types/jsonTypes.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// Static functions to initialize a json member.
+///
+/// The first argument of every function is the object that owns the member,
+/// as a pointer to its own type (see ObjectInitializer::bind()).
+/// A nullptr means that the member can't have that json type.
+struct FieldSetter
+{
+	/// Sets a String in an object.
+	/// The string is a temporary that can be moved into the member.
+	void (*setString)(void* object, JsonHandler& handler, String&& str);
+
+	/// Sets a Number in an object
+	void (*setNumber)(void* object, JsonHandler& handler, Number n);
+
+	/// Sets a Boolean in an object
+	void (*setBoolean)(void* object, JsonHandler& handler, Boolean b);
+
+	/// Sets Null in an object
+	void (*setNull)(void* object, JsonHandler& handler);
+
+	/// Creates an Array in an object
+	void (*setArray)(void* object, JsonHandler& handler);
+
+	/// Changes to the next object
+	void (*setObject)(void* object, JsonHandler& handler);
+};
+
+/// A json member with a known key
+struct FieldDescriptor
+{
+	/// The key of the member
+	string_view key;
+
+	/// If the member must be initialized
+	bool required;
+
+	/// The functions to initialize the member
+	FieldSetter setter;
+};
+
+struct ObjectDescriptor;
+
+/// A perfect hash table from the keys of a FieldDescriptor array to their
+/// indices, made at compile time.
+struct KeyTable
+{
+	/// The number of slots, it must be a power of 2
+	constexpr static size_t slotCount = 64;
+
+	/// The seed that makes the hash perfect for the keys
+	uint32_t seed;
+
+	/// The index of the member in each slot plus one.
+	/// 0 is an empty slot.
+	uint8_t slots[slotCount];
+
+	/// FNV-1a of the key
+	constexpr static uint32_t hash(string_view key, uint32_t seed)
+	{
+		uint32_t h = 2166136261u ^ seed;
+
+		for(char c: key)
+		{
+			h ^= (unsigned char)c;
+			h *= 16777619u;
+		}
+
+		return h ^ (h >> 16);
+	}
+
+	/// The slot of a key
+	constexpr static size_t slotOf(string_view key, uint32_t seed)
+	{
+		return hash(key, seed) & (slotCount - 1);
+	}
+
+	/// Searches a seed without collisions between the keys.
+	/// More than slotCount - 1 keys or too many seeds stop the constant
+	/// evaluation.
+	template<size_t N>
+	constexpr static KeyTable make(const FieldDescriptor (&fields)[N])
+	{
+		static_assert(N < slotCount, "Too many members in one object");
+
+		for(uint32_t seed = 0;; seed++)
+		{
+			KeyTable table = {seed, {}};
+
+			bool collision = false;
+
+			for(size_t i = 0; i < N && !collision; i++)
+			{
+				auto& slot = table.slots[slotOf(fields[i].key, seed)];
+
+				collision = slot != 0;
+
+				slot = i + 1;
+			}
+
+			if(!collision)
+			{
+				return table;
+			}
+		}
+	}
+
+	/// The index of the member with the key or -1 if there isn't one
+	constexpr int find(const FieldDescriptor* fields, string_view key) const
+	{
+		int index = slots[slotOf(key, seed)] - 1;
+
+		if(index >= 0 && fields[index].key == key)
+		{
+			return index;
+		}
+
+		return -1;
+	}
+};
+
+/// A parent type whose members are also members of the child
+struct ParentDescriptor
+{
+	/// The descriptor of the parent
+	const ObjectDescriptor* descriptor;
+
+	/// Converts a pointer to the child into a pointer to the parent
+	void* (*cast)(void* object);
+};
+
+/// A member found in an ObjectDescriptor
+struct DescribedMember
+{
+	/// The member, or nullptr if the key isn't known
+	const FieldDescriptor* field;
+
+	/// The object that owns the member
+	void* object;
+
+	/// The index of the member in the object and its parents.
+	/// The members of the object come first and then the members of each
+	/// parent, in order.
+	size_t index;
+};
+
+/// The static description of the json members of an ObjectT.
+///
+/// Every type has only one immutable descriptor, so parsing an object
+/// doesn't need to build its setters every time.
+struct ObjectDescriptor
+{
+	/// The maximum number of direct parents
+	constexpr static size_t maxParents = 3;
+
+	/// The maximum number of members, counting the members of the parents.
+	/// A required member must have an index lower than this, neededMask()
+	/// asserts it when it composes the parents.
+	constexpr static size_t maxMembers = 64;
+
+	/// The members with a known key
+	const FieldDescriptor* fields;
+
+	/// The number of members with a known key
+	size_t fieldCount;
+
+	/// The indices of the members with a known key
+	KeyTable keyTable;
+
+	/// A bit for each required member with a known key
+	uint64_t requiredMask;
+
+	/// A setter for the members without a known key, like the elements of an
+	/// array or the members of an object with index signatures.
+	FieldSetter extraSetter;
+
+	/// The parents of the object.
+	/// Unused parents have a nullptr descriptor.
+	ParentDescriptor parents[maxParents];
+
+	/// The number of members of the object and its parents plus one, or 0
+	/// until memberCount() counts them.
+	/// The parents can be in other files, so they aren't counted at compile
+	/// time.
+	mutable atomic<size_t> cachedCount{0};
+
+	/// The mask of neededMask(), valid once maskCached is set.
+	/// Every parsed object needs it, so the parents are composed only once.
+	mutable atomic<uint64_t> cachedMask{0};
+
+	/// If cachedMask has the mask
+	mutable atomic<bool> maskCached{false};
+
+	/// A descriptor with known members
+	template<size_t N>
+	constexpr ObjectDescriptor(const FieldDescriptor (&fields)[N],
+		FieldSetter extraSetter,
+		const ParentDescriptor (&parents)[maxParents]):
+			fields(fields),
+			fieldCount(N),
+			keyTable(KeyTable::make(fields)),
+			requiredMask(requiredMaskOf(fields)),
+			extraSetter(extraSetter),
+			parents{parents[0], parents[1], parents[2]}
+	{};
+
+	/// A descriptor without known members
+	constexpr ObjectDescriptor(nullptr_t,
+		FieldSetter extraSetter,
+		const ParentDescriptor (&parents)[maxParents]):
+			fields(nullptr),
+			fieldCount(0),
+			keyTable(),
+			requiredMask(0),
+			extraSetter(extraSetter),
+			parents{parents[0], parents[1], parents[2]}
+	{};
+
+	/// Searches the member with the given key in this object and its
+	/// parents.
+	DescribedMember find(string_view key, void* object) const;
+
+	/// The number of members of the object and its parents
+	size_t memberCount() const;
+
+	/// A bit for each required member of the object and its parents, by
+	/// index.
+	uint64_t neededMask() const;
+
+	/// The keys of the members whose bits are in the mask
+	vector<string_view> keys(uint64_t mask) const;
+
+private:
+	DescribedMember find(string_view key, void* object, size_t offset) const;
+
+	void keys(uint64_t mask, size_t offset, vector<string_view>& out) const;
+
+	template<size_t N>
+	constexpr static uint64_t requiredMaskOf(const FieldDescriptor (&fields)[N])
+	{
+		uint64_t mask = 0;
+
+		for(size_t i = 0; i < N; i++)
+		{
+			if(fields[i].required)
+			{
+				mask |= uint64_t(1) << i;
+			}
+		}
+
+		return mask;
+	}
+};
+
+/// The cast of ParentDescriptor
+template<class Child, class Parent>
+void* upcast(void* object)
+{
+	return static_cast<Parent*>(static_cast<Child*>(object));
+}
+
+/// Types of a pointer to member
+template<class Member>
+struct MemberTraits;
+
+template<class Object, class Member>
+struct MemberTraits<Member Object::*>
+{
+	using ObjectType = Object;
+	using MemberType = Member;
+};
+
+template<class T>
+struct IsOptional: false_type {};
+
+template<class T>
+struct IsOptional<optional<T>>: true_type {};
+
+/// Setters for members that are set as they come from the json.
+/// The member can also be an optional<>.
+template<auto member>
+struct MemberSetter
+{
+	using ObjectType = typename MemberTraits<decltype(member)>::ObjectType;
+	using MemberType = typename MemberTraits<decltype(member)>::MemberType;
+
+	static void fromString(void* object, JsonHandler&, String&& str)
+	{
+		static_cast<ObjectType*>(object)->*member = move(str);
+	}
+
+	static void fromNumber(void* object, JsonHandler&, Number n)
+	{
+		static_cast<ObjectType*>(object)->*member = n;
+	}
+
+	static void fromBoolean(void* object, JsonHandler&, Boolean b)
+	{
+		static_cast<ObjectType*>(object)->*member = b;
+	}
+
+	static void fromNull(void* object, JsonHandler&)
+	{
+		static_cast<ObjectType*>(object)->*member = Null();
+	}
+
+	/// The member must be an ObjectT
+	static void fromObject(void* object, JsonHandler& handler)
+	{
+		auto& value = static_cast<ObjectType*>(object)->*member;
+
+		if constexpr(IsOptional<MemberType>::value)
+		{
+			handler.pushObject(value.emplace());
+		}
+		else
+		{
+			handler.pushObject(value);
+		}
+	}
+};
+
+}
@@ -0,0 +1,203 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <libclsp/server/capability.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The messages of a connection that wait for its writer.
+///
+/// There is a lane for each Priority, and the writer only takes from a lane
+/// when the ones before it are empty, so the response of a completion
+/// doesn't wait behind a flood of diagnostics. A message can have a key: a
+/// newer message with the same key replaces the queued one in its place,
+/// like the diagnostics of a document or the progress reports of a token.
+///
+/// It counts the bytes of the queued messages, so the producers can wait
+/// while the client doesn't read.
+template<class T>
+class Outbox
+{
+private:
+	/// The number of lanes
+	constexpr static size_t laneCount = 3;
+
+	/// A queued message
+	struct Pending
+	{
+		T message;
+
+		/// The key, empty if it isn't replaced
+		string key;
+
+		/// Its size in bytes
+		size_t bytes;
+	};
+
+	/// A mutex for the lanes
+	mutex queueMutex;
+
+	/// Where the writer sleeps
+	condition_variable ready;
+
+	/// Where the producers sleep
+	condition_variable drained;
+
+	/// The messages, by priority
+	deque<Pending> lanes[laneCount];
+
+	/// The queued messages with a key.
+	/// Pushing and popping at the ends of a deque keeps the pointers.
+	unordered_map<string, Pending*> keyed;
+
+	/// The bytes of the queued messages
+	atomic<size_t> bytes{0};
+
+	/// If the producers don't push anymore
+	bool closed = false;
+
+public:
+	Outbox(){};
+
+	Outbox(const Outbox&) = delete;
+	Outbox& operator=(const Outbox&) = delete;
+
+	/// Queues a message in a lane, or replaces the queued one with the same
+	/// key
+	void push(T message, Priority lane, size_t size, string key = {})
+	{
+		lock_guard<mutex> lock(queueMutex);
+
+		if(!key.empty())
+		{
+			auto queued = keyed.find(key);
+
+			if(queued != keyed.end())
+			{
+				Pending& pending = *queued->second;
+
+				bytes += size;
+				bytes -= pending.bytes;
+
+				pending.message = move(message);
+				pending.bytes   = size;
+				return;
+			}
+		}
+
+		Pending& pending = lanes[(size_t)lane].emplace_back(
+			Pending{move(message), move(key), size});
+
+		if(!pending.key.empty())
+		{
+			keyed[pending.key] = &pending;
+		}
+
+		bytes += size;
+
+		ready.notify_one();
+	}
+
+	/// Takes the next message, waiting while there isn't one.
+	/// false if the outbox is empty and closed.
+	bool pop(T& message)
+	{
+		unique_lock<mutex> lock(queueMutex);
+
+		while(true)
+		{
+			for(auto& lane: lanes)
+			{
+				if(lane.empty())
+				{
+					continue;
+				}
+
+				Pending& pending = lane.front();
+
+				if(!pending.key.empty())
+				{
+					keyed.erase(pending.key);
+				}
+
+				message = move(pending.message);
+				bytes  -= pending.bytes;
+
+				lane.pop_front();
+
+				drained.notify_all();
+
+				return true;
+			}
+
+			if(closed)
+			{
+				return false;
+			}
+
+			ready.wait(lock);
+		}
+	}
+
+	/// Waits while the queued messages have more than a number of bytes.
+	/// 0 doesn't wait.
+	void throttle(size_t limit)
+	{
+		if(limit == 0 || bytes <= limit)
+		{
+			return;
+		}
+
+		unique_lock<mutex> lock(queueMutex);
+
+		drained.wait(lock, [this, limit]()
+		{
+			return closed || bytes <= limit;
+		});
+	}
+
+	/// The bytes of the queued messages
+	size_t pendingBytes() const
+	{
+		return bytes;
+	}
+
+	/// Stops the producers, the writer takes the messages that are left
+	void close()
+	{
+		lock_guard<mutex> lock(queueMutex);
+
+		closed = true;
+
+		ready.notify_all();
+		drained.notify_all();
+	}
+};
+
+}
@@ -0,0 +1,112 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+#include <libclsp/server/capability.hpp>
+#include <libclsp/server/threadPool.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// Runs the requests in a pool by the priority of their capability.
+///
+/// Every priority has its own queue. A request is queued and a slot is
+/// submitted to the pool, and the slot runs the most urgent request when a
+/// worker takes it, so an interactive request overtakes the ones queued
+/// before it. A request that waits an aging interval goes up to the
+/// priority above its own, and then it goes before the requests that
+/// waited less, so the background ones aren't starved. Nothing goes before
+/// an interactive request.
+///
+/// Background requests can't use the reserved workers, so a completion
+/// doesn't wait for a worker that runs a long workspace/symbol. If every
+/// worker is reserved, one background request runs while no interactive
+/// one waits.
+class PriorityScheduler
+{
+private:
+	using Clock = chrono::steady_clock;
+
+	/// The number of priorities
+	constexpr static size_t priorityCount = 3;
+
+	/// A queued request
+	struct Task
+	{
+		/// The handler
+		function<void()> run;
+
+		/// When it was queued
+		Clock::time_point queued;
+	};
+
+	/// The pool that runs the requests
+	ThreadPool& pool;
+
+	/// The time that a request waits to go up one priority.
+	/// 0 disables the aging.
+	Clock::duration aging;
+
+	/// The number of background requests that can run at the same time.
+	/// 0 if every worker is reserved.
+	size_t backgroundLimit;
+
+	/// A mutex for the queues
+	mutex queueMutex;
+
+	/// The queues, by priority
+	deque<Task> queues[priorityCount];
+
+	/// The number of background requests that run
+	size_t runningBackground = 0;
+
+	/// Takes the most urgent request that can run now.
+	/// false if there isn't one.
+	bool take(Task& task, Priority& priority);
+
+	/// A slot, runs the next request
+	void runNext();
+
+public:
+	/// A scheduler of a pool that leaves some workers to the requests that
+	/// aren't in the background
+	PriorityScheduler(ThreadPool& pool,
+		Clock::duration aging,
+		size_t reservedWorkers);
+
+	PriorityScheduler(const PriorityScheduler&) = delete;
+	PriorityScheduler& operator=(const PriorityScheduler&) = delete;
+
+	virtual ~PriorityScheduler();
+
+	/// Queues a request with a priority.
+	/// The task must not throw.
+	void submit(function<void()> task, Priority priority);
+
+	/// The requests of a priority that wait for a worker
+	size_t queued(Priority priority);
+};
+
+}
@@ -0,0 +1,163 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <libclsp/server/cancellationToken.hpp>
+#include <libclsp/server/methodId.hpp>
+#include <libclsp/types/jsonTypes.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The requests that wait a response, by id.
+///
+/// The ids are split in shards with their own lock, so the handlers of many
+/// workers rarely wait for each other. Integer ids, the usual ones, are kept
+/// in open addressed slots that don't allocate; strings and other numbers in
+/// maps.
+///
+/// The ids made by issue() go first to slots of their own, found by the low
+/// bits of the id and tagged with the whole id, that are taken and released
+/// without locks. A stale or unknown id never matches the tag.
+class RequestTable
+{
+public:
+	/// A request that waits a response
+	struct Entry
+	{
+		/// The method of the request
+		MethodId method = 0;
+
+		/// The token of a request from the client
+		optional<CancellationToken> token;
+	};
+
+private:
+	/// An integer id in a shard
+	struct IntegerSlot
+	{
+		/// If the slot has an id
+		bool used = false;
+
+		/// The id
+		int id = 0;
+
+		/// The request
+		Entry entry;
+	};
+
+	/// A part of the ids with its own lock
+	struct alignas(64) Shard
+	{
+		mutex lock;
+
+		/// Open addressed with linear probing, the size is a power of 2
+		vector<IntegerSlot> integers;
+
+		/// The used slots of integers
+		size_t integerCount = 0;
+
+		/// The string ids
+		map<string, Entry, less<>> strings;
+
+		/// The numbers that aren't integers
+		map<double, Entry> numbers;
+	};
+
+	/// A slot of the ids made by issue()
+	struct IssuedSlot
+	{
+		/// The id in the slot, freeTag or busyTag
+		atomic<int> tag{0};
+
+		/// The request, only used by the thread that made the tag busy
+		Entry entry;
+	};
+
+	/// The tag of an empty IssuedSlot
+	constexpr static int freeTag = 0;
+
+	/// The tag of an IssuedSlot that a thread is using
+	constexpr static int busyTag = -1;
+
+	/// The number of shards, it must be a power of 2
+	constexpr static size_t shardCount = 16;
+
+	/// The number of IssuedSlots, it must be a power of 2
+	constexpr static size_t issuedCount = 256;
+
+	Shard shards[shardCount];
+
+	IssuedSlot issued[issuedCount];
+
+	/// The last id made by issue()
+	atomic<unsigned> lastId{0};
+
+	/// A hash of an integer id
+	static size_t hashOf(int id);
+
+	/// The shard of an id
+	Shard& shardOf(const variant<Number, String>& id);
+
+	/// The IssuedSlot that has an id, busy, or nullptr if there isn't one
+	IssuedSlot* takeIssued(int id);
+
+	/// The slot of an integer id in a shard, or nullptr if it isn't there
+	static IntegerSlot* findInteger(Shard& shard, int id);
+
+	/// Adds an integer id to a shard, or replaces it
+	static void insertInteger(Shard& shard, int id, Entry entry);
+
+	/// Removes a used slot and moves the next ones back
+	static void eraseInteger(Shard& shard, IntegerSlot& slot);
+
+public:
+	/// Adds a request, or replaces the one with the same id
+	void insert(const variant<Number, String>& id, Entry entry);
+
+	/// Removes a request and returns it
+	optional<Entry> erase(const variant<Number, String>& id);
+
+	/// A copy of a request
+	optional<Entry> find(const variant<Number, String>& id);
+
+	/// If there is a request with the id
+	bool contains(const variant<Number, String>& id);
+
+	/// Adds a request with a new positive integer id, made by an atomic
+	/// counter, and returns the id.
+	int issue(MethodId method);
+
+	RequestTable();
+
+	RequestTable(const RequestTable&) = delete;
+	RequestTable& operator=(const RequestTable&) = delete;
+
+	virtual ~RequestTable();
+};
+
+}
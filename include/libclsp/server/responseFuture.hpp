@@ -0,0 +1,94 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <any>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include <libclsp/server/capability.hpp>
+#include <libclsp/server/timerWheel.hpp>
+#include <libclsp/types/responseMessage.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The response to a request that the server sent to the client
+struct ClientResponse
+{
+	/// The result, read by the capability of the request.
+	/// nullopt if there is an error or the capability doesn't read it.
+	optional<any> result;
+
+	/// The error of the client.
+	/// ErrorCodes::RequestCancelled if the client didn't answer in time or
+	/// the connection ended.
+	optional<ResponseError> error;
+};
+
+/// A response that the client didn't send yet, see Server::sendRequest().
+///
+/// The dispatcher of the connection resolves it when the response is read.
+/// A continuation given to then() runs in the pool after that, so a handler
+/// returns instead of keeping a worker while the editor answers.
+class ResponseFuture
+{
+public:
+	/// What the future shares with its connection
+	struct State
+	{
+		/// A mutex for the response and the continuation
+		mutex stateMutex;
+
+		/// The response, once it's resolved
+		optional<ClientResponse> response;
+
+		/// The continuation, if then() was called before the response
+		function<void(ClientResponse&)> continuation;
+
+		/// Reads the result, from the capability of the request
+		optional<Capability::JsonIO> result;
+
+		/// The timeout of the request, if any
+		shared_ptr<TimerWheel::Timer> timeout;
+	};
+
+private:
+	shared_ptr<State> state;
+
+public:
+	ResponseFuture(shared_ptr<State> state);
+
+	virtual ~ResponseFuture();
+
+	/// Runs a function with the response.
+	///
+	/// It runs in the pool when the response is resolved, with the
+	/// connection of the request as Connection::current(), or right away in
+	/// the calling thread if it already was. Only the last continuation
+	/// given runs.
+	void then(function<void(ClientResponse&)> continuation);
+
+	/// If the response was resolved
+	bool isReady() const;
+};
+
+}
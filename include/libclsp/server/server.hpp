@@ -16,17 +16,43 @@
 
 #pragma once
 
-#include <map>
-#include <shared_mutex>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <libclsp/server/jsonHandler.hpp>
+#include <libclsp/server/cancellationToken.hpp>
 #include <libclsp/server/capability.hpp>
+#include <libclsp/server/ioBackend.hpp>
+#include <libclsp/server/messageEnvelope.hpp>
+#include <libclsp/server/priorityScheduler.hpp>
+#include <libclsp/server/statistics.hpp>
+#include <libclsp/server/threadPool.hpp>
+#include <libclsp/server/timerWheel.hpp>
+#include <libclsp/server/tracer.hpp>
+#include <libclsp/server/transport.hpp>
 
 namespace clsp
 {
 
 using namespace std;
 
+enum class ErrorCodes;
+
+struct ResponseMessage;
+
+class Connection;
+
+class ResponseFuture;
+
 enum class RequestKind
 {
 	/// The request waits a response from the client.
@@ -39,49 +65,284 @@ enum class RequestKind
 class Server
 {
 private:
-	/// A map with the capabilities that the server supports.
-	map<String, Capability> capabiliyMap;
+	/// An immutable table that routes the methods to their capabilities
+	struct DispatchTable
+	{
+		/// The capabilities by MethodId, nullptr if there isn't one
+		vector<const Capability*> byId;
+
+		/// The capabilities of the methods that aren't of the LSP, by name
+		unordered_map<string_view, const Capability*> byName;
+	};
+
+	/// The capabilities that the server supports.
+	/// They are never removed, so a reference to one stays valid.
+	deque<Capability> capabilities;
+
+	/// The tables that were published, the last one is the current one.
+	/// The old ones live with the server, a lookup could still use them.
+	vector<unique_ptr<DispatchTable>> dispatchTables;
+
+	/// The current table.
+	/// addCapability() publishes a new one, so lookups don't lock.
+	atomic<const DispatchTable*> dispatchTable{nullptr};
+
+	/// A mutex for adding capabilities
+	mutex capabilityMutex;
+
+
+	/// The workers of the handlers, only while serve() runs
+	unique_ptr<ThreadPool> pool;
+
+	/// Orders the requests in the pool by priority, only while serve() runs
+	unique_ptr<PriorityScheduler> scheduler;
 
-	/// A mutex for the capability map.
-	mutable shared_mutex capabilityMutex;
+	/// The timeouts of the requests to the clients, only while serve() runs.
+	/// The event loop advances it.
+	unique_ptr<TimerWheel> timers;
 
+	/// The transports of the next serve()
+	vector<unique_ptr<Transport>> transports;
 
-	/// A map with the requests send to the client.
-	/// The key is the id and the value is the method.
-	map<variant<Number, String>, String> requestSentMap;
+	/// The connections of the clients.
+	/// Only the event loop adds or removes them.
+	list<unique_ptr<Connection>> connections;
 
-	/// A mutex for the requestSent map.
-	mutable shared_mutex requestSentMutex;
+	/// A mutex for the connections, for the threads that aren't the event
+	/// loop
+	mutex connectionsMutex;
 
+	/// An eventfd that wakes the event loop
+	int wakeFd = -1;
 
-	/// A map with the requests recieved from the client.
-	/// The key is the id and the value is the method.
-	map<variant<Number, String>, String> requestRecievedMap;
+	/// The counters and latencies of the messages
+	Statistics statistics;
 
-	/// A mutex for the requestSent map.
-	mutable shared_mutex requestRecievedMutex;
+	/// The timeline of the messages, see startTrace()
+	Tracer tracer;
 
+	/// If stop() was called
+	atomic<bool> stopping{false};
+
+	/// Wakes the event loop, so it checks the connections again
+	void wake();
+
+	/// Runs a function with the connection of the calling thread, or with
+	/// the only connection if the thread doesn't have one.
+	/// false if there isn't a connection.
+	bool withConnection(const function<void(Connection&)>& function);
+
+	friend class Connection;
 
-	/// The last id used for a request sent to the client
-	int lastId = 0;
 public:
+	/// The number of decoder threads of each connection.
+	/// With 1, or on one core, the dispatcher decodes the messages itself.
+	size_t decoderCount = 2;
+
+	/// The number of workers that run the handlers of all the connections.
+	/// 0 is one per core.
+	size_t workerCount = 0;
+
+	/// The capacity of the queues between the threads of a connection
+	size_t queueCapacity = 1024;
+
+	/// The time that a queued request waits to go up one priority, so the
+	/// background requests run even while other ones keep coming.
+	/// Nothing goes before an interactive request.
+	chrono::milliseconds priorityAging{50};
+
+	/// The workers that background requests leave to the others.
+	/// If they are all the workers, background requests run one at a time
+	/// while no interactive request waits.
+	size_t reservedWorkers = 1;
+
+	/// The bytes of queued messages that make send() wait for the writer of
+	/// a connection. 0 doesn't wait.
+	size_t outboxLimit = 16 << 20;
+
+	/// The time that sendRequest() waits for the client by default.
+	/// 0 waits forever.
+	chrono::milliseconds requestTimeout{30000};
+
+	/// If the connections record the latencies of their messages and count
+	/// them, see getStatistics()
+	bool collectStatistics = true;
+
+	/// If every handler runs in a MemoryScope of its own arena.
+	///
+	/// The json types of its result are made in the arena, and it's freed at
+	/// once after the writer serializes the response, or after the handler
+	/// if it doesn't have one. A deferred response keeps it until it's
+	/// given. Only the thread of the handler allocates in it.
+	///
+	/// A value that the handler keeps after its response, like a document
+	/// in its state, must be copied inside a MemoryScope of another
+	/// resource. Only used if libclsp is built with LIBCLSP_PMR.
+	bool requestArenas = false;
+
+	/// How the connections read and write, see IoBackend.
+	/// It falls back to IoBackend::standard if it can't be used.
+	IoBackend ioBackend = IoBackend::standard;
+
+	/// If the didChange notifications of a document that are queued one
+	/// after another are merged into one before their handler runs.
+	///
+	/// The content changes keep their order, and a change with the full text
+	/// drops the ones before it. A message between them, like a request,
+	/// stops the merge, so it still sees the document as it was sent.
+	bool coalesceChanges = false;
+
 	/// This starts the server and seeks for the Initialize request.
+	/// The messages are read from stdin and written to stdout.
+	///
+	/// The messages go through a pipeline of threads: an event loop that
+	/// splits the input, decoders that parse the messages, a dispatcher that
+	/// routes them in the order of the input, a pool of workers that run the
+	/// handlers and a writer that serializes the responses.
+	///
+	/// Handlers run in parallel in the pool, the ones with a higher
+	/// Priority first. A handler waits for the ones before it that use its
+	/// document and conflict with it (see Access), so a didChange is never
+	/// reordered with the requests on its document. Initialize, shutdown and
+	/// exit wait for everything before them and run alone in the
+	/// dispatcher.
 	void startIO();
 
+	/// Like startIO() but with other file descriptors.
+	/// It returns when the input ends or after the exit notification.
+	void startIO(int input, int output);
+
+	/// Adds a transport for the next serve()
+	void addTransport(unique_ptr<Transport> transport);
+
+	/// Serves the clients of the transports with an epoll event loop.
+	///
+	/// Each connection is a client with its own pipeline (see Connection),
+	/// and the handlers of all of them share one pool. The exit notification
+	/// ends only its connection.
+	///
+	/// It returns after stop(), or when every transport stopped listening
+	/// and all the connections ended. The transports are closed and removed
+	/// then.
+	void serve();
+
+	/// Stops serve().
+	/// The connections stop reading and end after the messages that were
+	/// read. It can be called by any thread, also before serve() starts.
+	void stop();
+
+	/// Writes a message to the client.
+	/// It can be called by any handler, the message goes to the connection
+	/// of its request. Other threads can only call it while there is only
+	/// one connection.
+	/// Does nothing if there isn't a connection.
+	///
+	/// Diagnostics and progress notifications are written after the
+	/// responses, and only the last queued diagnostics of a document and
+	/// report of a progress token are written (see Outbox).
+	void send(ObjectT& message);
+
+	/// The bytes of the messages that wait to be written to the client,
+	/// like send().
+	/// A handler can use it to send less while the client is slow.
+	size_t pendingBytes();
+
+	/// Sends a request to the client, like workspace/configuration or
+	/// workspace/applyEdit, and returns its response that comes later.
+	///
+	/// The params are written and the result is read by the capability,
+	/// like Capability::workspaceConfiguration. A handler gives the rest of
+	/// its work to ResponseFuture::then() and returns, it doesn't wait in a
+	/// worker for the editor.
+	///
+	/// If the client doesn't answer before the timeout, the request is
+	/// cancelled in the client and resolved with
+	/// ErrorCodes::RequestCancelled. It's resolved with the same error if
+	/// there isn't a connection, like send().
+	ResponseFuture sendRequest(const Capability& capability,
+		optional<any> params);
+
+	/// Like sendRequest() but with another timeout
+	ResponseFuture sendRequest(const Capability& capability,
+		optional<any> params,
+		chrono::milliseconds timeout);
+
+	/// Runs a task in the pool with the priority of a request.
+	/// false if the server isn't serving.
+	///
+	/// The task doesn't belong to a connection, a handler that gives its
+	/// work to it defers its response (see DeferredResponse) and runs it
+	/// with its HandlerContext.
+	bool submit(function<void()> task, Priority priority = Priority::normal);
+
+	/// Like submit() but after a delay.
+	/// The timers of sendRequest() run it, without a thread that sleeps.
+	bool submitAfter(chrono::milliseconds delay,
+		function<void()> task,
+		Priority priority = Priority::normal);
+
+	/// The counters and latencies of the messages of all the connections,
+	/// with the queues as they are now
+	StatisticsSnapshot getStatistics();
+
+	/// Adds a request that answers getStatistics() as json, for the tools
+	/// of the client.
+	/// It doesn't have params, the latencies are in microseconds.
+	void addStatisticsCapability(String method = "$/clsp/stats");
+
+	/// Writes a timeline of the messages to a file, in the trace event json
+	/// of Chrome, until stopTrace().
+	///
+	/// It has a span for every stage of a message, with its id, method and
+	/// document: the read of the frames, the parse of the envelope, the
+	/// decode of the params, the queue, the handler, the serialization of
+	/// the response and its write. Perfetto and chrome://tracing open it.
+	/// false if the file can't be opened or a trace is running.
+	bool startTrace(const string& path);
+
+	/// Stops the trace and finishes its file
+	void stopTrace();
+
+	/// The pool of the handlers, to fork their work.
+	/// nullptr if the server isn't started.
+	ThreadPool* getPool();
+
 	/// This function adds a new capability to the server, but doesn't
 	/// send the client/registerCapability request.
 	void addCapability(Capability capability);
 
+	/// Adds a capability with another priority
+	void addCapability(Capability capability, Priority priority);
+
 	/// Returns the capability of the method given. If no capability is found
-	/// the optional<> is set to nullopt.
-	optional<Capability> getCapability(String method);
+	/// it returns nullptr.
+	///
+	/// It doesn't lock or copy, and the capability lives with the server.
+	const Capability* getCapability(string_view method) const;
+
+	/// Like getCapability() but with the interned id of the method
+	const Capability* getCapability(MethodId method) const;
 
 
-	/// Adds a request to one of the two request maps.
+	/// Adds a request to one of the two request tables of a connection.
+	/// Like send(), these use the connection of the handler.
 	void addRequest(variant<Number, String> id, String method, RequestKind kind);
 
-	/// Completes a request and returns the method name.
-	String completeRequest(variant<Number, String> id, RequestKind kind);
+	/// Adds a request to the client with a new id and returns the id, or -1
+	/// if there isn't a connection.
+	int addRequest(String method);
+
+	/// Completes a request and returns the method name, or an empty name if
+	/// there isn't a request with the id.
+	string_view completeRequest(variant<Number, String> id, RequestKind kind);
+
+	/// Cancels a request from the client.
+	///
+	/// If it's still queued it's dropped, a running handler can see it with
+	/// CancellationToken::current(). The request is answered with
+	/// ErrorCodes::RequestCancelled.
+	/// $/cancelRequest calls this before its handler, if any.
+	void cancelRequest(variant<Number, String> id);
 
 	Server();
 	virtual ~Server();
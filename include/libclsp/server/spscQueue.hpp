@@ -0,0 +1,216 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// A bounded queue between one producer thread and one consumer thread.
+///
+/// Pushing and popping are lock-free. A thread only sleeps when the queue is
+/// full or empty for a while, and the mutex of the sleep is only taken when
+/// there is a sleeping thread.
+template<class T>
+class SpscQueue
+{
+private:
+	/// The size of a cache line, to keep the ends of the queue apart
+	constexpr static size_t cacheLine = 64;
+
+	/// The number of tries before sleeping
+	constexpr static unsigned spinCount = 64;
+
+	/// The position of the next pop, only written by the consumer
+	alignas(cacheLine) atomic<size_t> head{0};
+
+	/// The position of the next push, only written by the producer
+	alignas(cacheLine) atomic<size_t> tail{0};
+
+	/// If the producer doesn't push anymore
+	alignas(cacheLine) atomic<bool> closed{false};
+
+	/// The number of sleeping threads
+	atomic<unsigned> sleepers{0};
+
+	/// The elements, the capacity is a power of 2
+	unique_ptr<T[]> slots;
+
+	/// The capacity minus one
+	size_t mask;
+
+	/// A mutex for the sleeps
+	mutex sleepMutex;
+
+	/// Where the threads sleep
+	condition_variable sleep;
+
+	/// Wakes the other thread if it's sleeping
+	void wake()
+	{
+		atomic_thread_fence(memory_order_seq_cst);
+
+		if(sleepers.load(memory_order_relaxed) > 0)
+		{
+			lock_guard<mutex> lock(sleepMutex);
+
+			sleep.notify_all();
+		}
+	}
+
+	/// Sleeps until the condition is true
+	template<class Condition>
+	void waitFor(Condition condition)
+	{
+		for(unsigned i = 0; i < spinCount; i++)
+		{
+			if(condition())
+			{
+				return;
+			}
+
+			this_thread::yield();
+		}
+
+		unique_lock<mutex> lock(sleepMutex);
+
+		sleepers.fetch_add(1);
+		atomic_thread_fence(memory_order_seq_cst);
+
+		sleep.wait(lock, condition);
+
+		sleepers.fetch_sub(1);
+	}
+
+public:
+	/// The capacity is rounded up to a power of 2
+	SpscQueue(size_t capacity)
+	{
+		size_t size = 1;
+
+		while(size < capacity)
+		{
+			size <<= 1;
+		}
+
+		slots.reset(new T[size]);
+		mask = size - 1;
+	}
+
+	SpscQueue(const SpscQueue&) = delete;
+	SpscQueue& operator=(const SpscQueue&) = delete;
+
+	/// Pushes an element if the queue isn't full
+	bool tryPush(T& value)
+	{
+		size_t t = tail.load(memory_order_relaxed);
+
+		if(t - head.load(memory_order_acquire) > mask)
+		{
+			return false;
+		}
+
+		slots[t & mask] = move(value);
+		tail.store(t + 1, memory_order_release);
+
+		wake();
+
+		return true;
+	}
+
+	/// Pops an element if the queue isn't empty
+	bool tryPop(T& value)
+	{
+		size_t h = head.load(memory_order_relaxed);
+
+		if(h == tail.load(memory_order_acquire))
+		{
+			return false;
+		}
+
+		value = move(slots[h & mask]);
+		head.store(h + 1, memory_order_release);
+
+		wake();
+
+		return true;
+	}
+
+	/// Pushes an element, waiting while the queue is full.
+	/// false if the queue was closed.
+	bool push(T value)
+	{
+		while(!tryPush(value))
+		{
+			if(closed.load(memory_order_acquire))
+			{
+				return false;
+			}
+
+			waitFor([this]()
+			{
+				return closed.load(memory_order_acquire) ||
+					tail.load(memory_order_relaxed) -
+						head.load(memory_order_acquire) <= mask;
+			});
+		}
+
+		return true;
+	}
+
+	/// Pops an element, waiting while the queue is empty.
+	/// false if the queue is empty and closed.
+	bool pop(T& value)
+	{
+		while(!tryPop(value))
+		{
+			if(closed.load(memory_order_acquire) &&
+				head.load(memory_order_relaxed) ==
+					tail.load(memory_order_acquire))
+			{
+				return false;
+			}
+
+			waitFor([this]()
+			{
+				return closed.load(memory_order_acquire) ||
+					head.load(memory_order_relaxed) !=
+						tail.load(memory_order_acquire);
+			});
+		}
+
+		return true;
+	}
+
+	/// Stops the queue.
+	/// The elements that are in it can still be popped.
+	void close()
+	{
+		closed.store(true, memory_order_release);
+
+		wake();
+	}
+};
+
+}
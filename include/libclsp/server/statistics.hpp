@@ -0,0 +1,282 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <libclsp/server/jsonWriter.hpp>
+#include <libclsp/server/methodId.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// A part of the way of a message through the server
+enum class Stage
+{
+	/// From the dispatcher to the start of the handler
+	queue,
+
+	/// Parsing the envelope and the params
+	decode,
+
+	/// The handler, with the result of a typed handler
+	handler,
+
+	/// Serializing a response in the writer
+	encode,
+
+	/// Writing a message to the client
+	write
+};
+
+/// The number of stages
+constexpr size_t stageCount = 5;
+
+/// The name of a stage
+string_view stageName(Stage stage);
+
+/// Latencies in buckets that grow with the value, like an HdrHistogram.
+///
+/// Every power of 2 has the same number of buckets, so a percentile is
+/// within 1/16 of the value. Values up to about two minutes are kept,
+/// longer ones go to the last bucket.
+class LatencyHistogram
+{
+public:
+	/// The bits of the buckets of a power of 2
+	constexpr static unsigned subBits = 4;
+
+	/// The buckets of a power of 2
+	constexpr static size_t subCount = 1 << subBits;
+
+	/// The number of powers of 2 after the first buckets
+	constexpr static size_t shiftCount = 33;
+
+	/// The number of buckets
+	constexpr static size_t bucketCount = subCount * (shiftCount + 1);
+
+	/// The bucket of a value in nanoseconds
+	static size_t bucketOf(uint64_t value);
+
+	/// The smallest value of a bucket
+	static uint64_t lowestOf(size_t bucket);
+
+	/// The largest value of a bucket
+	static uint64_t highestOf(size_t bucket);
+
+	/// The values, by bucket
+	array<uint64_t, bucketCount> counts{};
+
+	/// The number of values
+	uint64_t count = 0;
+
+	/// The sum of the values
+	uint64_t sum = 0;
+
+	/// The largest value
+	uint64_t max = 0;
+
+	/// Adds a value
+	void record(chrono::nanoseconds value);
+
+	/// Adds the values of another histogram
+	void merge(const LatencyHistogram& other);
+
+	/// The value under which a fraction of the values are, like 0.99.
+	/// The middle of its bucket, or 0 without values.
+	chrono::nanoseconds percentile(double fraction) const;
+
+	/// The average, or 0 without values
+	chrono::nanoseconds mean() const;
+};
+
+/// The statistics of a method
+struct MethodStatistics
+{
+	/// The name of the method
+	string_view method;
+
+	/// The messages of the method that the server read
+	uint64_t messages = 0;
+
+	/// The latencies, by Stage
+	array<LatencyHistogram, stageCount> stages;
+
+	/// The latencies of a stage
+	const LatencyHistogram& stage(Stage stage) const;
+};
+
+/// The statistics of a server at a moment
+struct StatisticsSnapshot
+{
+	/// The messages read from the clients
+	uint64_t messagesIn = 0;
+
+	/// The messages written to the clients
+	uint64_t messagesOut = 0;
+
+	/// The bytes of the messages read
+	uint64_t bytesIn = 0;
+
+	/// The bytes of the messages written
+	uint64_t bytesOut = 0;
+
+	/// The methods with messages, by name
+	vector<MethodStatistics> methods;
+
+	/// The requests that wait for a worker, by Priority
+	array<size_t, 3> queued{};
+
+	/// The bytes that wait for the writers of the connections
+	size_t pendingBytes = 0;
+
+	/// The connections of the clients
+	size_t connections = 0;
+
+	/// Writes it as a json object, with the percentiles of every stage in
+	/// microseconds
+	void write(JsonWriter& writer) const;
+};
+
+/// Counters and latency histograms of the messages, by method.
+///
+/// Every thread that records has its own shard, where only it writes, so
+/// recording is a few relaxed atomic stores without locks or shared cache
+/// lines. A snapshot merges the shards. The shard of a thread that ends
+/// goes to the next thread that records.
+class Statistics
+{
+private:
+	/// A histogram that one thread writes and others read
+	struct SharedHistogram
+	{
+		array<atomic<uint64_t>, LatencyHistogram::bucketCount> counts{};
+
+		atomic<uint64_t> count{0};
+
+		atomic<uint64_t> sum{0};
+
+		atomic<uint64_t> max{0};
+	};
+
+	/// The statistics of a method in a shard
+	struct MethodSlot
+	{
+		atomic<uint64_t> messages{0};
+
+		/// Allocated the first time that the stage is recorded
+		array<atomic<SharedHistogram*>, stageCount> stages{};
+
+		virtual ~MethodSlot();
+	};
+
+	/// The methods of a shard are in chunks, allocated when they are used
+	constexpr static size_t chunkBits = 6;
+
+	constexpr static size_t chunkSize = 1 << chunkBits;
+
+	constexpr static size_t chunkCount = 64;
+
+	/// The MethodSlots of a range of MethodIds
+	struct Chunk
+	{
+		array<MethodSlot, chunkSize> slots;
+	};
+
+	/// The statistics that a thread records
+	struct alignas(64) Shard
+	{
+		atomic<uint64_t> messagesIn{0};
+
+		atomic<uint64_t> messagesOut{0};
+
+		atomic<uint64_t> bytesIn{0};
+
+		atomic<uint64_t> bytesOut{0};
+
+		array<atomic<Chunk*>, chunkCount> chunks{};
+
+		/// If a thread records in it
+		bool leased = false;
+
+		virtual ~Shard();
+	};
+
+	/// The shards, they live while a thread can still use them
+	struct Registry
+	{
+		mutex shardsMutex;
+
+		vector<unique_ptr<Shard>> shards;
+
+		/// Gives a shard to a thread
+		Shard& lease();
+
+		/// Gives back the shard of a thread that ended
+		void release(Shard& shard);
+	};
+
+	shared_ptr<Registry> registry;
+
+	/// The shards that the calling thread leased, given back when it ends
+	struct Leases;
+
+	static thread_local Leases leases;
+
+	/// The shard of the calling thread
+	Shard& shard();
+
+	/// The slot of a method in the shard of the calling thread.
+	/// nullptr if the MethodId is too large.
+	MethodSlot* slot(MethodId method);
+
+	/// Adds to a counter that only this thread writes
+	static void add(atomic<uint64_t>& counter, uint64_t value);
+
+public:
+	Statistics();
+
+	Statistics(const Statistics&) = delete;
+	Statistics& operator=(const Statistics&) = delete;
+
+	virtual ~Statistics();
+
+	/// Records the latency of a stage of a message
+	void record(MethodId method, Stage stage, chrono::nanoseconds latency);
+
+	/// Counts a message read, with its method if it has one
+	void countIn(optional<MethodId> method, size_t bytes);
+
+	/// Counts a message written
+	void countOut(size_t bytes);
+
+	/// Merges the shards.
+	/// The gauges of the queues are filled by the server.
+	StatisticsSnapshot snapshot() const;
+};
+
+}
@@ -0,0 +1,448 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Coroutine handlers are only for the programs built as C++20, the library
+// itself stays C++17
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <any>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <libclsp/server/deferredResponse.hpp>
+#include <libclsp/server/responseFuture.hpp>
+#include <libclsp/server/server.hpp>
+#include <libclsp/server/typedCapability.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The promise of a Task, without its result
+struct TaskPromise
+{
+	/// The coroutine that awaits the task
+	coroutine_handle<> continuation = noop_coroutine();
+
+	/// The exception of the task
+	exception_ptr error;
+
+	/// Resumes the coroutine that awaits the task
+	struct FinalAwaiter
+	{
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		template<class Promise>
+		coroutine_handle<> await_suspend(coroutine_handle<Promise> handle)
+			noexcept
+		{
+			return handle.promise().continuation;
+		}
+
+		void await_resume() const noexcept
+		{
+		}
+	};
+
+	/// A task starts when it's awaited
+	suspend_always initial_suspend() const noexcept
+	{
+		return {};
+	}
+
+	FinalAwaiter final_suspend() const noexcept
+	{
+		return {};
+	}
+
+	void unhandled_exception() noexcept
+	{
+		error = current_exception();
+	}
+};
+
+/// The promise of a Task with its result
+template<class T>
+struct TaskResult: public TaskPromise
+{
+	optional<T> value;
+
+	template<class U>
+	void return_value(U&& result)
+	{
+		value.emplace(forward<U>(result));
+	}
+
+	T take()
+	{
+		if(error != nullptr)
+		{
+			rethrow_exception(error);
+		}
+
+		return move(*value);
+	}
+};
+
+/// The promise of a Task without a result
+template<>
+struct TaskResult<void>: public TaskPromise
+{
+	void return_void() const noexcept
+	{
+	}
+
+	void take()
+	{
+		if(error != nullptr)
+		{
+			rethrow_exception(error);
+		}
+	}
+};
+
+/// A coroutine that returns a T.
+///
+/// It starts when it's awaited, and resumes the coroutine that awaits it
+/// when it ends, in the same thread. A handler made by handleTask() returns
+/// one. While it's suspended it doesn't use a worker, so the pool can keep
+/// thousands of them waiting for the client.
+template<class T = void>
+class Task
+{
+public:
+	struct promise_type: public TaskResult<T>
+	{
+		Task get_return_object() noexcept
+		{
+			return Task(coroutine_handle<promise_type>::from_promise(*this));
+		}
+	};
+
+private:
+	coroutine_handle<promise_type> handle;
+
+	explicit Task(coroutine_handle<promise_type> handle):
+		handle(handle)
+	{};
+
+public:
+	Task(Task&& other) noexcept:
+		handle(exchange(other.handle, nullptr))
+	{};
+
+	Task& operator=(Task&& other) noexcept
+	{
+		if(this != &other)
+		{
+			if(handle)
+			{
+				handle.destroy();
+			}
+
+			handle = exchange(other.handle, nullptr);
+		}
+
+		return *this;
+	}
+
+	Task(const Task&) = delete;
+	Task& operator=(const Task&) = delete;
+
+	virtual ~Task()
+	{
+		if(handle)
+		{
+			handle.destroy();
+		}
+	}
+
+	bool await_ready() const noexcept
+	{
+		return !handle || handle.done();
+	}
+
+	coroutine_handle<> await_suspend(coroutine_handle<> awaiting) noexcept
+	{
+		handle.promise().continuation = awaiting;
+
+		return handle;
+	}
+
+	T await_resume()
+	{
+		return handle.promise().take();
+	}
+};
+
+/// A coroutine that starts right away and frees itself when it ends
+struct DetachedTask
+{
+	struct promise_type
+	{
+		DetachedTask get_return_object() const noexcept
+		{
+			return {};
+		}
+
+		suspend_never initial_suspend() const noexcept
+		{
+			return {};
+		}
+
+		suspend_never final_suspend() const noexcept
+		{
+			return {};
+		}
+
+		void return_void() const noexcept
+		{
+		}
+
+		void unhandled_exception() const noexcept
+		{
+			// Nobody waits for it, runTask() answers the errors
+		}
+	};
+};
+
+/// Waits for the response of a request to the client.
+/// The coroutine resumes in the pool, with the context of its handler.
+struct ResponseAwaiter
+{
+	ResponseFuture future;
+
+	optional<ClientResponse> response;
+
+	bool await_ready() const
+	{
+		return future.isReady();
+	}
+
+	void await_suspend(coroutine_handle<> handle)
+	{
+		HandlerContext context = HandlerContext::current();
+
+		// The awaiter can be gone after then(), the coroutine can resume
+		// before it returns
+		future.then([this, handle, context](ClientResponse& response)
+		{
+			this->response = response;
+
+			context.run([handle]()
+			{
+				handle.resume();
+			});
+		});
+	}
+
+	ClientResponse await_resume()
+	{
+		if(!response.has_value())
+		{
+			// It was ready, then() runs right away
+			future.then([this](ClientResponse& response)
+			{
+				this->response = response;
+			});
+		}
+
+		return move(*response);
+	}
+};
+
+/// Awaits a response of the client, see Server::sendRequest()
+inline ResponseAwaiter operator co_await(ResponseFuture future)
+{
+	return ResponseAwaiter{move(future), nullopt};
+}
+
+/// Throws the error of the request if it was cancelled, without suspending
+struct CancellationAwaiter
+{
+	bool await_ready() const noexcept
+	{
+		return true;
+	}
+
+	void await_suspend(coroutine_handle<>) const noexcept
+	{
+	}
+
+	void await_resume() const
+	{
+		CancellationToken::current().throwIfCancelled();
+	}
+};
+
+/// Checks the cancellation of the request of the coroutine
+inline CancellationAwaiter checkCancellation()
+{
+	return {};
+}
+
+/// Resumes the coroutine as a new task of the pool, see Server::submit()
+struct ScheduleAwaiter
+{
+	Server& server;
+
+	Priority priority;
+
+	/// The delay, 0 to only go back to the queue
+	chrono::milliseconds delay;
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	bool await_suspend(coroutine_handle<> handle)
+	{
+		HandlerContext context = HandlerContext::current();
+
+		auto resume = [handle, context]()
+		{
+			context.run([handle]()
+			{
+				handle.resume();
+			});
+		};
+
+		// Without a server it goes on in this thread
+		if(delay.count() > 0)
+		{
+			return server.submitAfter(delay, move(resume), priority);
+		}
+
+		return server.submit(move(resume), priority);
+	}
+
+	void await_resume() const noexcept
+	{
+	}
+};
+
+/// Lets the requests of a priority run first.
+/// The coroutine goes back to the queue of the pool with a priority, so a
+/// long computation can yield to the interactive requests.
+inline ScheduleAwaiter yieldTo(Server& server,
+	Priority priority = Priority::background)
+{
+	return {server, priority, chrono::milliseconds(0)};
+}
+
+/// Resumes the coroutine after a delay, without a worker that sleeps
+inline ScheduleAwaiter sleepFor(Server& server,
+	chrono::milliseconds delay,
+	Priority priority = Priority::normal)
+{
+	return {server, priority, delay};
+}
+
+/// Runs the task of a handler and gives its deferred response.
+/// The params live in its frame while the task runs.
+template<class Result, class Function, class... Params>
+DetachedTask runTask(const Function& function,
+	optional<DeferredResponse> response,
+	Params... params)
+{
+	try
+	{
+		if constexpr(is_void_v<Result>)
+		{
+			co_await function(params...);
+
+			if(response.has_value())
+			{
+				response->resolve({});
+			}
+		}
+		else
+		{
+			// The writer of the capability casts to the Result, a task can
+			// return anything that converts to it
+			any result(in_place_type<Result>, co_await function(params...));
+
+			if(response.has_value())
+			{
+				response->resolve(move(result));
+			}
+		}
+	}
+	catch(ResponseError& error)
+	{
+		if(response.has_value())
+		{
+			response->fail(move(error));
+		}
+	}
+	catch(exception& error)
+	{
+		if(response.has_value())
+		{
+			response->fail(ResponseError(ErrorCodes::InternalError,
+				error.what(),
+				nullopt));
+		}
+	}
+}
+
+/// The capability with a handler that is a coroutine.
+///
+/// The function gets the params and returns a Task of the result. The
+/// handler defers its response and returns at the first suspension, so the
+/// worker runs other requests while it waits. The response is sent when
+/// the task ends, errors are thrown as a ResponseError.
+template<class Params, class Result, class Function>
+Capability handleTask(const TypedCapability<Params, Result>& method,
+	Function function)
+{
+	Capability capability = method.untyped();
+
+	capability.handler = [function = move(function)](optional<any>& params)
+	{
+		optional<DeferredResponse> response = DeferredResponse::defer();
+
+		if constexpr(is_void_v<Params>)
+		{
+			runTask<Result>(function, move(response));
+		}
+		else
+		{
+			runTask<Result>(function,
+				move(response),
+				move(any_cast<Params&>(*params)));
+		}
+
+		return any();
+	};
+
+	return capability;
+}
+
+}
+
+#endif
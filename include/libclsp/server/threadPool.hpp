@@ -0,0 +1,182 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// A pool of threads that steal work from each other.
+///
+/// Every worker has its own queues: one with the tasks submitted to it and
+/// one with the subtasks that its tasks fork. A worker runs its newest
+/// subtask first and its oldest submitted task after that, and an idle
+/// worker steals the oldest tasks of the others.
+class ThreadPool
+{
+private:
+	struct Worker
+	{
+		/// A mutex for the queues
+		mutex queueMutex;
+
+		/// The tasks submitted to this worker
+		deque<function<void()>> submitted;
+
+		/// The subtasks forked by the tasks of this worker
+		deque<function<void()>> forked;
+
+		/// The thread itself
+		thread runner;
+	};
+
+	/// The workers
+	vector<unique_ptr<Worker>> workers;
+
+	/// The number of tasks in the queues of all the workers
+	atomic<size_t> queued{0};
+
+	/// The worker of the next task without an affinity
+	atomic<size_t> nextWorker{0};
+
+	/// If the workers stop when the queues are empty
+	atomic<bool> stopping{false};
+
+	/// The number of sleeping workers
+	atomic<unsigned> sleepers{0};
+
+	/// A mutex for the sleeps
+	mutex sleepMutex;
+
+	/// Where the workers sleep
+	condition_variable sleep;
+
+	/// The pool of this thread, if it's a worker
+	static thread_local ThreadPool* currentPool;
+
+	/// The index of this thread in its pool
+	static thread_local size_t currentWorker;
+
+	/// The loop of a worker
+	void run(size_t index);
+
+	/// Takes a task from the queues of a worker
+	bool take(Worker& worker, bool owner, function<void()>& task);
+
+	/// Puts a task in a queue of a worker
+	void push(size_t index, bool fork, function<void()> task);
+
+public:
+	/// A pool with the given number of workers.
+	/// 0 is one worker per core.
+	ThreadPool(size_t workerCount = 0);
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// Runs the tasks that are left and stops the workers
+	virtual ~ThreadPool();
+
+	/// The number of workers
+	size_t size() const;
+
+	/// Runs a task in any worker
+	void submit(function<void()> task);
+
+	/// Runs a task, preferably in the worker affinity % size().
+	/// Tasks with the same affinity share caches, but an idle worker can
+	/// still steal them.
+	void submit(function<void()> task, size_t affinity);
+
+	/// Runs a subtask of the current task.
+	/// It goes to the queue of this worker, or to any worker if this thread
+	/// isn't one of the pool.
+	void fork(function<void()> task);
+
+	/// Runs one queued task in this thread.
+	/// false if there wasn't one.
+	bool runPending();
+
+	/// The pool of this thread, or nullptr if it isn't a worker
+	static ThreadPool* current();
+};
+
+/// A group of tasks that can be waited.
+///
+/// A task of the pool can fork its work in a group and wait for it. The
+/// waiting thread runs queued tasks meanwhile, so no worker is blocked.
+class TaskGroup
+{
+private:
+	/// The pool that runs the tasks
+	ThreadPool& pool;
+
+	/// The number of tasks that didn't finish
+	atomic<size_t> pending{0};
+
+	/// The first exception thrown by a task
+	exception_ptr error;
+
+	/// A mutex for the exception
+	mutex errorMutex;
+
+	/// A mutex for the waits
+	mutex doneMutex;
+
+	/// Where the waiting threads sleep
+	condition_variable done;
+
+	/// Adds the bookkeeping of the group to a task
+	function<void()> wrap(function<void()> task);
+
+public:
+	TaskGroup(ThreadPool& pool);
+
+	TaskGroup(const TaskGroup&) = delete;
+	TaskGroup& operator=(const TaskGroup&) = delete;
+
+	/// Waits for the tasks that are left
+	virtual ~TaskGroup();
+
+	/// Runs a task of the group as a subtask of the current one
+	void fork(function<void()> task);
+
+	/// Runs a task of the group with an affinity (see ThreadPool::submit())
+	void fork(function<void()> task, size_t affinity);
+
+	/// Adds a task to the group without running it.
+	/// The returned function runs it and must be called once, like by a
+	/// PriorityScheduler.
+	function<void()> add(function<void()> task);
+
+	/// Runs queued tasks until all the tasks of the group finish.
+	/// Throws the first exception of the tasks.
+	void wait();
+};
+
+}
@@ -0,0 +1,131 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// Timeouts in a hierarchical timing wheel.
+///
+/// The first level has a slot for each tick, and every level after it has
+/// slots that are as long as the whole level before it. A timer goes to the
+/// level of its delay, and falls to the lower levels as its time comes, so
+/// adding or cancelling a timer doesn't depend on the number of timers.
+///
+/// It doesn't have a thread, the owner calls advance() at least once per
+/// tick while it isn't empty. The server does it in its event loop.
+class TimerWheel
+{
+public:
+	using Clock = chrono::steady_clock;
+
+	/// A scheduled callback
+	struct Timer
+	{
+		/// The tick that it runs in
+		uint64_t expiry;
+
+		/// The callback
+		function<void()> callback;
+
+		/// If it ran or was cancelled
+		atomic<bool> done{false};
+	};
+
+private:
+	/// The bits of the slots of a level
+	constexpr static unsigned slotBits = 6;
+
+	/// The slots of a level
+	constexpr static size_t slotCount = 1 << slotBits;
+
+	/// The number of levels
+	constexpr static size_t levelCount = 4;
+
+	/// The length of a tick
+	Clock::duration tick;
+
+	/// The time of tick 0
+	Clock::time_point start;
+
+	/// The last tick that ran
+	uint64_t current = 0;
+
+	/// A mutex for the slots
+	mutex wheelMutex;
+
+	/// The timers, by level and slot
+	vector<shared_ptr<Timer>> slots[levelCount][slotCount];
+
+	/// The timers that didn't run and weren't cancelled
+	atomic<size_t> live{0};
+
+	/// The tick of a time
+	uint64_t tickOf(Clock::time_point time) const;
+
+	/// Puts a timer in the slot of its expiry
+	void place(shared_ptr<Timer> timer);
+
+	/// Moves the timers of the current slot of a level to the lower levels.
+	/// true if it's the first slot of the level, so the next level cascades
+	/// too.
+	bool cascade(size_t level);
+
+public:
+	/// Called by schedule() when the wheel had no live timers, so the owner
+	/// starts to advance it. It runs in the thread of schedule().
+	function<void()> armed;
+
+	TimerWheel(Clock::duration tick = chrono::milliseconds(10));
+
+	TimerWheel(const TimerWheel&) = delete;
+	TimerWheel& operator=(const TimerWheel&) = delete;
+
+	virtual ~TimerWheel();
+
+	/// Runs a callback after a delay, rounded up to the next tick.
+	/// The callback runs in the thread that calls advance().
+	shared_ptr<Timer> schedule(Clock::duration delay,
+		function<void()> callback);
+
+	/// Cancels a timer.
+	/// false if it already ran or is running.
+	bool cancel(const shared_ptr<Timer>& timer);
+
+	/// Runs the timers whose time came.
+	/// The callbacks run outside the lock, they can schedule or cancel
+	/// timers.
+	void advance(Clock::time_point now = Clock::now());
+
+	/// If there isn't a timer that may run
+	bool empty() const;
+
+	/// The length of a tick
+	Clock::duration getTick() const;
+};
+
+}
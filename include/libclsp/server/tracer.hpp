@@ -0,0 +1,252 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <libclsp/server/methodId.hpp>
+#include <libclsp/types/jsonTypes.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// A span of the pipeline in a thread, with what it worked on.
+/// The strings are cut to fit, so recording it doesn't allocate.
+struct TraceEvent
+{
+	/// What the span did, a static string
+	const char* name;
+
+	/// The nanoseconds from the start of the trace
+	uint64_t start;
+
+	/// The nanoseconds that it lasted
+	uint64_t duration;
+
+	/// The tid of the thread that recorded it
+	uint32_t thread;
+
+	/// If it has a method
+	bool hasMethod;
+
+	/// The method of the message
+	MethodId method;
+
+	/// The id of the request, empty if there isn't one
+	char id[24];
+
+	/// The uri of the document, empty if there isn't one
+	char uri[104];
+
+	/// An event without tags
+	void reset(const char* name);
+
+	void setMethod(MethodId method);
+
+	void setId(const variant<Number, String>& id);
+
+	void setId(const variant<Number, String, Null>& id);
+
+	void setUri(string_view uri);
+};
+
+/// Writes a timeline of the pipeline in the trace event format of Chrome,
+/// that Perfetto and chrome://tracing open.
+///
+/// Every thread that records has its own ring of events, where only it
+/// writes, and a thread of the tracer writes them to the file every few
+/// milliseconds. A full ring drops the new events. While the tracer is
+/// stopped a span is one relaxed load.
+class Tracer
+{
+public:
+	using Clock = chrono::steady_clock;
+
+private:
+	/// The events of a ring
+	constexpr static size_t ringCapacity = 8192;
+
+	/// The events that a thread recorded and the writer didn't take
+	struct Ring
+	{
+		array<TraceEvent, ringCapacity> events;
+
+		/// The next event to record, only the thread of the ring writes it
+		atomic<uint64_t> head{0};
+
+		/// The next event to write, only the writer writes it
+		atomic<uint64_t> tail{0};
+
+		/// The tid of the events
+		uint32_t thread = 0;
+
+		/// If a thread records in it
+		bool leased = false;
+	};
+
+	/// The rings, they live while a thread can still use them
+	struct Registry
+	{
+		mutex ringsMutex;
+
+		vector<unique_ptr<Ring>> rings;
+
+		/// The last tid given to a thread, a reused ring gets a new one
+		uint32_t lastThread = 0;
+
+		/// Gives a ring to a thread
+		Ring& lease();
+
+		/// Gives back the ring of a thread that ended
+		void release(Ring& ring);
+	};
+
+	shared_ptr<Registry> registry;
+
+	/// The rings that the calling thread leased, given back when it ends
+	struct Leases;
+
+	static thread_local Leases leases;
+
+	/// If the spans are recorded
+	atomic<bool> enabled{false};
+
+	/// The time of the start of the trace, since the epoch of the clock.
+	/// Atomic because a span can be recorded while a trace restarts.
+	atomic<Clock::rep> origin{0};
+
+	/// The events that didn't fit in their ring
+	atomic<uint64_t> dropped{0};
+
+	/// The file of the trace
+	FILE* file = nullptr;
+
+	/// If an event was written, the next one needs a comma
+	bool written = false;
+
+	/// A mutex for start() and stop()
+	mutex controlMutex;
+
+	/// Where the writer sleeps
+	mutex flushMutex;
+	condition_variable flushed;
+
+	/// If the writer stops
+	bool stopping = false;
+
+	/// Writes the rings to the file
+	thread writerThread;
+
+	/// The ring of the calling thread
+	Ring& ring();
+
+	/// Writes the events of the rings
+	void flush();
+
+	/// The writer thread
+	void writeEvents();
+
+public:
+	/// How often the writer takes the events
+	chrono::milliseconds flushInterval{50};
+
+	Tracer();
+
+	Tracer(const Tracer&) = delete;
+	Tracer& operator=(const Tracer&) = delete;
+
+	/// Stops the trace
+	virtual ~Tracer();
+
+	/// Starts a trace in a file, it's replaced.
+	/// false if the file can't be opened or a trace is running.
+	bool start(const string& path);
+
+	/// Stops the trace and finishes its file
+	void stop();
+
+	/// If the spans are recorded
+	bool isEnabled() const
+	{
+		return enabled.load(memory_order_relaxed);
+	}
+
+	/// The events that didn't fit in their ring since the start
+	uint64_t droppedEvents() const;
+
+	/// Records a span that started and ended at some times.
+	/// The event has the name and the tags.
+	void record(TraceEvent& event, Clock::time_point start, Clock::time_point end);
+};
+
+/// Records a span from its construction to its destruction, if the tracer
+/// was enabled at its construction.
+class TraceSpan
+{
+private:
+	/// The tracer, nullptr if it wasn't enabled
+	Tracer* tracer = nullptr;
+
+	Tracer::Clock::time_point start;
+
+public:
+	/// The span, only valid if isActive()
+	TraceEvent event;
+
+	TraceSpan(Tracer& tracer, const char* name)
+	{
+		if(tracer.isEnabled())
+		{
+			this->tracer = &tracer;
+			event.reset(name);
+			start = Tracer::Clock::now();
+		}
+	}
+
+	TraceSpan(const TraceSpan&) = delete;
+	TraceSpan& operator=(const TraceSpan&) = delete;
+
+	~TraceSpan()
+	{
+		if(tracer != nullptr)
+		{
+			tracer->record(event, start, Tracer::Clock::now());
+		}
+	}
+
+	/// If the span is recorded, so its tags are needed
+	bool isActive() const
+	{
+		return tracer != nullptr;
+	}
+};
+
+}
@@ -0,0 +1,179 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include <unistd.h>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The file descriptors of a connection with a client
+struct Channel
+{
+	/// Where the messages are read
+	int input;
+
+	/// Where the messages are written, it can be the input
+	int output;
+
+	/// If the connection closes them when it ends
+	bool owned;
+};
+
+/// A source of connections for Server::serve().
+///
+/// A transport can listen on a file descriptor that the event loop of the
+/// server watches, or make all its connections when it's opened.
+class Transport
+{
+public:
+	Transport();
+
+	Transport(const Transport&) = delete;
+	Transport& operator=(const Transport&) = delete;
+
+	virtual ~Transport();
+
+	/// Starts listening.
+	/// false if it can't, errno has the reason.
+	virtual bool open() = 0;
+
+	/// The file descriptor that is readable when a connection can be
+	/// accepted, or -1 if the transport doesn't listen.
+	virtual int listener() const = 0;
+
+	/// The next connection, nullopt if there isn't one now
+	virtual optional<Channel> accept() = 0;
+
+	/// Stops listening, the accepted connections stay open
+	virtual void close() = 0;
+};
+
+/// A single connection with two file descriptors, stdin and stdout by
+/// default.
+/// They aren't closed when the connection ends.
+class StdioTransport: public Transport
+{
+private:
+	/// Where the messages are read
+	int input;
+
+	/// Where the messages are written
+	int output;
+
+	/// If the connection was accepted
+	bool accepted = false;
+
+public:
+	StdioTransport(int input = STDIN_FILENO, int output = STDOUT_FILENO);
+
+	virtual ~StdioTransport();
+
+	bool open() override;
+
+	int listener() const override;
+
+	optional<Channel> accept() override;
+
+	void close() override;
+};
+
+/// A socket that listens for connections, with a non-blocking accept().
+class SocketTransport: public Transport
+{
+protected:
+	/// The listening socket, -1 if it's closed.
+	/// Other threads can wait for serve() to open it.
+	atomic<int> fd{-1};
+
+	/// The maximum number of pending connections
+	int backlog;
+
+	/// Makes the socket listen on an address
+	bool listenOn(int family, const void* address, size_t length);
+
+public:
+	SocketTransport(int backlog);
+
+	virtual ~SocketTransport();
+
+	int listener() const override;
+
+	optional<Channel> accept() override;
+
+	void close() override;
+};
+
+/// Listens on a Unix domain socket.
+/// The file of the socket is replaced when it's opened and removed when
+/// it's closed.
+class UnixTransport: public SocketTransport
+{
+private:
+	/// The file of the socket
+	string path;
+
+	/// If this transport made the file
+	bool bound = false;
+
+public:
+	UnixTransport(string path, int backlog = 64);
+
+	virtual ~UnixTransport();
+
+	bool open() override;
+
+	void close() override;
+};
+
+/// Listens on a TCP port.
+///
+/// The host is an address or a name, like "127.0.0.1" or "localhost".
+/// With the port 0 the system chooses one, port() tells which after open().
+class TcpTransport: public SocketTransport
+{
+private:
+	/// The address to listen on
+	string host;
+
+	/// The port to listen on
+	uint16_t requestedPort;
+
+public:
+	TcpTransport(string host, uint16_t port, int backlog = 64);
+
+	virtual ~TcpTransport();
+
+	bool open() override;
+
+	/// Like SocketTransport::accept() but without Nagle's algorithm, the
+	/// messages are sent as soon as they are written
+	optional<Channel> accept() override;
+
+	/// The port that the socket listens on, 0 if it isn't open
+	uint16_t port() const;
+};
+
+}
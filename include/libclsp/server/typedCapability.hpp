@@ -0,0 +1,258 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <any>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include <libclsp/server/capability.hpp>
+#include <libclsp/server/jsonValue.hpp>
+#include <libclsp/server/messageEnvelope.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// Who sends the requests or notifications of a method
+enum class Sender
+{
+	/// The client, the server reads the params and writes the result
+	client,
+
+	/// The server, it writes the params and reads the result
+	server,
+
+	/// Both of them
+	both
+};
+
+/// Params of a known type
+template<class Params>
+struct DecodedParamsOf: public DecodedParams
+{
+	Params params;
+};
+
+/// A method without params
+template<>
+struct DecodedParamsOf<void>: public DecodedParams
+{
+};
+
+template<class T>
+T* DecodedParams::as()
+{
+	auto* decoded = dynamic_cast<DecodedParamsOf<T>*>(this);
+
+	return decoded != nullptr ? &decoded->params : nullptr;
+}
+
+/// A TypedHandler that calls a function object with the params.
+/// The function gets a Params& and returns a Result, or gets nothing if
+/// Params is void.
+template<class Params, class Result, class Function>
+class TypedHandlerOf: public TypedHandler
+{
+private:
+	Function function;
+
+public:
+	TypedHandlerOf(Function function):
+		function(move(function))
+	{};
+
+	virtual unique_ptr<DecodedParams> decode(
+		const MessageEnvelope& envelope) const
+	{
+		auto decoded = make_unique<DecodedParamsOf<Params>>();
+
+		if constexpr(!is_void_v<Params>)
+		{
+			if(envelope.decodeParams(decoded->params).IsError())
+			{
+				return nullptr;
+			}
+		}
+
+		return decoded;
+	}
+
+	virtual void run(DecodedParams& params, JsonWriter& result) const
+	{
+		auto& decoded = static_cast<DecodedParamsOf<Params>&>(params);
+
+		auto call = [this, &decoded]() -> decltype(auto)
+		{
+			if constexpr(is_void_v<Params>)
+			{
+				return function();
+			}
+			else
+			{
+				return function(decoded.params);
+			}
+		};
+
+		if constexpr(is_void_v<Result>)
+		{
+			call();
+		}
+		else
+		{
+			Result value = call();
+
+			JsonValue<Result>::write(result, value);
+		}
+	}
+
+	virtual ~TypedHandlerOf(){};
+};
+
+/// A method with the types of its params and result.
+///
+/// Params is void for methods without params, and Result is void for
+/// notifications. Their json is read and written by JsonValue.
+template<class Params, class Result>
+struct TypedCapability
+{
+	/// The name of the method
+	string_view method;
+
+	/// Who sends the requests or notifications
+	Sender sender;
+
+	/// The priority of its requests
+	Priority priority;
+
+	/// What its handler does with the document of the params.
+	/// Notifications write by default, requests read.
+	Access access;
+
+	constexpr TypedCapability(string_view method,
+		Sender sender,
+		Priority priority = Priority::normal,
+		Access access = is_void_v<Result>? Access::write: Access::read):
+		method(method),
+		sender(sender),
+		priority(priority),
+		access(access)
+	{};
+
+	/// The capability without types.
+	/// Its functions read and write the params and the result through
+	/// std::any, only in the directions that the server uses.
+	Capability untyped() const
+	{
+		Capability::JsonIO params(nullopt, nullopt);
+
+		if constexpr(is_void_v<Params>)
+		{
+			params.reader = [](JsonHandler&, optional<any>& data)
+			{
+				data = nullopt;
+
+				return ValueSetter();
+			};
+		}
+		else
+		{
+			if(sender != Sender::client)
+			{
+				params.writer = &write<Params>;
+			}
+
+			if(sender != Sender::server && isJsonReadable<Params>)
+			{
+				params.reader = &read<Params>;
+			}
+		}
+
+		optional<Capability::JsonIO> result;
+
+		if constexpr(!is_void_v<Result>)
+		{
+			result.emplace(nullopt, nullopt);
+
+			if(sender != Sender::server)
+			{
+				result->writer = &write<Result>;
+			}
+
+			if(sender != Sender::client && isJsonReadable<Result>)
+			{
+				result->reader = &read<Result>;
+			}
+		}
+
+		Capability capability(String(method), params, result);
+
+		capability.priority = priority;
+		capability.access   = access;
+
+		return capability;
+	}
+
+	/// The capability with a handler that gets the params and returns the
+	/// result with their types.
+	template<class Function>
+	Capability handle(Function function) const
+	{
+		Capability capability = untyped();
+
+		capability.typedHandler =
+			make_shared<TypedHandlerOf<Params, Result, Function>>(
+				move(function));
+
+		return capability;
+	}
+
+private:
+	/// Writes a value from an std::any
+	template<class T>
+	static void write(JsonWriter& writer, any& data)
+	{
+		if constexpr(is_same_v<T, Null>)
+		{
+			// A result that is always null doesn't need one
+			writer.Null();
+		}
+		else
+		{
+			JsonValue<T>::write(writer, any_cast<T&>(data));
+		}
+	}
+
+	/// Reads a value into an std::any
+	template<class T>
+	static ValueSetter read(JsonHandler& handler, optional<any>& data)
+	{
+		if constexpr(isJsonReadable<T>)
+		{
+			return jsonReader(handler, data.emplace().template emplace<T>());
+		}
+		else
+		{
+			return ValueSetter();
+		}
+	}
+};
+
+}
@@ -0,0 +1,122 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The memory resource of this thread.
+/// new_delete_resource() if there isn't a MemoryScope.
+pmr::memory_resource* currentResource() noexcept;
+
+/// Makes the json types allocate from a memory resource in this thread
+/// while it lives.
+///
+/// Only used if libclsp is built with LIBCLSP_PMR, otherwise the json types
+/// use the global heap.
+/// Everything made inside the scope must be destroyed before the resource.
+/// The writer serializes a response after its handler returns, so a
+/// handler shouldn't make its result in a resource of its own, see
+/// Server::requestArenas instead.
+class MemoryScope
+{
+private:
+	/// The resource before this scope
+	pmr::memory_resource* previous;
+
+public:
+	MemoryScope(pmr::memory_resource* resource) noexcept;
+
+	MemoryScope(const MemoryScope&) = delete;
+	MemoryScope& operator=(const MemoryScope&) = delete;
+
+	~MemoryScope();
+};
+
+/// An allocator that uses the memory resource of the thread that made it.
+///
+/// Copies of containers take the resource of the thread that copies them,
+/// moved containers keep their memory.
+template<class T>
+struct ResourceAllocator
+{
+	using value_type = T;
+
+	using propagate_on_container_copy_assignment = false_type;
+	using propagate_on_container_move_assignment = false_type;
+	using propagate_on_container_swap            = false_type;
+
+	/// Where the memory comes from
+	pmr::memory_resource* resource;
+
+	ResourceAllocator() noexcept:
+		resource(currentResource())
+	{};
+
+	ResourceAllocator(pmr::memory_resource* resource) noexcept:
+		resource(resource)
+	{};
+
+	template<class U>
+	ResourceAllocator(const ResourceAllocator<U>& other) noexcept:
+		resource(other.resource)
+	{};
+
+	T* allocate(size_t n)
+	{
+		return static_cast<T*>(resource->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T* p, size_t n)
+	{
+		resource->deallocate(p, n * sizeof(T), alignof(T));
+	}
+
+	ResourceAllocator select_on_container_copy_construction() const
+	{
+		return ResourceAllocator();
+	}
+
+	template<class U>
+	bool operator==(const ResourceAllocator<U>& other) const noexcept
+	{
+		return resource == other.resource || resource->is_equal(*other.resource);
+	}
+
+	template<class U>
+	bool operator!=(const ResourceAllocator<U>& other) const noexcept
+	{
+		return !(*this == other);
+	}
+};
+
+/// The allocator of the json types
+#ifdef LIBCLSP_PMR
+template<class T>
+using Allocator = ResourceAllocator<T>;
+#else
+template<class T>
+using Allocator = allocator<T>;
+#endif
+
+}
@@ -36,8 +36,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String labelKey;
-	const static String editKey;
+	const static string_view labelKey;
+	const static string_view editKey;
 
 public:
 	/// An optional label of the workspace edit. This label is
@@ -66,8 +66,8 @@ public:
 struct ApplyWorkspaceEditResponse: public ObjectT
 {
 private:
-	const static String appliedKey;
-	const static String failureReasonKey;
+	const static string_view appliedKey;
+	const static string_view failureReasonKey;
 
 public:
 	/// Indicates whether the edit was applied or not.
@@ -82,6 +82,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
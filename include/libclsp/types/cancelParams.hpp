@@ -34,7 +34,7 @@ using namespace std;
 struct CancelParams: public ObjectT
 {
 private:
-	const static String idKey;
+	const static string_view idKey;
 
 protected:
 	/// This is like write() but without the object bounds.
@@ -48,6 +48,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -118,9 +118,9 @@ struct CodeActionKind
 struct CodeActionClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String codeActionLiteralSupportKey;
-	const static String isPreferredSupportKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view codeActionLiteralSupportKey;
+	const static string_view isPreferredSupportKey;
 
 public:
 	/// Whether code action supports dynamic registration.
@@ -133,7 +133,7 @@ public:
 	struct CodeActionLiteralSupport: public ObjectT
 	{
 	private:
-		const static String codeActionKindKey;
+		const static string_view codeActionKindKey;
 
 	public:
 		/// The code action kind is supported with the following value
@@ -141,14 +141,19 @@ public:
 		struct CodeActionKind: public ObjectT
 		{
 		private:
-			const static String valueSetKey;
+			const static string_view valueSetKey;
 
 			struct ValueSetMaker: public ObjectT
 			{
-				vector<clsp::CodeActionKind> &parentArray;
+				Vector<clsp::CodeActionKind> &parentArray;
 
 				//====================   Parsing   ==========================//
 
+			protected:
+				/// The static description of the json members
+				const static ObjectDescriptor descriptor;
+
+			public:
 				/// This fills an ObjectInitializer
 				virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -156,7 +161,7 @@ public:
 
 				//===========================================================//
 
-				ValueSetMaker(vector<clsp::CodeActionKind> &parentArray);
+				ValueSetMaker(Vector<clsp::CodeActionKind> &parentArray);
 
 				virtual ~ValueSetMaker();
 			};
@@ -165,11 +170,19 @@ public:
 			/// property exists the client also guarantees that it will
 			/// handle values outside its set gracefully and falls back
 			/// to a default value when unknown.
-			vector<clsp::CodeActionKind> valueSet;
+			Vector<clsp::CodeActionKind> valueSet;
 
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The json members with a known key
+			const static FieldDescriptor fields[];
+
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -178,7 +191,7 @@ public:
 			//===============================================================//
 
 
-			CodeActionKind(vector<clsp::CodeActionKind> valueSet);
+			CodeActionKind(Vector<clsp::CodeActionKind> valueSet);
 
 			CodeActionKind();
 
@@ -192,6 +205,14 @@ public:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -221,6 +242,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -250,19 +279,19 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String codeActionKindsKey;
+	const static string_view codeActionKindsKey;
 
 public:
 	/// CodeActionKinds that this server may return.
 	///
 	/// The list of kinds may be generic, such as `CodeActionKind.Refactor`,
 	/// or the server may list out every specific kind they provide.
-	optional<vector<CodeActionKind>> codeActionKinds;
+	optional<Vector<CodeActionKind>> codeActionKinds;
 
 	// No parsing
 
 	CodeActionOptions(optional<Boolean> workDoneProgress,
-		optional<vector<CodeActionKind>> codeActionKinds);
+		optional<Vector<CodeActionKind>> codeActionKinds);
 
 	CodeActionOptions();
 
@@ -284,7 +313,7 @@ public:
 	CodeActionRegistrationOptions(
 		variant<DocumentSelector, Null> documentSelector,
 		optional<Boolean> workDoneProgress,
-		optional<vector<CodeActionKind>> codeActionKinds);
+		optional<Vector<CodeActionKind>> codeActionKinds);
 
 	CodeActionRegistrationOptions();
 
@@ -301,15 +330,20 @@ public:
 struct CodeActionContext: public ObjectT
 {
 private:
-	const static String diagnosticsKey;
-	const static String onlyKey;
+	const static string_view diagnosticsKey;
+	const static string_view onlyKey;
 
 	struct DiagnosticsMaker: public ObjectT
 	{
-		vector<Diagnostic> &parentArray;
+		Vector<Diagnostic> &parentArray;
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -317,17 +351,22 @@ private:
 
 		//===================================================================//
 
-		DiagnosticsMaker(vector<Diagnostic> &parentArray);
+		DiagnosticsMaker(Vector<Diagnostic> &parentArray);
 
 		virtual ~DiagnosticsMaker();
 	};
 
 	struct OnlyMaker: public ObjectT
 	{
-		vector<CodeActionKind> &parentArray;
+		Vector<CodeActionKind> &parentArray;
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -335,7 +374,7 @@ private:
 
 		//===================================================================//
 
-		OnlyMaker(vector<CodeActionKind> &parentArray);
+		OnlyMaker(Vector<CodeActionKind> &parentArray);
 
 		virtual ~OnlyMaker();
 	};
@@ -346,17 +385,25 @@ public:
 	/// for the given range. There is no guarantee that these accurately
 	/// reflect the error state of the resource. The primary parameter to
 	/// compute code actions is the provided range.
-	vector<Diagnostic> diagnostics;
+	Vector<Diagnostic> diagnostics;
 
 	/// Requested kind of actions to return.
 	///
 	/// Actions not of this kind are filtered out by the client before being
 	/// shown. So servers can omit computing them.
-	optional<vector<CodeActionKind>> only;
+	optional<Vector<CodeActionKind>> only;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -366,8 +413,8 @@ public:
 
 	// No writing
 
-	CodeActionContext(vector<Diagnostic> diagnostics,
-		optional<vector<CodeActionKind>> only);
+	CodeActionContext(Vector<Diagnostic> diagnostics,
+		optional<Vector<CodeActionKind>> only);
 
 	CodeActionContext();
 
@@ -387,9 +434,9 @@ struct CodeActionParams:
 	public PartialResultParams
 {
 private:
-	const static String textDocumentKey;
-	const static String rangeKey;
-	const static String contextKey;
+	const static string_view textDocumentKey;
+	const static string_view rangeKey;
+	const static string_view contextKey;
 
 public:
 	/// The document in which the command was invoked.
@@ -404,6 +451,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -449,12 +504,12 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String titleKey;
-	const static String kindKey;
-	const static String diagnosticsKey;
-	const static String isPreferredKey;
-	const static String editKey;
-	const static String commandKey;
+	const static string_view titleKey;
+	const static string_view kindKey;
+	const static string_view diagnosticsKey;
+	const static string_view isPreferredKey;
+	const static string_view editKey;
+	const static string_view commandKey;
 
 public:
 	/// A short, human-readable, title for this code action.
@@ -466,7 +521,7 @@ public:
 	optional<CodeActionKind> kind;
 
 	/// The diagnostics that this code action resolves.
-	optional<vector<Diagnostic>> diagnostics;
+	optional<Vector<Diagnostic>> diagnostics;
 
 	/// Marks this as a preferred action. Preferred actions are used by the
 	/// `auto fix` command and can be targeted by keybindings.
@@ -490,7 +545,7 @@ public:
 
 	CodeAction(String title,
 		optional<CodeActionKind> kind,
-		optional<vector<Diagnostic>> diagnostics,
+		optional<Vector<Diagnostic>> diagnostics,
 		optional<Boolean> isPreferred,
 		optional<WorkspaceEdit> edit,
 		optional<Command> command);
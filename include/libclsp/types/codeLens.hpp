@@ -37,7 +37,7 @@ using namespace std;
 struct CodeLensClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Whether code action supports dynamic registration.
@@ -46,6 +46,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -73,7 +81,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String resolveProviderKey;
+	const static string_view resolveProviderKey;
 
 public:
 	/// Code lens has a resolve provider as well.
@@ -119,7 +127,7 @@ struct CodeLensParams:
 	public PartialResultParams
 {
 private:
-	const static String textDocumentKey;
+	const static string_view textDocumentKey;
 
 public:
 	/// The document in which the command was invoked.
@@ -128,6 +136,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -166,9 +182,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String rangeKey;;
-	const static String commandKey;
-	const static String dataKey;
+	const static string_view rangeKey;;
+	const static string_view commandKey;
+	const static string_view dataKey;
 
 public:
 	/// The range in which this code lens is valid. Should only span a single
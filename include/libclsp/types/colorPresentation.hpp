@@ -39,9 +39,9 @@ struct ColorPresentationParams:
 	public PartialResultParams
 {
 private:
-	const static String textDocumentKey;
-	const static String colorKey;
-	const static String rangeKey;
+	const static string_view textDocumentKey;
+	const static string_view colorKey;
+	const static string_view rangeKey;
 
 public:
 	/// The text document.
@@ -56,6 +56,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -91,9 +99,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String labelKey;
-	const static String textEditKey;
-	const static String additionalTextEditsKey;
+	const static string_view labelKey;
+	const static string_view textEditKey;
+	const static string_view additionalTextEditsKey;
 
 public:
 	/// The label of this color presentation. It will be shown on the color
@@ -109,13 +117,13 @@ public:
 	/// An optional array of additional text edits that are applied when
 	/// selecting this color presentation. Edits must not overlap with the
 	/// main edit nor with themselves.
-	optional<vector<TextEdit>> additionalTextEdits;
+	optional<Vector<TextEdit>> additionalTextEdits;
 
 	// No parsing
 
 	ColorPresentation(String label,
 		optional<TextEdit> textEdit,
-		optional<vector<TextEdit>> additionalTextEdits);
+		optional<Vector<TextEdit>> additionalTextEdits);
 
 	ColorPresentation();
 
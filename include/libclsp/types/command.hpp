@@ -41,9 +41,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String titleKey;
-	const static String commandKey;
-	const static String argumentsKey;
+	const static string_view titleKey;
+	const static string_view commandKey;
+	const static string_view argumentsKey;
 
 public:
 	/// Title of the command, like `save`.
@@ -59,6 +59,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -44,9 +44,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String triggerCharactersKey;
-	const static String allCommitCharactersKey;
-	const static String resolveProviderKey;
+	const static string_view triggerCharactersKey;
+	const static string_view allCommitCharactersKey;
+	const static string_view resolveProviderKey;
 
 public:
 	/// Most tools trigger completion request automatically without explicitly
@@ -60,7 +60,7 @@ public:
 	/// If code complete should automatically be trigger on characters not
 	/// being valid inside an identifier (for example `.` in JavaScript)
 	/// list them in `triggerCharacters`.
-	optional<vector<String>> triggerCharacters;
+	optional<Vector<String>> triggerCharacters;
 
 	/// The list of all possible characters that commit a completion.
 	/// This field can be used if clients don't support individual commit
@@ -70,7 +70,7 @@ public:
 	/// on an individual completion item the ones on the completion item win.
 	///
 	/// @since 3.2.0
-	optional<vector<String>> allCommitCharacters;
+	optional<Vector<String>> allCommitCharacters;
 
 	/// The server provides support to resolve additional information for a
 	/// completion item.
@@ -79,8 +79,8 @@ public:
 	// No parsing
 
 	CompletionOptions(optional<Boolean> workDoneProgress,
-		optional<vector<String>> triggerCharacters,
-		optional<vector<String>> allCommitCharacters,
+		optional<Vector<String>> triggerCharacters,
+		optional<Vector<String>> allCommitCharacters,
 		optional<Boolean> resolveProvider);
 
 	CompletionOptions();
@@ -102,8 +102,8 @@ public:
 
 	CompletionRegistrationOptions(variant<DocumentSelector, Null> documentSelector,
 		optional<Boolean> workDoneProgress,
-		optional<vector<String>> triggerCharacters,
-		optional<vector<String>> allCommitCharacters,
+		optional<Vector<String>> triggerCharacters,
+		optional<Vector<String>> allCommitCharacters,
 		optional<Boolean> resolveProvider);
 
 	CompletionRegistrationOptions();
@@ -138,8 +138,8 @@ enum class CompletionTriggerKind
 struct CompletionContext: public ObjectT
 {
 private:
-	const static String triggerKindKey;
-	const static String triggerCharacterKey;
+	const static string_view triggerKindKey;
+	const static string_view triggerCharacterKey;
 
 public:
 	/// How the completion was triggered.
@@ -153,6 +153,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -180,7 +188,7 @@ struct CompletionParams:
 	public PartialResultParams
 {
 private:
-	const static String contextKey;
+	const static string_view contextKey;
 
 public:
 	/// The completion context. This is only available if the client specifies
@@ -191,6 +199,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -312,30 +328,35 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String labelKey;
-	const static String kindKey;
-	const static String tagsKey;
-	const static String detailKey;
-	const static String documentationKey;
-	const static String deprecatedKey;
-	const static String preselectKey;
-	const static String sortTextKey;
-	const static String filterTextKey;
-	const static String insertTextKey;
-	const static String insertTextFormatKey;
-	const static String textEditKey;
-	const static String additionalTextEditsKey;
-	const static String commitCharactersKey;
-	const static String commandKey;
-	const static String dataKey;
+	const static string_view labelKey;
+	const static string_view kindKey;
+	const static string_view tagsKey;
+	const static string_view detailKey;
+	const static string_view documentationKey;
+	const static string_view deprecatedKey;
+	const static string_view preselectKey;
+	const static string_view sortTextKey;
+	const static string_view filterTextKey;
+	const static string_view insertTextKey;
+	const static string_view insertTextFormatKey;
+	const static string_view textEditKey;
+	const static string_view additionalTextEditsKey;
+	const static string_view commitCharactersKey;
+	const static string_view commandKey;
+	const static string_view dataKey;
 
 	struct TagsMaker: public ObjectT
 	{
 		/// The array to make
-		vector<CompletionItemTag> &parentArray;
+		Vector<CompletionItemTag> &parentArray;
 
 		//====================   Parsing   ==============================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -343,7 +364,7 @@ private:
 
 		//===============================================================//
 
-		TagsMaker(vector<CompletionItemTag> &parentArray);
+		TagsMaker(Vector<CompletionItemTag> &parentArray);
 
 		virtual ~TagsMaker();
 	};
@@ -351,10 +372,15 @@ private:
 	struct CommitCharactersMaker: public ObjectT
 	{
 		/// The array to make
-		vector<String> &parentArray;
+		Vector<String> &parentArray;
 
 		//====================   Parsing   ==============================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -362,7 +388,7 @@ private:
 
 		//===============================================================//
 
-		CommitCharactersMaker(vector<String> &parentArray);
+		CommitCharactersMaker(Vector<String> &parentArray);
 
 		virtual ~CommitCharactersMaker();
 	};
@@ -381,7 +407,7 @@ public:
 	/// Tags for this completion item.
 	///
 	/// @since 3.15.0
-	optional<vector<CompletionItemTag>> tags;
+	optional<Vector<CompletionItemTag>> tags;
 
 	/// A human-readable string with additional information
 	/// about this item, like type or symbol information.
@@ -440,13 +466,13 @@ public:
 	/// Additional text edits should be used to change text unrelated to the
 	/// current cursor position (for example adding an import statement at the
 	/// top of the file if the completion item will insert an unqualified type).
-	optional<vector<TextEdit>> additionalTextEdits;
+	optional<Vector<TextEdit>> additionalTextEdits;
 
 	/// An optional set of characters that when pressed while this completion
 	/// is active will accept it first and then type that character.
 	/// *Note* that all commit characters should have `length=1` and that
 	/// superfluous characters will be ignored.
-	optional<vector<String>> commitCharacters;
+	optional<Vector<String>> commitCharacters;
 
 	/// An optional command that is executed *after* inserting this completion.
 	/// *Note* that additional modifications to the current document should
@@ -459,6 +485,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -468,7 +502,7 @@ public:
 
 	CompletionItem(String label,
 		optional<CompletionItemKind> kind,
-		optional<vector<CompletionItemTag>> tags,
+		optional<Vector<CompletionItemTag>> tags,
 		optional<String> detail,
 		optional<variant<String, MarkupContent>> documentation,
 		optional<Boolean> preselect,
@@ -477,8 +511,8 @@ public:
 		optional<String> insertText,
 		optional<InsertTextFormat> insertTextFormat,
 		optional<TextEdit> textEdit,
-		optional<vector<TextEdit>> additionalTextEdits,
-		optional<vector<String>> commitCharacters,
+		optional<Vector<TextEdit>> additionalTextEdits,
+		optional<Vector<String>> commitCharacters,
 		optional<Command> command,
 		optional<Any> data);
 
@@ -503,8 +537,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String isIncompleteKey;
-	const static String itemsKey;
+	const static string_view isIncompleteKey;
+	const static string_view itemsKey;
 
 public:
 	/// This list it not complete. Further typing should result in recomputing
@@ -512,11 +546,11 @@ public:
 	Boolean isIncomplete;
 
 	/// The completion items.
-	vector<CompletionItem> items;
+	Vector<CompletionItem> items;
 
 	// No parsing
 
-	CompletionList(Boolean isIncomplete, vector<CompletionItem> items);
+	CompletionList(Boolean isIncomplete, Vector<CompletionItem> items);
 
 	CompletionList();
 
@@ -555,10 +589,10 @@ public:
 struct CompletionClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String completionItemKey;
-	const static String completionItemKindKey;
-	const static String contextSupportKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view completionItemKey;
+	const static string_view completionItemKindKey;
+	const static string_view contextSupportKey;
 
 public:
 	/// Whether completion supports dynamic registration.
@@ -569,20 +603,25 @@ public:
 	struct CompletionItem: public ObjectT
 	{
 	private:
-		const static String snippetSupportKey;
-		const static String commitCharactersSupportKey;
-		const static String documentationFormatKey;
-		const static String deprecatedSupportKey;
-		const static String preselectSupportKey;
-		const static String tagSupportKey;
+		const static string_view snippetSupportKey;
+		const static string_view commitCharactersSupportKey;
+		const static string_view documentationFormatKey;
+		const static string_view deprecatedSupportKey;
+		const static string_view preselectSupportKey;
+		const static string_view tagSupportKey;
 
 		struct DocumentationFormatMaker: public ObjectT
 		{
 			/// The array to make
-			vector<MarkupKind> &parentArray;
+			Vector<MarkupKind> &parentArray;
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -590,7 +629,7 @@ public:
 
 			//===============================================================//
 
-			DocumentationFormatMaker(vector<MarkupKind> &parentArray);
+			DocumentationFormatMaker(Vector<MarkupKind> &parentArray);
 
 			virtual ~DocumentationFormatMaker();
 		};
@@ -608,7 +647,7 @@ public:
 
 		/// Client supports the follow content formats for the documentation
 		/// property. The order describes the preferred format of the client.
-		optional<vector<MarkupKind>> documentationFormat;
+		optional<Vector<MarkupKind>> documentationFormat;
 
 		/// Client supports the deprecated property on a completion item.
 		optional<Boolean> deprecatedSupport;
@@ -625,15 +664,20 @@ public:
 		struct TagSupport: public ObjectT
 		{
 		private:
-			const static String valueSetKey;
+			const static string_view valueSetKey;
 
 			struct ValueSetMaker: public ObjectT
 			{
 				/// The array to make
-				vector<CompletionItemTag> &parentArray;
+				Vector<CompletionItemTag> &parentArray;
 
 				//====================   Parsing   ==========================//
 
+			protected:
+				/// The static description of the json members
+				const static ObjectDescriptor descriptor;
+
+			public:
 				/// This fills an ObjectInitializer
 				virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -641,18 +685,26 @@ public:
 
 				//===========================================================//
 
-				ValueSetMaker(vector<CompletionItemTag> &parentArray);
+				ValueSetMaker(Vector<CompletionItemTag> &parentArray);
 
 				virtual ~ValueSetMaker();
 			};
 
 		public:
 			/// The tags supported by the client.
-			vector<CompletionItemTag> valueSet;
+			Vector<CompletionItemTag> valueSet;
 
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The json members with a known key
+			const static FieldDescriptor fields[];
+
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -661,7 +713,7 @@ public:
 			//===============================================================//
 
 
-			TagSupport(vector<CompletionItemTag> valueSet);
+			TagSupport(Vector<CompletionItemTag> valueSet);
 
 			TagSupport();
 
@@ -679,6 +731,14 @@ public:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -689,7 +749,7 @@ public:
 
 		CompletionItem(optional<Boolean> snippetSupport,
 			optional<Boolean> commitCharactersSupport,
-			optional<vector<MarkupKind>> documentationFormat,
+			optional<Vector<MarkupKind>> documentationFormat,
 			optional<Boolean> deprecatedSupport,
 			optional<Boolean> preselectSupport,
 			optional<TagSupport> tagSupport);
@@ -706,15 +766,20 @@ public:
 	struct CompletionItemKind: public ObjectT
 	{
 	private:
-		const static String valueSetKey;
+		const static string_view valueSetKey;
 
 		struct ValueSetMaker: public ObjectT
 		{
 			/// The array to make
-			vector<clsp::CompletionItemKind> &parentArray;
+			Vector<clsp::CompletionItemKind> &parentArray;
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -722,7 +787,7 @@ public:
 
 			//===============================================================//
 
-			ValueSetMaker(vector<clsp::CompletionItemKind> &parentArray);
+			ValueSetMaker(Vector<clsp::CompletionItemKind> &parentArray);
 
 			virtual ~ValueSetMaker();
 		};
@@ -735,11 +800,19 @@ public:
 		/// If this property is not present the client only supports
 		/// the completion items kinds from `Text` to `Reference` as defined
 		/// in the initial version of the protocol.
-		optional<vector<clsp::CompletionItemKind>> valueSet;
+		optional<Vector<clsp::CompletionItemKind>> valueSet;
 
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -748,7 +821,7 @@ public:
 		//===================================================================//
 
 
-		CompletionItemKind(optional<vector<clsp::CompletionItemKind>> valueSet);
+		CompletionItemKind(optional<Vector<clsp::CompletionItemKind>> valueSet);
 
 		CompletionItemKind();
 
@@ -764,6 +837,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
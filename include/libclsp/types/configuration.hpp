@@ -32,8 +32,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String scopeUriKey;
-	const static String sectionKey;
+	const static string_view scopeUriKey;
+	const static string_view sectionKey;
 
 public:
 	/// The scope to get the configuration section for.
@@ -58,14 +58,14 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String itemsKey;
+	const static string_view itemsKey;
 
 public:
-	vector<ConfigurationItem> items;
+	Vector<ConfigurationItem> items;
 
 	// No parsing
 
-	ConfigurationParams(vector<ConfigurationItem> items);
+	ConfigurationParams(Vector<ConfigurationItem> items);
 
 	ConfigurationParams();
 
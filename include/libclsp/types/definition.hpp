@@ -36,8 +36,8 @@ using namespace std;
 struct DefinitionClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String linkSupportKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view linkSupportKey;
 
 public:
 	/// Whether declaration supports dynamic registration.
@@ -52,6 +52,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -99,6 +107,11 @@ struct DefinitionParams:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
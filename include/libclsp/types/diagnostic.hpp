@@ -39,8 +39,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String locationKey;
-	const static String messageKey;
+	const static string_view locationKey;
+	const static string_view messageKey;
 
 public:
 	/// The location of this related diagnostic information.
@@ -52,6 +52,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -119,13 +127,13 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String rangeKey;
-	const static String severityKey;
-	const static String codeKey;
-	const static String sourceKey;
-	const static String messageKey;
-	const static String tagsKey;
-	const static String relatedInformationKey;
+	const static string_view rangeKey;
+	const static string_view severityKey;
+	const static string_view codeKey;
+	const static string_view sourceKey;
+	const static string_view messageKey;
+	const static string_view tagsKey;
+	const static string_view relatedInformationKey;
 
 	struct TagsMaker: public ObjectT
 	{
@@ -135,6 +143,11 @@ private:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -151,6 +164,11 @@ private:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -180,15 +198,23 @@ public:
 	/// Additional metadata about the diagnostic.
 	///
 	/// @since 3.15.0
-	optional<vector<DiagnosticTag>> tags;
+	optional<Vector<DiagnosticTag>> tags;
 
 	/// An array of related diagnostic information, e.g. when symbol-names within
 	/// a scope collide all definitions can be marked via this property.
-	optional<vector<DiagnosticRelatedInformation>> relatedInformation;
+	optional<Vector<DiagnosticRelatedInformation>> relatedInformation;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -202,8 +228,8 @@ public:
 		optional<variant<Number, String>> code,
 		optional<String> source,
 		String message,
-		optional<vector<DiagnosticTag>> tags,
-		optional<vector<DiagnosticRelatedInformation>> relatedInformation);
+		optional<Vector<DiagnosticTag>> tags,
+		optional<Vector<DiagnosticRelatedInformation>> relatedInformation);
 
 	Diagnostic();
 
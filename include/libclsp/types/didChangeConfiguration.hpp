@@ -33,7 +33,7 @@ using namespace std;
 struct DidChangeConfigurationClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Did change configuration notification supports dynamic registration.
@@ -42,6 +42,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -66,7 +74,7 @@ public:
 struct DidChangeConfigurationParams: public ObjectT
 {
 private:
-	const static String settingsKey;
+	const static string_view settingsKey;
 
 public:
 	/// The actual changed settings
@@ -75,6 +83,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
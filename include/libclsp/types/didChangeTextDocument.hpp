@@ -42,7 +42,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String syncKindKey;
+	const static string_view syncKindKey;
 
 public:
 	/// How documents are synced to the server. See TextDocumentSyncKind.Full
@@ -76,9 +76,9 @@ public:
 struct TextDocumentContentChangeEvent: public ObjectT
 {
 private:
-	const static String rangeKey;
-	const static String rangeLengthKey;
-	const static String textKey;
+	const static string_view rangeKey;
+	const static string_view rangeLengthKey;
+	const static string_view textKey;
 
 public:
 	/// The range of the document that changed.
@@ -97,6 +97,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -126,17 +134,22 @@ public:
 struct DidChangeTextDocumentParams: public ObjectT
 {
 private:
-	const static String textDocumentKey;
-	const static String contentChangesKey;
+	const static string_view textDocumentKey;
+	const static string_view contentChangesKey;
 
 	struct ContentChangesMaker: public ObjectT
 	{
 
 		/// The array to make
-		vector<TextDocumentContentChangeEvent> &parentArray;
+		Vector<TextDocumentContentChangeEvent> &parentArray;
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -144,7 +157,7 @@ private:
 
 		//===================================================================//
 
-		ContentChangesMaker(vector<TextDocumentContentChangeEvent> &parentArray);
+		ContentChangesMaker(Vector<TextDocumentContentChangeEvent> &parentArray);
 
 		virtual ~ContentChangesMaker();
 	};
@@ -159,11 +172,19 @@ public:
 	/// array index 0) and c2 (at array index 1) for a document in state S then
 	/// c1 moves the document from S to S' and c2 from S' to S''. So c1 is
 	/// computed on the state S and c2 is computed on the state S'.
-	vector<TextDocumentContentChangeEvent> contentChanges;
+	Vector<TextDocumentContentChangeEvent> contentChanges;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -174,7 +195,7 @@ public:
 	// No writing
 
 	DidChangeTextDocumentParams(VersionedTextDocumentIdentifier textDocument,
-		vector<TextDocumentContentChangeEvent> contentChanges);
+		Vector<TextDocumentContentChangeEvent> contentChanges);
 
 	DidChangeTextDocumentParams();
 
@@ -33,7 +33,7 @@ using namespace std;
 struct DidChangeWatchedFilesClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Did change watched files notification supports dynamic registration.
@@ -44,6 +44,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -134,8 +142,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String globPatternKey;
-	const static String kindKey;
+	const static string_view globPatternKey;
+	const static string_view kindKey;
 
 public:
 	/// The  glob pattern to watch.
@@ -175,15 +183,15 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String watchersKey;
+	const static string_view watchersKey;
 
 public:
 	/// The watchers to register.
-	vector<FileSystemWatcher> watchers;
+	Vector<FileSystemWatcher> watchers;
 
 	// No parsing
 
-	DidChangeWatchedFilesRegistrationOptions(vector<FileSystemWatcher> watchers);
+	DidChangeWatchedFilesRegistrationOptions(Vector<FileSystemWatcher> watchers);
 
 	DidChangeWatchedFilesRegistrationOptions();
 
@@ -212,8 +220,8 @@ enum class FileChangeType
 struct FileEvent: public ObjectT
 {
 private:
-	const static String uriKey;
-	const static String typeKey;
+	const static string_view uriKey;
+	const static string_view typeKey;
 
 public:
 	/// The file's URI.
@@ -225,6 +233,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -248,14 +264,19 @@ public:
 struct DidChangeWatchedFilesParams: public ObjectT
 {
 private:
-	const static String changesKey;
+	const static string_view changesKey;
 
 	struct ChangesMaker: public ObjectT
 	{
-		vector<FileEvent> &parentArray;
+		Vector<FileEvent> &parentArray;
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -263,18 +284,26 @@ private:
 
 		//===================================================================//
 
-		ChangesMaker(vector<FileEvent> &parentArray);
+		ChangesMaker(Vector<FileEvent> &parentArray);
 
 		virtual ~ChangesMaker();
 
 	};
 public:
 	/// The actual file events.
-	vector<FileEvent> changes;
+	Vector<FileEvent> changes;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -284,7 +313,7 @@ public:
 
 	// No writing
 
-	DidChangeWatchedFilesParams(vector<FileEvent> changes);
+	DidChangeWatchedFilesParams(Vector<FileEvent> changes);
 
 	DidChangeWatchedFilesParams();
 
@@ -32,16 +32,21 @@ using namespace std;
 struct WorkspaceFoldersChangeEvent: public ObjectT
 {
 private:
-	const static String addedKey;
-	const static String removedKey;;
+	const static string_view addedKey;
+	const static string_view removedKey;;
 
 	struct AddedRemovedMaker: public ObjectT
 	{
 		/// A reference to the vector to make
-		vector<WorkspaceFolder>& parentArray;
+		Vector<WorkspaceFolder>& parentArray;
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -49,21 +54,29 @@ private:
 
 		//===================================================================//
 
-		AddedRemovedMaker(vector<WorkspaceFolder>& parentArray);
+		AddedRemovedMaker(Vector<WorkspaceFolder>& parentArray);
 
 		virtual ~AddedRemovedMaker();
 	};
 
 public:
 	/// The array of added workspace folders
-	vector<WorkspaceFolder> added;
+	Vector<WorkspaceFolder> added;
 
 	/// The array of the removed workspace folders
-	vector<WorkspaceFolder> removed;
+	Vector<WorkspaceFolder> removed;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -73,8 +86,8 @@ public:
 
 	// No writing
 
-	WorkspaceFoldersChangeEvent(vector<WorkspaceFolder> added,
-		vector<WorkspaceFolder> removed);
+	WorkspaceFoldersChangeEvent(Vector<WorkspaceFolder> added,
+		Vector<WorkspaceFolder> removed);
 
 	WorkspaceFoldersChangeEvent();
 
@@ -91,7 +104,7 @@ public:
 struct DidChangeWorkspaceFoldersParams: public ObjectT
 {
 private:
-	const static String eventKey;
+	const static string_view eventKey;
 
 public:
 	/// The actual workspace folder change event.
@@ -100,6 +113,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
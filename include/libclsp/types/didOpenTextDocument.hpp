@@ -32,7 +32,7 @@ using namespace std;
 struct DidOpenTextDocumentParams: public ObjectT
 {
 private:
-	const static String textDocumentKey;
+	const static string_view textDocumentKey;
 
 public:
 	/// The document that was opened.
@@ -41,6 +41,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
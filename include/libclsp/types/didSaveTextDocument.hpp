@@ -35,7 +35,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String includeTextKey;
+	const static string_view includeTextKey;
 
 public:
 	/// The client is supposed to include the content on save.
@@ -61,7 +61,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String includeTextKey;
+	const static string_view includeTextKey;
 
 public:
 	/// The client is supposed to include the content on save.
@@ -87,8 +87,8 @@ public:
 struct DidSaveTextDocumentParams: public ObjectT
 {
 private:
-	const static String textDocumentKey;
-	const static String textKey;
+	const static string_view textDocumentKey;
+	const static string_view textKey;
 
 public:
 	/// The document that was saved.
@@ -101,6 +101,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
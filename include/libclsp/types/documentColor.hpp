@@ -35,7 +35,7 @@ using namespace std;
 struct DocumentColorClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Whether document color supports dynamic registration.
@@ -44,6 +44,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -93,7 +101,7 @@ struct DocumentColorParams:
 	public PartialResultParams
 {
 private:
-	const static String textDocumentKey;
+	const static string_view textDocumentKey;
 
 public:
 	/// The text document.
@@ -102,6 +110,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -137,10 +153,10 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String redKey;
-	const static String greenKey;
-	const static String blueKey;
-	const static String alphaKey;
+	const static string_view redKey;
+	const static string_view greenKey;
+	const static string_view blueKey;
+	const static string_view alphaKey;
 
 public:
 	/// The red component of this color in the range [0-1].
@@ -158,6 +174,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -186,8 +210,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String rangeKey;
-	const static String colorKey;
+	const static string_view rangeKey;
+	const static string_view colorKey;
 
 public:
 	/// The range in the document where this color appears.
@@ -41,9 +41,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String languageKey;
-	const static String schemeKey;
-	const static String patternKey;
+	const static string_view languageKey;
+	const static string_view schemeKey;
+	const static string_view patternKey;
 
 public:
 	/// A language id, like `typescript`.
@@ -75,6 +75,6 @@ public:
 };
 
 /// A document selector is the combination of one or more document filters.
-using DocumentSelector = vector<DocumentFilter>;
+using DocumentSelector = Vector<DocumentFilter>;
 
 }
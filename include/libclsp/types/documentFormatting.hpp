@@ -35,7 +35,7 @@ using namespace std;
 struct DocumentFormattingClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Whether declaration supports dynamic registration.
@@ -44,6 +44,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -99,11 +107,11 @@ public:
 struct FormattingOptions: public ObjectT
 {
 private:
-	const static String tabSizeKey;
-	const static String insertSpacesKey;
-	const static String trimTrailingWhitespaceKey;
-	const static String insertFinalNewlineKey;
-	const static String trimFinalNewlinesKey;
+	const static string_view tabSizeKey;
+	const static string_view insertSpacesKey;
+	const static string_view trimTrailingWhitespaceKey;
+	const static string_view insertFinalNewlineKey;
+	const static string_view trimFinalNewlinesKey;
 
 public:
 	/// Size of a tab in spaces.
@@ -129,11 +137,19 @@ public:
 	optional<Boolean> trimFinalNewlines;
 
 	/// Signature for further properties.
-	map<String, variant<Boolean, Number, String>> extras;
+	Map<String, variant<Boolean, Number, String>> extras;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -148,7 +164,7 @@ public:
 		optional<Boolean> trimTrailingWhitespace,
 		optional<Boolean> insertFinalNewline,
 		optional<Boolean> trimFinalNewlines,
-		map<String, variant<Boolean, Number, String>> extras);
+		Map<String, variant<Boolean, Number, String>> extras);
 
 	FormattingOptions();
 
@@ -164,8 +180,8 @@ public:
 struct DocumentFormattingParams: public WorkDoneProgressParams
 {
 private:
-	const static String textDocumentKey;
-	const static String optionsKey;
+	const static string_view textDocumentKey;
+	const static string_view optionsKey;
 
 public:
 	/// The document to format.
@@ -177,6 +193,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -34,7 +34,7 @@ using namespace std;
 struct DocumentHighlightClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Whether declaration supports dynamic registration.
@@ -43,6 +43,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -91,6 +99,11 @@ struct DocumentHighlightParams:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -133,8 +146,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String rangeKey;
-	const static String kindKey;
+	const static string_view rangeKey;
+	const static string_view kindKey;
 
 public:
 	/// The range this highlight applies to.
@@ -38,8 +38,8 @@ using namespace std;
 struct DocumentLinkClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String tooltipSupportKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view tooltipSupportKey;
 
 public:
 	/// Whether code action supports dynamic registration.
@@ -53,6 +53,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -81,7 +89,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String resolveProviderKey;
+	const static string_view resolveProviderKey;
 
 public:
 	/// Code lens has a resolve provider as well.
@@ -127,7 +135,7 @@ struct DocumentLinkParams:
 	public PartialResultParams
 {
 private:
-	const static String textDocumentKey;
+	const static string_view textDocumentKey;
 
 public:
 	/// The document to provide document links for.
@@ -136,6 +144,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -172,10 +188,10 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String rangeKey;;
-	const static String targetKey;
-	const static String tooltipKey;;
-	const static String dataKey;
+	const static string_view rangeKey;;
+	const static string_view targetKey;
+	const static string_view tooltipKey;;
+	const static string_view dataKey;
 
 public:
 	/// The range this link applies to.
@@ -30,7 +30,7 @@ using namespace std;
 struct DocumentOnTypeFormattingClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Whether declaration supports dynamic registration.
@@ -39,6 +39,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -69,20 +77,20 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String firstTriggerCharacterKey;
-	const static String moreTriggerCharacterKey;
+	const static string_view firstTriggerCharacterKey;
+	const static string_view moreTriggerCharacterKey;
 
 public:
 	/// A character on which formatting should be triggered, like `}`.
 	String firstTriggerCharacter;
 
 	/// More trigger characters.
-	optional<vector<String>> moreTriggerCharacter;
+	optional<Vector<String>> moreTriggerCharacter;
 
 	// No parsing
 
 	DocumentOnTypeFormattingOptions(String firstTriggerCharacter,
-		optional<vector<String>> moreTriggerCharacter);
+		optional<Vector<String>> moreTriggerCharacter);
 
 	DocumentOnTypeFormattingOptions();
 
@@ -103,7 +111,7 @@ public:
 	DocumentOnTypeFormattingRegistrationOptions(
 		variant<DocumentSelector, Null> documentSelector,
 		String firstTriggerCharacter,
-		optional<vector<String>> moreTriggerCharacter);
+		optional<Vector<String>> moreTriggerCharacter);
 
 	DocumentOnTypeFormattingRegistrationOptions();
 
@@ -119,8 +127,8 @@ public:
 struct DocumentOnTypeFormattingParams: public TextDocumentPositionParams
 {
 private:
-	const static String chKey;
-	const static String optionsKey;
+	const static string_view chKey;
+	const static string_view optionsKey;
 
 public:
 	/// The character that has been typed.
@@ -132,6 +140,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
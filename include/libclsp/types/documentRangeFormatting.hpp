@@ -30,7 +30,7 @@ using namespace std;
 struct DocumentRangeFormattingClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Whether declaration supports dynamic registration.
@@ -39,6 +39,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -89,9 +97,9 @@ public:
 struct DocumentRangeFormattingParams: public WorkDoneProgressParams
 {
 private:
-	const static String textDocumentKey;
-	const static String rangeKey;
-	const static String optionsKey;
+	const static string_view textDocumentKey;
+	const static string_view rangeKey;
+	const static string_view optionsKey;
 
 public:
 	/// The document to format.
@@ -106,6 +114,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -73,9 +73,9 @@ enum class SymbolKind
 struct DocumentSymbolClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String symbolKindKey;
-	const static String hierarchicalDocumentSymbolSupportKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view symbolKindKey;
+	const static string_view hierarchicalDocumentSymbolSupportKey;
 
 public:
 	/// Whether declaration supports dynamic registration.
@@ -86,14 +86,19 @@ public:
 	struct SymbolKind: public ObjectT
 	{
 	private:
-		const static String valueSetKey;
+		const static string_view valueSetKey;
 
 		struct ValueSetMaker: public ObjectT
 		{
-			vector<clsp::SymbolKind> &parentArray;
+			Vector<clsp::SymbolKind> &parentArray;
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -101,7 +106,7 @@ public:
 
 			//===============================================================//
 
-			ValueSetMaker(vector<clsp::SymbolKind> &parentArray);
+			ValueSetMaker(Vector<clsp::SymbolKind> &parentArray);
 
 			virtual ~ValueSetMaker();
 		};
@@ -114,11 +119,19 @@ public:
 		/// If this property is not present the client only supports
 		/// the symbol kinds from `File` to `Array` as defined in
 		/// the initial version of the protocol.
-		optional<vector<clsp::SymbolKind>> valueSet;
+		optional<Vector<clsp::SymbolKind>> valueSet;
 
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -127,7 +140,7 @@ public:
 		//===================================================================//
 
 
-		SymbolKind(optional<vector<clsp::SymbolKind>> valueSet);
+		SymbolKind(optional<Vector<clsp::SymbolKind>> valueSet);
 
 		SymbolKind();
 
@@ -144,6 +157,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -194,7 +215,7 @@ struct DocumentSymbolParams:
 	public PartialResultParams
 {
 private:
-	const static String textDocumentKey;
+	const static string_view textDocumentKey;
 
 public:
 	/// The text document.
@@ -203,6 +224,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -248,13 +277,13 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String nameKey;
-	const static String detailKey;
-	const static String kindKey;
-	const static String deprecatedKey;
-	const static String rangeKey;
-	const static String selectionRangeKey;
-	const static String childrenKey;
+	const static string_view nameKey;
+	const static string_view detailKey;
+	const static string_view kindKey;
+	const static string_view deprecatedKey;
+	const static string_view rangeKey;
+	const static string_view selectionRangeKey;
+	const static string_view childrenKey;
 
 public:
 	/// The name of this symbol. Will be displayed in the user interface and
@@ -282,7 +311,7 @@ public:
 	Range selectionRange;
 
 	/// Children of this symbol, e.g. properties of a class.
-	optional<vector<DocumentSymbol>> children;
+	optional<Vector<DocumentSymbol>> children;
 
 	// No parsing
 
@@ -292,7 +321,7 @@ public:
 		optional<Boolean> deprecated,
 		Range range,
 		Range selectionRange,
-		optional<vector<DocumentSymbol>> children);
+		optional<Vector<DocumentSymbol>> children);
 
 	DocumentSymbol();
 
@@ -319,11 +348,11 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String nameKey;
-	const static String kindKey;
-	const static String deprecatedKey;
-	const static String locationKey;
-	const static String containerNameKey;
+	const static string_view nameKey;
+	const static string_view kindKey;
+	const static string_view deprecatedKey;
+	const static string_view locationKey;
+	const static string_view containerNameKey;
 
 public:
 	/// The name of this symbol.
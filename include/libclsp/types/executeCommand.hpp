@@ -32,7 +32,7 @@ using namespace std;
 struct ExecuteCommandClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Execute command supports dynamic registration.
@@ -41,6 +41,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -68,16 +76,16 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String commandsKey;
+	const static string_view commandsKey;
 
 public:
 	/// The commands to be executed on the server
-	vector<String> commands;
+	Vector<String> commands;
 
 	// No parsing
 
 	ExecuteCommandOptions(optional<Boolean> workDoneProgress,
-		vector<String> commands);
+		Vector<String> commands);
 
 	ExecuteCommandOptions();
 
@@ -96,8 +104,8 @@ using ExecuteCommandRegistrationOptions = ExecuteCommandOptions; // No parsing
 struct ExecuteCommandParams: public WorkDoneProgressParams
 {
 private:
-	const static String commandKey;
-	const static String argumentsKey;
+	const static string_view commandKey;
+	const static string_view argumentsKey;
 
 public:
 	/// The identifier of the actual command handler.
@@ -109,6 +117,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -38,8 +38,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String overwriteKey;
-	const static String ignoreIfExistsKey;
+	const static string_view overwriteKey;
+	const static string_view ignoreIfExistsKey;
 
 public:
 	/// Overwrite existing file. Overwrite wins over `ignoreIfExists`
@@ -72,8 +72,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String uriKey;
-	const static String optionsKey;
+	const static string_view uriKey;
+	const static string_view optionsKey;
 
 public:
 	/// A create
@@ -107,8 +107,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String overwriteKey;
-	const static String ignoreIfExistsKey;
+	const static string_view overwriteKey;
+	const static string_view ignoreIfExistsKey;
 
 public:
 	/// Overwrite existing file. Overwrite wins over `ignoreIfExists`
@@ -143,9 +143,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String oldUriKey;
-	const static String newUriKey;
-	const static String optionsKey;
+	const static string_view oldUriKey;
+	const static string_view newUriKey;
+	const static string_view optionsKey;
 
 public:
 	/// A rename
@@ -184,8 +184,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String recursiveKey;
-	const static String ignoreIfNotExistsKey;
+	const static string_view recursiveKey;
+	const static string_view ignoreIfNotExistsKey;
 
 public:
 	/// Delete the content recursively if a folder is denoted.
@@ -219,8 +219,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String uriKey;
-	const static String optionsKey;
+	const static string_view uriKey;
+	const static string_view optionsKey;
 
 public:
 	/// A delete
@@ -42,9 +42,9 @@ using namespace std;
 struct FoldingRangeClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String rangeLimitKey;
-	const static String lineFoldingOnlyKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view rangeLimitKey;
+	const static string_view lineFoldingOnlyKey;
 
 public:
 	/// Whether implementation supports dynamic registration. If this is set to
@@ -65,6 +65,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -116,7 +124,7 @@ struct FoldingRangeParams:
 	public PartialResultParams
 {
 private:
-	const static String textDocumentKey;
+	const static string_view textDocumentKey;
 
 public:
 	/// The text document.
@@ -125,6 +133,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -195,11 +211,11 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String startLineKey;
-	const static String startCharacterKey;
-	const static String endLineKey;
-	const static String endCharacterKey;
-	const static String kindKey;
+	const static string_view startLineKey;
+	const static string_view startCharacterKey;
+	const static string_view endLineKey;
+	const static string_view endCharacterKey;
+	const static string_view kindKey;
 
 public:
 	/// The zero-based line number from where the folded range starts.
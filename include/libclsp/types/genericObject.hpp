@@ -31,6 +31,11 @@ struct ArrayMaker: public ObjectT
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -48,65 +53,71 @@ struct ArrayMaker: public ObjectT
 template <typename Object>
 struct ObjectArrayMaker: public ObjectT
 {
-	vector<Object> &parentArray;
+	Vector<Object> &parentArray;
 
 
 	//====================   Parsing   ==============================//
 
+protected:
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer)
 	{
-		// ObjectMaker
-		initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-		auto* handler = initializer.handler;
+		initializer.bind(this, descriptor);
+	}
 
-		auto& extraSetter = initializer.extraSetter;
+	// Using default isValid()
 
-		// Value setters
+	//===============================================================//
 
-		// Object[]
-		extraSetter =
-		{
-			// String
-			nullopt,
 
-			// Number
-			nullopt,
+	ObjectArrayMaker(Vector<Object> &parentArray):
+		parentArray(parentArray)
+	{};
 
-			// Boolean
-			nullopt,
+	virtual ~ObjectArrayMaker(){};
+};
 
-			// Null
-			nullopt,
+template <typename Object>
+constexpr ObjectDescriptor ObjectArrayMaker<Object>::descriptor =
+{
+	// Fields
+	nullptr,
 
-			// Array
-			nullopt,
+	// Extra setter
+	// Object[]
+	{
+		// String
+		nullptr,
 
-			// Object
-			[this, handler]()
-			{
-				auto& obj = parentArray.emplace_back();
+		// Number
+		nullptr,
 
-				handler->pushInitializer();
-				obj.fillInitializer(handler->objectStack.top());
-			}
-		};
+		// Boolean
+		nullptr,
 
-		// This
-		initializer.object = this;
-	}
+		// Null
+		nullptr,
 
-	// Using default isValid()
+		// Array
+		nullptr,
 
-	//===============================================================//
+		// Object
+		[](void* object, JsonHandler& handler)
+		{
+			auto& self = *static_cast<ObjectArrayMaker*>(object);
 
+			auto& obj = self.parentArray.emplace_back();
 
-	ObjectArrayMaker<Object>(vector<Object> &parentArray):
-		parentArray(parentArray)
-	{};
+			handler.pushObject(obj);
+		}
+	},
 
-	virtual ~ObjectArrayMaker<Object>(){};
+	// Parents
+	{}
 };
 
 /// An object with no predefined key-value pairs.
@@ -118,11 +129,17 @@ protected:
 
 public:
 	/// Key-value pairs of anything
-	map<String, Any> children;
+	Map<String, Any> children;
 
 
 	//====================   Parsing   ======================================//
 
+	/// The static description of the json members.
+	///
+	/// It's public so other makers can send their unknown members to a
+	/// GenericObject.
+	const static ObjectDescriptor descriptor;
+
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -136,7 +153,7 @@ public:
 	//=======================================================================//
 
 
-	GenericObject(map<String, Any> children);
+	GenericObject(Map<String, Any> children);
 
 	GenericObject();
 
@@ -38,15 +38,20 @@ using namespace std;
 struct HoverClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String contentFormatKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view contentFormatKey;
 
 	struct ContentFormatMaker: public ObjectT
 	{
-		vector<MarkupKind> &parentArray;
+		Vector<MarkupKind> &parentArray;
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -54,7 +59,7 @@ private:
 
 		//===================================================================//
 
-		ContentFormatMaker(vector<MarkupKind> &parentArray);
+		ContentFormatMaker(Vector<MarkupKind> &parentArray);
 
 		virtual ~ContentFormatMaker();
 	};
@@ -64,11 +69,19 @@ public:
 
 	/// Client supports the follow content formats for the content
 	/// property. The order describes the preferred format of the client.
-	optional<vector<MarkupKind>> contentFormat;
+	optional<Vector<MarkupKind>> contentFormat;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -79,7 +92,7 @@ public:
 	// No writing
 
 	HoverClientCapabilities(optional<Boolean> dynamicRegistration,
-		optional<vector<MarkupKind>> contentFormat);
+		optional<Vector<MarkupKind>> contentFormat);
 
 	HoverClientCapabilities();
 
@@ -118,6 +131,11 @@ struct HoverParams:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -143,8 +161,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String languageKey;
-	const static String valueKey;
+	const static string_view languageKey;
+	const static string_view valueKey;
 
 public:
 	String language;
@@ -192,12 +210,12 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String contentsKey;
-	const static String rangeKey;
+	const static string_view contentsKey;
+	const static string_view rangeKey;
 
 public:
 	/// The hover's content
-	variant<MarkedString, vector<MarkedString>, MarkupContent> contents;
+	variant<MarkedString, Vector<MarkedString>, MarkupContent> contents;
 
 	/// An optional range is a range inside a text document
 	/// that is used to visualize a hover, e.g. by changing the background color.
@@ -206,7 +224,7 @@ public:
 	// No parsing
 
 	[[deprecated("Use MarkupContent instead.")]]
-	Hover(variant<MarkedString, vector<MarkedString>, MarkupContent> contents,
+	Hover(variant<MarkedString, Vector<MarkedString>, MarkupContent> contents,
 		optional<Range> range);
 
 	Hover(MarkupContent contents, optional<Range> range);
@@ -102,28 +102,28 @@ using namespace std;
 struct TextDocumentClientCapabilities: public ObjectT
 {
 private:
-	const static String synchronizationKey;
-	const static String completionKey;
-	const static String hoverKey;
-	const static String signatureHelpKey;
-	const static String declarationKey;
-	const static String definitionKey;
-	const static String typeDefinitionKey;
-	const static String implementationKey;
-	const static String referencesKey;
-	const static String documentHighlightKey;
-	const static String documentSymbolKey;
-	const static String codeActionKey;
-	const static String codeLensKey;
-	const static String documentLinkKey;
-	const static String colorProviderKey;
-	const static String formattingKey;
-	const static String rangeFormattingKey;
-	const static String onTypeFormattingKey;
-	const static String renameKey;
-	const static String publishDiagnosticsKey;
-	const static String foldingRangeKey;
-	const static String selectionRangeKey;
+	const static string_view synchronizationKey;
+	const static string_view completionKey;
+	const static string_view hoverKey;
+	const static string_view signatureHelpKey;
+	const static string_view declarationKey;
+	const static string_view definitionKey;
+	const static string_view typeDefinitionKey;
+	const static string_view implementationKey;
+	const static string_view referencesKey;
+	const static string_view documentHighlightKey;
+	const static string_view documentSymbolKey;
+	const static string_view codeActionKey;
+	const static string_view codeLensKey;
+	const static string_view documentLinkKey;
+	const static string_view colorProviderKey;
+	const static string_view formattingKey;
+	const static string_view rangeFormattingKey;
+	const static string_view onTypeFormattingKey;
+	const static string_view renameKey;
+	const static string_view publishDiagnosticsKey;
+	const static string_view foldingRangeKey;
+	const static string_view selectionRangeKey;
 
 public:
 	optional<TextDocumentSyncClientCapabilities> synchronization;
@@ -207,6 +207,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -276,23 +284,23 @@ public:
 struct ClientCapabilities: public ObjectT
 {
 private:
-	const static String workspaceKey;
-	const static String textDocumentKey;
-	const static String experimentalKey;
+	const static string_view workspaceKey;
+	const static string_view textDocumentKey;
+	const static string_view experimentalKey;
 
 public:
 	/// Workspace specific client capabilities.
 	struct Workspace: public ObjectT
 	{
 	private:
-		const static String applyEditKey;
-		const static String workspaceEditKey;
-		const static String didChangeConfigurationKey;
-		const static String didChangeWatchedFilesKey;
-		const static String symbolKey;
-		const static String executeCommandKey;
-		const static String workspaceFoldersKey;
-		const static String configurationKey;
+		const static string_view applyEditKey;
+		const static string_view workspaceEditKey;
+		const static string_view didChangeConfigurationKey;
+		const static string_view didChangeWatchedFilesKey;
+		const static string_view symbolKey;
+		const static string_view executeCommandKey;
+		const static string_view workspaceFoldersKey;
+		const static string_view configurationKey;
 
 	public:
 		/// The client supports applying batch edits
@@ -330,6 +338,14 @@ public:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -362,11 +378,19 @@ public:
 	optional<Any> experimental;
 
 	/// Extra capabilities
-	map<Key, Any> extra;
+	Map<Key, Any> extra;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -379,7 +403,7 @@ public:
 	ClientCapabilities(optional<Workspace> workspace,
 		optional<TextDocumentClientCapabilities> textDocument,
 		optional<Any> experimental,
-		map<Key, Any> extra);
+		Map<Key, Any> extra);
 
 	ClientCapabilities();
 
@@ -454,21 +478,26 @@ public:
 struct InitializeParams: public WorkDoneProgressParams
 {
 private:
-	const static String processIdKey;
-	const static String clientInfoKey;
-	const static String rootPathKey;
-	const static String rootUriKey;
-	const static String initializationOptionsKey;
-	const static String capabilitiesKey;
-	const static String traceKey;
-	const static String workspaceFoldersKey;
+	const static string_view processIdKey;
+	const static string_view clientInfoKey;
+	const static string_view rootPathKey;
+	const static string_view rootUriKey;
+	const static string_view initializationOptionsKey;
+	const static string_view capabilitiesKey;
+	const static string_view traceKey;
+	const static string_view workspaceFoldersKey;
 
 	struct WorkspaceFoldersMaker: public ObjectT
 	{
-		vector<WorkspaceFolder> &parentArray;
+		Vector<WorkspaceFolder> &parentArray;
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -476,7 +505,7 @@ private:
 
 		//===================================================================//
 
-		WorkspaceFoldersMaker(vector<WorkspaceFolder> &parentArray);
+		WorkspaceFoldersMaker(Vector<WorkspaceFolder> &parentArray);
 
 		virtual ~WorkspaceFoldersMaker();
 	};
@@ -494,8 +523,8 @@ public:
 	struct ClientInfo: public ObjectT
 	{
 	private:
-		const static String nameKey;
-		const static String versionKey;
+		const static string_view nameKey;
+		const static string_view versionKey;
 
 	public:
 		/// The name of the client as defined by the client.
@@ -507,6 +536,14 @@ public:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -554,11 +591,19 @@ public:
 	/// but none are configured.
 	///
 	/// @since 3.6.0
-	optional<variant<vector<WorkspaceFolder>, Null>> workspaceFolders;
+	optional<variant<Vector<WorkspaceFolder>, Null>> workspaceFolders;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -576,7 +621,7 @@ public:
 		optional<Any> initializationOptions,
 		ClientCapabilities capabilities,
 		optional<TraceKind> trace,
-		optional<variant<vector<WorkspaceFolder>, Null>> workspaceFolders);
+		optional<variant<Vector<WorkspaceFolder>, Null>> workspaceFolders);
 
 	InitializeParams(optional<ProgressToken> workDoneToken,
 		variant<Number, Null> processId,
@@ -585,7 +630,7 @@ public:
 		optional<Any> initializationOptions,
 		ClientCapabilities capabilities,
 		optional<TraceKind> trace,
-		optional<variant<vector<WorkspaceFolder>, Null>> workspaceFolders);
+		optional<variant<Vector<WorkspaceFolder>, Null>> workspaceFolders);
 
 	InitializeParams();
 
@@ -656,31 +701,31 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String textDocumentSyncKey;
-	const static String completionProviderKey;
-	const static String hoverProviderKey;
-	const static String signatureHelpProviderKey;
-	const static String declarationProviderKey;
-	const static String definitionProviderKey;
-	const static String typeDefinitionProviderKey;
-	const static String implementationProviderKey;
-	const static String referencesProviderKey;
-	const static String documentHighlightProviderKey;
-	const static String documentSymbolProviderKey;
-	const static String codeActionProviderKey;
-	const static String codeLensProviderKey;
-	const static String documentLinkProviderKey;
-	const static String colorProviderKey;
-	const static String documentFormattingProviderKey;
-	const static String documentRangeFormattingProviderKey;
-	const static String documentOnTypeFormattingProviderKey;
-	const static String renameProviderKey;
-	const static String foldingRangeProviderKey;
-	const static String executeCommandProviderKey;
-	const static String selectionRangeProviderKey;
-	const static String workspaceSymbolProviderKey;
-	const static String workspaceKey;
-	const static String experimentalKey;
+	const static string_view textDocumentSyncKey;
+	const static string_view completionProviderKey;
+	const static string_view hoverProviderKey;
+	const static string_view signatureHelpProviderKey;
+	const static string_view declarationProviderKey;
+	const static string_view definitionProviderKey;
+	const static string_view typeDefinitionProviderKey;
+	const static string_view implementationProviderKey;
+	const static string_view referencesProviderKey;
+	const static string_view documentHighlightProviderKey;
+	const static string_view documentSymbolProviderKey;
+	const static string_view codeActionProviderKey;
+	const static string_view codeLensProviderKey;
+	const static string_view documentLinkProviderKey;
+	const static string_view colorProviderKey;
+	const static string_view documentFormattingProviderKey;
+	const static string_view documentRangeFormattingProviderKey;
+	const static string_view documentOnTypeFormattingProviderKey;
+	const static string_view renameProviderKey;
+	const static string_view foldingRangeProviderKey;
+	const static string_view executeCommandProviderKey;
+	const static string_view selectionRangeProviderKey;
+	const static string_view workspaceSymbolProviderKey;
+	const static string_view workspaceKey;
+	const static string_view experimentalKey;
 
 public:
 	/// Defines how text documents are synced. Is either a detailed structure
@@ -794,7 +839,7 @@ public:
 		virtual void partialWrite(JsonWriter &writer);
 
 	private:
-		const static String workspaceFoldersKey;
+		const static string_view workspaceFoldersKey;
 
 	public:
 		/// The server supports workspace folder.
@@ -904,8 +949,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String capabilitiesKey;
-	const static String serverInfoKey;
+	const static string_view capabilitiesKey;
+	const static string_view serverInfoKey;
 
 public:
 	/// The capabilities the language server provides.
@@ -921,8 +966,8 @@ public:
 		virtual void partialWrite(JsonWriter &writer);
 
 	private:
-		const static String nameKey;
-		const static String versionKey;
+		const static string_view nameKey;
+		const static string_view versionKey;
 
 	public:
 		/// The name of the server as defined by the server.
@@ -966,7 +1011,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String retryKey;
+	const static string_view retryKey;
 
 public:
 	/// Indicates whether the client execute the following retry logic:
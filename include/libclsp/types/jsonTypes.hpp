@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <variant>
 #include <vector>
 #include <memory>
 
+#include <libclsp/types/allocator.hpp>
+
 namespace clsp
 {
 
@@ -28,15 +31,22 @@ class ObjectT;
 
 using namespace std;
 
+/// Containers of the json types, see Allocator
+template<class T>
+using Vector = vector<T, Allocator<T>>;
+
+template<class K, class V>
+using Map = map<K, V, less<K>, Allocator<pair<const K, V>>>;
+
 /// Primitive json-rpc types
-using String  = string;
+using String  = basic_string<char, char_traits<char>, Allocator<char>>;
 using Number  = variant<int, double>;
 using Boolean = bool;
 using Null    = monostate;
 
 /// Structured json-rpc types
 using Object = shared_ptr<ObjectT>; // Types in variant have to be CopyConstructible
-using Array = vector<variant<String, Number, Boolean, Null, Object>>;
+using Array = Vector<variant<String, Number, Boolean, Null, Object>>;
 
 /// A collection of all json-rpc types
 using Any = variant<String, Number, Boolean, Null, Object, Array>;
@@ -48,6 +58,13 @@ using ProgressToken = variant<Number, String>;
 /// A utility type
 using Key = const String;
 
+/// Makes an Object with the Allocator of the json types
+template<class T, class... Args>
+shared_ptr<T> makeObject(Args&&... args)
+{
+	return allocate_shared<T>(Allocator<T>(), forward<Args>(args)...);
+}
+
 
 // Some operator overloads for the Number type
 
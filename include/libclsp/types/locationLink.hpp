@@ -43,10 +43,10 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String originSelectionRangeKey;
-	const static String targetUriKey;
-	const static String targetRangeKey;
-	const static String targetSelectionRangeKey;
+	const static string_view originSelectionRangeKey;
+	const static string_view targetUriKey;
+	const static string_view targetRangeKey;
+	const static string_view targetSelectionRangeKey;
 
 public:
 	/// Span of the origin of this link.
@@ -72,6 +72,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -37,8 +37,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String typeKey;
-	const static String messageKey;
+	const static string_view typeKey;
+	const static string_view messageKey;
 
 public:
 	/// The message type. See {@link MessageType}
@@ -89,8 +89,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String kindKey;
-	const static String valueKey;
+	const static string_view kindKey;
+	const static string_view valueKey;
 
 public:
 	/// The type of the Markup
@@ -102,6 +102,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
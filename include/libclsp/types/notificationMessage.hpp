@@ -40,8 +40,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String methodKey;
-	const static String paramsKey;
+	const static string_view methodKey;
+	const static string_view paramsKey;
 
 public:
 	/// The method to be invoked.
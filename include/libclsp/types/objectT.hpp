@@ -20,6 +20,7 @@
 
 #include <libclsp/server/jsonHandler.hpp>
 #include <libclsp/server/jsonWriter.hpp>
+#include <libclsp/server/objectDescriptor.hpp>
 
 namespace clsp
 {
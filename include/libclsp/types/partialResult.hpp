@@ -37,7 +37,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String partialResultTokenKey;
+	const static string_view partialResultTokenKey;
 
 public:
 	/// An optional token that a server can use to report partial results
@@ -47,6 +47,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -40,8 +40,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String lineKey;
-	const static String characterKey;
+	const static string_view lineKey;
+	const static string_view characterKey;
 
 public:
 
@@ -59,6 +59,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -37,9 +37,9 @@ using namespace std;
 struct PublishDiagnosticsClientCapabilities: public ObjectT
 {
 private:
-	const static String relatedInformationKey;
-	const static String tagSupportKey;
-	const static String versionSupportKey;
+	const static string_view relatedInformationKey;
+	const static string_view tagSupportKey;
+	const static string_view versionSupportKey;
 public:
 
 	/// Whether the clients accepts diagnostics with related information.
@@ -53,15 +53,20 @@ public:
 	struct TagSupport: public ObjectT
 	{
 	private:
-		const static String valueSetKey;
+		const static string_view valueSetKey;
 
 		struct ValueSetMaker: public ObjectT
 		{
 			/// The array to make
-			vector<DiagnosticTag>& parentArray;
+			Vector<DiagnosticTag>& parentArray;
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -69,16 +74,24 @@ public:
 
 			//===============================================================//
 
-			ValueSetMaker(vector<DiagnosticTag>& parentArray);
+			ValueSetMaker(Vector<DiagnosticTag>& parentArray);
 			virtual ~ValueSetMaker();
 		};
 	public:
 		/// The tags supported by the client.
-		vector<DiagnosticTag> valueSet;
+		Vector<DiagnosticTag> valueSet;
 
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -87,7 +100,7 @@ public:
 		//===================================================================//
 
 
-		TagSupport(vector<DiagnosticTag> valueSet);
+		TagSupport(Vector<DiagnosticTag> valueSet);
 
 		TagSupport();
 
@@ -110,6 +123,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -143,9 +164,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String uriKey;
-	const static String versionKey;
-	const static String diagnosticsKey;
+	const static string_view uriKey;
+	const static string_view versionKey;
+	const static string_view diagnosticsKey;
 
 public:
 	/// The URI for which diagnostic information is reported.
@@ -158,13 +179,13 @@ public:
 	optional<Number> version;
 
 	/// An array of diagnostic information items.
-	vector<Diagnostic> diagnostics;
+	Vector<Diagnostic> diagnostics;
 
 	// No parsing
 
 	PublishDiagnosticsParams(DocumentUri uri,
 		optional<Number> version,
-		vector<Diagnostic> diagnostics);
+		Vector<Diagnostic> diagnostics);
 
 	PublishDiagnosticsParams();
 
@@ -33,7 +33,7 @@ using namespace std;
 struct ReferenceClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Whether declaration supports dynamic registration.
@@ -42,6 +42,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -88,7 +96,7 @@ public:
 struct ReferenceContext: public ObjectT
 {
 private:
-	const static String includeDeclarationKey;
+	const static string_view includeDeclarationKey;
 
 public:
 	Boolean includeDeclaration;
@@ -96,6 +104,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -122,7 +138,7 @@ struct ReferenceParams:
 	public PartialResultParams
 {
 private:
-	const static String contextKey;
+	const static string_view contextKey;
 
 public:
 	ReferenceContext context;
@@ -130,6 +146,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
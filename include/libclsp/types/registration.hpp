@@ -40,9 +40,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String idKey;
-	const static String methodKey;
-	const static String registerOptionsKey;
+	const static string_view idKey;
+	const static string_view methodKey;
+	const static string_view registerOptionsKey;
 
 public:
 	/// The id used to register the request. The id can be used to deregister
@@ -81,14 +81,14 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String registrationsKey;
+	const static string_view registrationsKey;
 
 public:
-	vector<Registration> registrations;
+	Vector<Registration> registrations;
 
 	// No parsing
 
-	RegistrationParams(vector<Registration> registrations);
+	RegistrationParams(Vector<Registration> registrations);
 
 	RegistrationParams();
 
@@ -109,8 +109,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String idKey;
-	const static String methodKey;
+	const static string_view idKey;
+	const static string_view methodKey;
 
 public:
 	/// The id used to unregister the request or notification. Usually an id
@@ -141,17 +141,17 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String unregisterationsKey;
+	const static string_view unregisterationsKey;
 
 public:
 	/// This should correctly be named `unregistrations`. However changing this
 	/// is a breaking change and needs to wait until we deliver a 4.x version
 	/// of the specification.
-	vector<Unregistration> unregisterations;
+	Vector<Unregistration> unregisterations;
 
 	// No parsing
 
-	UnregistrationParams(vector<Unregistration> unregisterations);
+	UnregistrationParams(Vector<Unregistration> unregisterations);
 
 	UnregistrationParams();
 
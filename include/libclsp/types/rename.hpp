@@ -36,8 +36,8 @@ using namespace std;
 struct RenameClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String prepareSupportKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view prepareSupportKey;
 
 public:
 	/// Whether declaration supports dynamic registration.
@@ -52,6 +52,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -81,7 +89,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String prepareProviderKey;
+	const static string_view prepareProviderKey;
 
 public:
 	/// Renames should be checked and tested before being executed.
@@ -126,7 +134,7 @@ struct RenameParams: public TextDocumentPositionParams,
 	public WorkDoneProgressParams
 {
 private:
-	const static String newNameKey;
+	const static string_view newNameKey;
 
 public:
 	/// The new name of the symbol. If the given name is not valid the
@@ -137,6 +145,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -41,19 +41,19 @@ using namespace std;
 struct RequestMessage: public Message
 {
 
-	const static String idKey;
+	const static string_view idKey;
 
 	/// The request id.
 	variant<Number, String> id;
 
 
-	const static String methodKey;
+	const static string_view methodKey;
 
 	/// The method to be invoked.
 	String method;
 
 
-	const static String paramsKey;
+	const static string_view paramsKey;
 
 	/// The method's params.
 	optional<any> params;
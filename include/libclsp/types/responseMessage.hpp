@@ -57,19 +57,19 @@ enum class ErrorCodes
 ///
 struct ResponseError: public ObjectT
 {
-	const static String codeKey;
+	const static string_view codeKey;
 
 	/// A number indicating the error type that occurred.
 	ErrorCodes code;
 
 
-	const static String messageKey;
+	const static string_view messageKey;
 
 	/// A string providing a short description of the error.
 	String message;
 
 
-	const static String dataKey;
+	const static string_view dataKey;
 
 	/// A Primitive or Structured value that contains additional
 	/// information about the error. Can be omitted.
@@ -108,9 +108,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String idKey;
-	const static String resultKey;
-	const static String errorKey;
+	const static string_view idKey;
+	const static string_view resultKey;
+	const static string_view errorKey;
 
 public:
 	/// The request id.
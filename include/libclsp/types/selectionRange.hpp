@@ -35,7 +35,7 @@ using namespace std;
 struct SelectionRangeClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
+	const static string_view dynamicRegistrationKey;
 
 public:
 	/// Whether declaration supports dynamic registration. If this is set to
@@ -46,6 +46,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -95,15 +103,20 @@ struct SelectionRangeParams:
 	public PartialResultParams
 {
 private:
-	const static String textDocumentKey;
-	const static String positionsKey;
+	const static string_view textDocumentKey;
+	const static string_view positionsKey;
 
 	struct PositionsMaker: public ObjectT
 	{
-		vector<Position> &parentArray;
+		Vector<Position> &parentArray;
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -111,7 +124,7 @@ private:
 
 		//===================================================================//
 
-		PositionsMaker(vector<Position> &parentArray);
+		PositionsMaker(Vector<Position> &parentArray);
 
 		virtual ~PositionsMaker();
 	};
@@ -120,11 +133,19 @@ public:
 	TextDocumentIdentifier textDocument;
 
 	/// The positions inside the text document.
-	vector<Position> positions;
+	Vector<Position> positions;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -137,7 +158,7 @@ public:
 	SelectionRangeParams(optional<ProgressToken> workDoneToken,
 		optional<ProgressToken> partialResultToken,
 		TextDocumentIdentifier textDocument,
-		vector<Position> positions);
+		Vector<Position> positions);
 
 	SelectionRangeParams();
 
@@ -157,8 +178,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String rangeKey;
-	const static String parentKey;
+	const static string_view rangeKey;
+	const static string_view parentKey;
 
 public:
 	/// The range of this selection range.
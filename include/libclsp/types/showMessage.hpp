@@ -55,8 +55,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String typeKey;
-	const static String messageKey;
+	const static string_view typeKey;
+	const static string_view messageKey;
 
 public:
 	/// The message type. See {@link MessageType}.
@@ -87,7 +87,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String titleKey;
+	const static string_view titleKey;
 
 public:
 	/// A short title like 'Retry', 'Open Log' etc.
@@ -96,6 +96,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -118,9 +126,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String typeKey;
-	const static String messageKey;
-	const static String actionsKey;
+	const static string_view typeKey;
+	const static string_view messageKey;
+	const static string_view actionsKey;
 
 public:
 	/// The message type. See {@link MessageType}.
@@ -130,13 +138,13 @@ public:
 	String message;
 
 	/// The message action items to present.
-	optional<vector<MessageActionItem>> actions;
+	optional<Vector<MessageActionItem>> actions;
 
 	// No parsing
 
 	ShowMessageRequestParams(MessageType type,
 		String message,
-		optional<vector<MessageActionItem>> actions);
+		optional<Vector<MessageActionItem>> actions);
 
 	ShowMessageRequestParams();
 
@@ -45,9 +45,9 @@ using namespace std;
 struct SignatureHelpClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String signatureInformationKey;
-	const static String contextSupportKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view signatureInformationKey;
+	const static string_view contextSupportKey;
 
 public:
 	/// Whether signature help supports dynamic registration.
@@ -58,16 +58,21 @@ public:
 	struct SignatureInformation: public ObjectT
 	{
 	private:
-		const static String documentationFormatKey;
-		const static String parameterInformationKey;
+		const static string_view documentationFormatKey;
+		const static string_view parameterInformationKey;
 
 		struct DocumentationFormatMaker: public ObjectT
 		{
-			vector<MarkupKind> &parentArray;
+			Vector<MarkupKind> &parentArray;
 
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -76,20 +81,20 @@ public:
 			//===============================================================//
 
 
-			DocumentationFormatMaker(vector<MarkupKind> &parentArray);
+			DocumentationFormatMaker(Vector<MarkupKind> &parentArray);
 
 			virtual ~DocumentationFormatMaker();
 		};
 	public:
 		/// Client supports the follow content formats for the documentation
 		/// property. The order describes the preferred format of the client.
-		optional<vector<MarkupKind>> documentationFormat;
+		optional<Vector<MarkupKind>> documentationFormat;
 
 		/// Client capabilities specific to parameter information.
 		struct ParameterInformation: public ObjectT
 		{
 		private:
-			const static String labelOffsetSupportKey;
+			const static string_view labelOffsetSupportKey;
 
 		public:
 			/// The client supports processing label offsets instead of a
@@ -101,6 +106,14 @@ public:
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The json members with a known key
+			const static FieldDescriptor fields[];
+
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -122,6 +135,14 @@ public:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -130,7 +151,7 @@ public:
 		//===================================================================//
 
 
-		SignatureInformation(optional<vector<MarkupKind>> documentationFormat,
+		SignatureInformation(optional<Vector<MarkupKind>> documentationFormat,
 			optional<ParameterInformation> parameterInformation);
 
 		SignatureInformation();
@@ -153,6 +174,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -184,13 +213,13 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String triggerCharactersKey;
-	const static String retriggerCharactersKey;
+	const static string_view triggerCharactersKey;
+	const static string_view retriggerCharactersKey;
 
 public:
 	/// The characters that trigger signature help
 	/// automatically.
-	optional<vector<String>> triggerCharacters;
+	optional<Vector<String>> triggerCharacters;
 
 	/// List of characters that re-trigger signature help.
 	///
@@ -199,13 +228,13 @@ public:
 	/// All trigger characters are also counted as re-trigger characters.
 	///
 	/// @since 3.15.0
-	optional<vector<String>> retriggerCharacters;
+	optional<Vector<String>> retriggerCharacters;
 
 	// No parsing
 
 	SignatureHelpOptions(optional<Boolean> workDoneProgress,
-		optional<vector<String>> triggerCharacters,
-		optional<vector<String>> retriggerCharacters);
+		optional<Vector<String>> triggerCharacters,
+		optional<Vector<String>> retriggerCharacters);
 
 	SignatureHelpOptions();
 
@@ -227,8 +256,8 @@ public:
 	SignatureHelpRegistrationOptions(
 		variant<DocumentSelector, Null> documentSelector,
 		optional<Boolean> workDoneProgress,
-		optional<vector<String>> triggerCharacters,
-		optional<vector<String>> retriggerCharacters);
+		optional<Vector<String>> triggerCharacters,
+		optional<Vector<String>> retriggerCharacters);
 
 	SignatureHelpRegistrationOptions();
 
@@ -249,8 +278,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String labelKey;
-	const static String documentationKey;
+	const static string_view labelKey;
+	const static string_view documentationKey;
 
 	struct LabelMaker: public ObjectT
 	{
@@ -262,6 +291,11 @@ private:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -295,6 +329,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -328,17 +370,22 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String labelKey;
-	const static String documentationKey;
-	const static String parametersKey;
+	const static string_view labelKey;
+	const static string_view documentationKey;
+	const static string_view parametersKey;
 
 	struct ParametersMaker: public ObjectT
 	{
-		vector<ParameterInformation> &parentArray;
+		Vector<ParameterInformation> &parentArray;
 
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -347,7 +394,7 @@ private:
 		//===================================================================//
 
 
-		ParametersMaker(vector<ParameterInformation> &parentArray);
+		ParametersMaker(Vector<ParameterInformation> &parentArray);
 
 		virtual ~ParametersMaker();
 	};
@@ -361,11 +408,19 @@ public:
 	optional<variant<String, MarkupContent>> documentation;
 
 	/// The parameters of this signature.
-	optional<vector<ParameterInformation>> parameters;
+	optional<Vector<ParameterInformation>> parameters;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -376,7 +431,7 @@ public:
 
 	SignatureInformation(String label,
 		optional<variant<String, MarkupContent>> documentation,
-		optional<vector<ParameterInformation>> parameters);
+		optional<Vector<ParameterInformation>> parameters);
 
 	SignatureInformation();
 
@@ -400,17 +455,22 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String signaturesKey;
-	const static String activeSignatureKey;
-	const static String activeParameterKey;
+	const static string_view signaturesKey;
+	const static string_view activeSignatureKey;
+	const static string_view activeParameterKey;
 
 	struct SignaturesMaker: public ObjectT
 	{
-		vector<SignatureInformation> &parentArray;
+		Vector<SignatureInformation> &parentArray;
 
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -419,13 +479,13 @@ private:
 		//===================================================================//
 
 
-		SignaturesMaker(vector<SignatureInformation> &parentArray);
+		SignaturesMaker(Vector<SignatureInformation> &parentArray);
 
 		virtual ~SignaturesMaker();
 	};
 public:
 	/// One or more signatures.
-	vector<SignatureInformation> signatures;
+	Vector<SignatureInformation> signatures;
 
 	/// The active signature. If omitted or the value lies outside the
 	/// range of `signatures` the value defaults to zero or is ignored if
@@ -448,6 +508,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -456,7 +524,7 @@ public:
 	//=======================================================================//
 
 
-	SignatureHelp(vector<SignatureInformation> signatures,
+	SignatureHelp(Vector<SignatureInformation> signatures,
 		optional<Number> activeSignature,
 		optional<Number> activeParameter);
 
@@ -497,10 +565,10 @@ enum class SignatureHelpTriggerKind
 struct SignatureHelpContext: public ObjectT
 {
 private:
-	const static String triggerKindKey;
-	const static String triggerCharacterKey;
-	const static String isRetriggerKey;
-	const static String activeSignatureHelpKey;
+	const static string_view triggerKindKey;
+	const static string_view triggerCharacterKey;
+	const static string_view isRetriggerKey;
+	const static string_view activeSignatureHelpKey;
 
 public:
 	/// Action that caused signature help to be triggered.
@@ -528,6 +596,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -556,7 +632,7 @@ struct SignatureHelpParams:
 	public WorkDoneProgressParams
 {
 private:
-	const static String contextKey;
+	const static string_view contextKey;
 
 public:
 	/// The signature help context. This is only available if the client
@@ -569,6 +645,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
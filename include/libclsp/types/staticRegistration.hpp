@@ -38,7 +38,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String idKey;
+	const static string_view idKey;
 
 public:
 	/// The id used to register the request. The id can be used to deregister
@@ -40,10 +40,10 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String uriKey;
-	const static String languageIdKey;
-	const static String versionKey;
-	const static String textKey;
+	const static string_view uriKey;
+	const static string_view languageIdKey;
+	const static string_view versionKey;
+	const static string_view textKey;
 
 public:
 
@@ -63,6 +63,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
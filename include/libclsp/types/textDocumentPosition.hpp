@@ -34,8 +34,8 @@ using namespace std;
 struct TextDocumentPositionParams: public virtual ObjectT
 {
 private:
-	const static String textDocumentKey;
-	const static String positionKey;
+	const static string_view textDocumentKey;
+	const static string_view positionKey;
 
 public:
 	/// The text document.
@@ -47,6 +47,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
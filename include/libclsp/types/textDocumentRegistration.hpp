@@ -34,7 +34,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String documentSelectorKey;
+	const static string_view documentSelectorKey;
 
 public:
 	/// A document selector to identify the scope of the registration.
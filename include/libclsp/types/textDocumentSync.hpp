@@ -62,11 +62,11 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String openCloseKey;
-	const static String changeKey;
-	const static String willSaveKey;
-	const static String willSaveWaitUntilKey;
-	const static String saveKey;
+	const static string_view openCloseKey;
+	const static string_view changeKey;
+	const static string_view willSaveKey;
+	const static string_view willSaveWaitUntilKey;
+	const static string_view saveKey;
 
 public:
 	/// Open and close notifications are sent to the server. If omitted
@@ -116,10 +116,10 @@ public:
 struct TextDocumentSyncClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String willSaveKey;
-	const static String willSaveWaitUntilKey;
-	const static String didSaveKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view willSaveKey;
+	const static string_view willSaveWaitUntilKey;
+	const static string_view didSaveKey;
 
 public:
 	/// Whether text document synchronization supports dynamic registration.
@@ -139,6 +139,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -40,8 +40,8 @@ protected:
 
 private:
 
-	const static String rangeKey;
-	const static String newTextKey;
+	const static string_view rangeKey;
+	const static string_view newTextKey;
 
 public:
 
@@ -56,6 +56,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -84,8 +92,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String textDocumentKey;
-	const static String editsKey;
+	const static string_view textDocumentKey;
+	const static string_view editsKey;
 
 	struct EditsMaker: public ObjectT
 	{
@@ -94,6 +102,11 @@ private:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -107,11 +120,19 @@ public:
 	VersionedTextDocumentIdentifier textDocument;
 
 	/// The edits to be applied.
-	vector<TextEdit> edits;
+	Vector<TextEdit> edits;
 
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -121,7 +142,7 @@ public:
 
 
 	TextDocumentEdit(VersionedTextDocumentIdentifier textDocument,
-		vector<TextEdit> edits);
+		Vector<TextEdit> edits);
 
 	TextDocumentEdit();
 
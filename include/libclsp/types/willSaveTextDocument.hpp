@@ -48,8 +48,8 @@ enum class TextDocumentSaveReason
 struct WillSaveTextDocumentParams: public ObjectT
 {
 private:
-	const static String textDocumentKey;
-	const static String reasonKey;
+	const static string_view textDocumentKey;
+	const static string_view reasonKey;
 
 public:
 	/// The document that will be saved.
@@ -61,6 +61,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -47,10 +47,10 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String titleKey;
-	const static String cancellableKey;
-	const static String messageKey;
-	const static String percentageKey;
+	const static string_view titleKey;
+	const static string_view cancellableKey;
+	const static string_view messageKey;
+	const static string_view percentageKey;
 
 public:
 	const static pair<String, String> kind;
@@ -84,6 +84,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -121,9 +129,9 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String cancellableKey;
-	const static String messageKey;
-	const static String percentageKey;
+	const static string_view cancellableKey;
+	const static string_view messageKey;
+	const static string_view percentageKey;
 
 public:
 	const static pair<String, String> kind;
@@ -153,6 +161,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -184,7 +200,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String messageKey;
+	const static string_view messageKey;
 
 public:
 	const static pair<String, String> kind;
@@ -196,6 +212,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -218,7 +242,7 @@ public:
 struct WorkDoneProgressParams: public virtual ObjectT
 {
 private:
-	const static String workDoneTokenKey;
+	const static string_view workDoneTokenKey;
 
 public:
 	/// An optional token that a server can use to report work done progress.
@@ -227,6 +251,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -255,7 +287,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String workDoneProgressKey;
+	const static string_view workDoneProgressKey;
 
 public:
 	optional<Boolean> workDoneProgress;
@@ -282,7 +314,7 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String tokenKey;
+	const static string_view tokenKey;
 
 public:
 	/// The token to be used to report progress.
@@ -309,7 +341,7 @@ public:
 struct WorkDoneProgressCancelParams: public ObjectT
 {
 private:
-	const static String tokenKey;
+	const static string_view tokenKey;
 
 public:
 	/// The token to be used to report progress.
@@ -318,6 +350,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -348,8 +388,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String tokenKey;
-	const static String valueKey;
+	const static string_view tokenKey;
+	const static string_view valueKey;
 
 	struct ValueMaker: public ObjectT
 	{
@@ -361,6 +401,14 @@ private:
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -385,6 +433,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
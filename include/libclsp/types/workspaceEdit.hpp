@@ -43,8 +43,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String changesKey;
-	const static String documentChangesKey;
+	const static string_view changesKey;
+	const static string_view documentChangesKey;
 
 public:
 	/// Holds changes to existing resources.
@@ -55,10 +55,10 @@ public:
 		virtual void partialWrite(JsonWriter &writer);
 
 	public:
-		map<DocumentUri, vector<TextEdit>> changes;
+		Map<DocumentUri, Vector<TextEdit>> changes;
 
 
-		Changes(map<DocumentUri, vector<TextEdit>> changes);
+		Changes(Map<DocumentUri, Vector<TextEdit>> changes);
 
 		Changes();
 
@@ -83,8 +83,8 @@ public:
 	/// `TextEdit`s using the `changes` property are supported.
 	optional<
 		variant<
-			vector<TextDocumentEdit>,
-			vector<
+			Vector<TextDocumentEdit>,
+			Vector<
 				variant<TextDocumentEdit, CreateFile, RenameFile, DeleteFile>
 			>
 		>
@@ -95,8 +95,8 @@ public:
 	WorkspaceEdit(optional<Changes> changes,
 		optional<
 			variant<
-				vector<TextDocumentEdit>,
-				vector<
+				Vector<TextDocumentEdit>,
+				Vector<
 					variant<TextDocumentEdit, CreateFile, RenameFile, DeleteFile>
 				>
 			>
@@ -218,17 +218,22 @@ public:
 struct WorkspaceEditClientCapabilities: public ObjectT
 {
 private:
-	const static String documentChangesKey;
-	const static String resourceOperationsKey;
-	const static String failureHandlingKey;
+	const static string_view documentChangesKey;
+	const static string_view resourceOperationsKey;
+	const static string_view failureHandlingKey;
 
 	struct ResourceOperationsMaker: public ObjectT
 	{
-		vector<ResourceOperationKind> &parentArray;
+		Vector<ResourceOperationKind> &parentArray;
 
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -237,7 +242,7 @@ private:
 		//===================================================================//
 
 
-		ResourceOperationsMaker(vector<ResourceOperationKind> &parentArray);
+		ResourceOperationsMaker(Vector<ResourceOperationKind> &parentArray);
 
 		virtual ~ResourceOperationsMaker();
 	};
@@ -249,7 +254,7 @@ public:
 	/// support 'create', 'rename' and 'delete' files and folders.
 	///
 	/// @since 3.13.0
-	optional<vector<ResourceOperationKind>> resourceOperations;
+	optional<Vector<ResourceOperationKind>> resourceOperations;
 
 	/// The failure handling strategy of a client if applying the workspace
 	/// edit fails.
@@ -260,6 +265,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -270,7 +283,7 @@ public:
 	// No writing
 
 	WorkspaceEditClientCapabilities(optional<Boolean> documentChanges,
-		optional<vector<ResourceOperationKind>> resourceOperations,
+		optional<Vector<ResourceOperationKind>> resourceOperations,
 		optional<FailureHandlingKind> failureHandling);
 
 	WorkspaceEditClientCapabilities();
@@ -39,8 +39,8 @@ protected:
 	virtual void partialWrite(JsonWriter &writer);
 
 private:
-	const static String supportedKey;
-	const static String changeNotificationsKey;
+	const static string_view supportedKey;
+	const static string_view changeNotificationsKey;
 
 public:
 	/// The server has support for workspace folders
@@ -74,8 +74,8 @@ public:
 struct WorkspaceFolder: public ObjectT
 {
 private:
-	const static String uriKey;
-	const static String nameKey;
+	const static string_view uriKey;
+	const static string_view nameKey;
 
 public:
 	/// The associated URI for this workspace folder.
@@ -88,6 +88,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -35,8 +35,8 @@ using namespace std;
 struct WorkspaceSymbolClientCapabilities: public ObjectT
 {
 private:
-	const static String dynamicRegistrationKey;
-	const static String symbolKindKey;
+	const static string_view dynamicRegistrationKey;
+	const static string_view symbolKindKey;
 
 public:
 	/// Whether declaration supports dynamic registration. If this is set to
@@ -49,7 +49,7 @@ public:
 	struct SymbolKind: public ObjectT
 	{
 	private:
-		const static String valueSetKey;
+		const static string_view valueSetKey;
 
 		struct ValueSetMaker: public ObjectT
 		{
@@ -58,6 +58,11 @@ public:
 
 			//====================   Parsing   ==============================//
 
+		protected:
+			/// The static description of the json members
+			const static ObjectDescriptor descriptor;
+
+		public:
 			/// This fills an ObjectInitializer
 			virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -80,11 +85,19 @@ public:
 		/// If this property is not present the client only supports
 		/// the symbol kinds from `File` to `Array` as defined in
 		/// the initial version of the protocol.
-		optional<vector<clsp::SymbolKind>> valueSet;
+		optional<Vector<clsp::SymbolKind>> valueSet;
 
 
 		//====================   Parsing   ==================================//
 
+	protected:
+		/// The json members with a known key
+		const static FieldDescriptor fields[];
+
+		/// The static description of the json members
+		const static ObjectDescriptor descriptor;
+
+	public:
 		/// This fills an ObjectInitializer
 		virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -94,7 +107,7 @@ public:
 
 		// No writing
 
-		SymbolKind(optional<vector<clsp::SymbolKind>> valueSet);
+		SymbolKind(optional<Vector<clsp::SymbolKind>> valueSet);
 
 		SymbolKind();
 
@@ -108,6 +121,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -139,7 +160,7 @@ struct WorkspaceSymbolParams:
 	public PartialResultParams
 {
 private:
-	const static String queryKey;
+	const static string_view queryKey;
 
 public:
 	/// A query string to filter symbols by. Clients may send an empty
@@ -149,6 +170,14 @@ public:
 
 	//====================   Parsing   ======================================//
 
+protected:
+	/// The json members with a known key
+	const static FieldDescriptor fields[];
+
+	/// The static description of the json members
+	const static ObjectDescriptor descriptor;
+
+public:
 	/// This fills an ObjectInitializer
 	virtual void fillInitializer(ObjectInitializer& initializer);
 
@@ -0,0 +1,233 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <algorithm>
+
+#include <libclsp/server/accessScheduler.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+AccessScheduler::AccessScheduler(PriorityScheduler& scheduler,
+	TaskGroup& group):
+	scheduler(scheduler),
+	group(group)
+{};
+
+AccessScheduler::~AccessScheduler(){};
+
+bool AccessScheduler::compatible(Mode first, Mode second)
+{
+	switch(first)
+	{
+		case Mode::intentRead:
+			return second != Mode::write;
+
+		case Mode::intentWrite:
+			return second == Mode::intentRead || second == Mode::intentWrite;
+
+		case Mode::read:
+			return second == Mode::intentRead || second == Mode::read;
+
+		case Mode::write:
+			return false;
+	}
+
+	return false;
+}
+
+bool AccessScheduler::Queue::empty() const
+{
+	for(size_t count: ready)
+	{
+		if(count != 0)
+		{
+			return false;
+		}
+	}
+
+	return waiting.empty();
+}
+
+unsigned AccessScheduler::maskOf(const array<size_t, modeCount>& modes)
+{
+	unsigned mask = 0;
+
+	for(size_t m = 0; m < modeCount; m++)
+	{
+		if(modes[m] != 0)
+		{
+			mask |= 1u << m;
+		}
+	}
+
+	return mask;
+}
+
+bool AccessScheduler::compatible(unsigned modes, Mode mode)
+{
+	for(size_t m = 0; m < modeCount; m++)
+	{
+		if((modes & (1u << m)) != 0 && !compatible((Mode)m, mode))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AccessScheduler::start(Ticket* ticket)
+{
+	// finish() erases the ticket while its task runs
+	scheduler.submit(move(ticket->task), ticket->priority);
+}
+
+void AccessScheduler::enqueue(Queue& queue, Ticket* ticket, Mode mode)
+{
+	unsigned before = maskOf(queue.ready) | maskOf(queue.waitingModes);
+
+	if(compatible(before, mode))
+	{
+		queue.ready[(size_t)mode]++;
+		return;
+	}
+
+	queue.waiting.push_back({ticket, mode});
+	queue.waitingModes[(size_t)mode]++;
+
+	ticket->waiting++;
+}
+
+void AccessScheduler::startReady(Queue& queue)
+{
+	// The modes of the ready ones and of the ones that wait before this one
+	unsigned before = maskOf(queue.ready);
+
+	for(auto entry = queue.waiting.begin(); entry != queue.waiting.end();)
+	{
+		unsigned bit = 1u << (size_t)entry->mode;
+
+		// Nothing after a write can start
+		if((before & (1u << (size_t)Mode::write)) != 0)
+		{
+			break;
+		}
+
+		if(!compatible(before, entry->mode))
+		{
+			before |= bit;
+			entry++;
+			continue;
+		}
+
+		Ticket* ticket = entry->ticket;
+
+		queue.ready[(size_t)entry->mode]++;
+		queue.waitingModes[(size_t)entry->mode]--;
+
+		entry = queue.waiting.erase(entry);
+
+		before |= bit;
+
+		if(--ticket->waiting == 0)
+		{
+			start(ticket);
+		}
+	}
+}
+
+void AccessScheduler::submit(function<void()> task,
+	Priority priority,
+	Access access,
+	optional<String> document)
+{
+	auto owned = make_unique<Ticket>();
+
+	Ticket* ticket = owned.get();
+
+	ticket->priority = priority;
+	ticket->document = move(document);
+
+	// It leaves the queues inside the group, before a wait can see it done
+	ticket->task = group.add([this, ticket, task = move(task)]()
+	{
+		task();
+
+		finish(ticket);
+	});
+
+	bool writes = access == Access::write;
+
+	if(ticket->document.has_value())
+	{
+		ticket->workspaceMode = writes? Mode::intentWrite: Mode::intentRead;
+		ticket->documentMode  = writes? Mode::write: Mode::read;
+	}
+	else
+	{
+		ticket->workspaceMode = writes? Mode::write: Mode::read;
+	}
+
+	lock_guard<mutex> lock(queueMutex);
+
+	ticket->self = tickets.insert(tickets.end(), move(owned));
+
+	enqueue(workspace, ticket, ticket->workspaceMode);
+
+	if(ticket->document.has_value())
+	{
+		enqueue(documents[*ticket->document], ticket, ticket->documentMode);
+	}
+
+	if(ticket->waiting == 0)
+	{
+		start(ticket);
+	}
+}
+
+void AccessScheduler::finish(Ticket* ticket)
+{
+	lock_guard<mutex> lock(queueMutex);
+
+	// It only ran if it was ready in all its queues
+	workspace.ready[(size_t)ticket->workspaceMode]--;
+
+	if(ticket->document.has_value())
+	{
+		auto queue = documents.find(*ticket->document);
+
+		queue->second.ready[(size_t)ticket->documentMode]--;
+
+		if(queue->second.empty())
+		{
+			documents.erase(queue);
+		}
+		else
+		{
+			startReady(queue->second);
+		}
+	}
+
+	startReady(workspace);
+
+	tickets.erase(ticket->self);
+}
+
+}
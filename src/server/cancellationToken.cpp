@@ -0,0 +1,103 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <libclsp/server/cancellationToken.hpp>
+#include <libclsp/types/responseMessage.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+thread_local const CancellationToken* CancellationToken::currentToken = nullptr;
+
+CancellationToken::CancellationToken():
+	cancelled(make_shared<atomic<int>>(0))
+{};
+
+CancellationToken::~CancellationToken(){};
+
+bool CancellationToken::isCancelled() const
+{
+	return cancelled->load(memory_order_relaxed) != 0;
+}
+
+void CancellationToken::cancel(ErrorCodes reason)
+{
+	int none = 0;
+
+	cancelled->compare_exchange_strong(none, (int)reason,
+		memory_order_relaxed);
+}
+
+void CancellationToken::cancel()
+{
+	cancel(ErrorCodes::RequestCancelled);
+}
+
+void CancellationToken::supersede()
+{
+	cancel(ErrorCodes::ContentModified);
+}
+
+ErrorCodes CancellationToken::reason() const
+{
+	return (ErrorCodes)cancelled->load(memory_order_relaxed);
+}
+
+ResponseError CancellationToken::error() const
+{
+	if(reason() == ErrorCodes::ContentModified)
+	{
+		return ResponseError(ErrorCodes::ContentModified,
+			"The document changed",
+			nullopt);
+	}
+
+	return ResponseError(ErrorCodes::RequestCancelled,
+		"The request was cancelled",
+		nullopt);
+}
+
+void CancellationToken::throwIfCancelled() const
+{
+	if(isCancelled())
+	{
+		throw error();
+	}
+}
+
+const CancellationToken& CancellationToken::current()
+{
+	// The token of threads without a handler
+	static const CancellationToken none;
+
+	return currentToken != nullptr? *currentToken: none;
+}
+
+
+CancellationScope::CancellationScope(const CancellationToken& token):
+	previous(CancellationToken::currentToken)
+{
+	CancellationToken::currentToken = &token;
+};
+
+CancellationScope::~CancellationScope()
+{
+	CancellationToken::currentToken = previous;
+};
+
+}
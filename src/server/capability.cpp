@@ -15,8 +15,7 @@
 // along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <libclsp/server/capability.hpp>
-
-#include <libclsp/types.hpp>
+#include <libclsp/server/methods.hpp>
 
 namespace clsp
 {
@@ -25,12 +24,22 @@ using namespace std;
 
 Capability::Capability(String method, JsonIO params, optional<JsonIO> result):
 	method(method),
+	methodId(internMethod(method)),
 	params(params),
 	result(result)
 {};
 
 Capability::~Capability(){};
 
+bool Capability::hasHandler() const
+{
+	return handler.has_value() || typedHandler != nullptr;
+}
+
+DecodedParams::~DecodedParams(){};
+
+TypedHandler::~TypedHandler(){};
+
 
 Capability::JsonIO::JsonIO(optional<function<void(JsonWriter&, any&)>> writer,
 	optional<function<ValueSetter(JsonHandler&, optional<any>&)>> reader):
@@ -42,2714 +51,622 @@ Capability::JsonIO::~JsonIO(){};
 
 
 // Cancellation Support
-const Capability Capability::cancelRequest = {
+decltype(Methods::cancelRequest) Methods::cancelRequest = {
 	// Method
 	"$/cancelRequest",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<CancelParams&>(data));
-		},
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<CancelParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::both
 };
 
-const Capability Capability::progress = {
+decltype(Methods::progress) Methods::progress = {
 	// Method
 	"$/progress",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<ProgressParams&>(data));
-		},
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<ProgressParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::both
 };
 
-const Capability Capability::initialize = {
+// Lifecycle
+decltype(Methods::initialize) Methods::initialize = {
 	// Method
 	"initialize",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<InitializeParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<InitializeResult&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::initialized = {
+decltype(Methods::initialized) Methods::initialized = {
 	// Method
 	"initialized",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<InitializedParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::shutdown = {
+decltype(Methods::shutdown) Methods::shutdown = {
 	// Method
 	"shutdown",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler&, optional<any>& data)
-		{
-			data = nullopt;
-
-			return ValueSetter();
-		}
-	},
-
-	// Response
-	{{
-		// Reader
-		[](JsonWriter& writer, any&)
-		{
-			writer.Null();
-		},
-
-		// Writer
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::exit = {
+decltype(Methods::exit) Methods::exit = {
 	// Method
 	"exit",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler&, optional<any>& data)
-		{
-			data = nullopt;
-
-			return ValueSetter();
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::windowShowMessage = {
+// Window
+decltype(Methods::windowShowMessage) Methods::windowShowMessage = {
 	// Method
 	"window/showMessage",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<ShowMessageParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::windowShowMessageRequest = {
+decltype(Methods::windowShowMessageRequest)
+	Methods::windowShowMessageRequest = {
 	// Method
 	"window/showMessageRequest",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<ShowMessageRequestParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	{{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<variant<MessageActionItem, Null>>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				[&params]()
-				{
-					params = Null();
-				},
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					auto& obj = params.emplace<MessageActionItem>();
-
-					handler.pushInitializer();
-					obj.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	}}
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::windowLogMessage = {
+decltype(Methods::windowLogMessage) Methods::windowLogMessage = {
 	// Method
 	"window/logMessage",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<LogMessageParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::windowWorkDoneProgressCreate = {
+decltype(Methods::windowWorkDoneProgressCreate)
+	Methods::windowWorkDoneProgressCreate = {
 	// Method
 	"window/workDoneProgress/create",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<WorkDoneProgressCreateParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	{{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler&, optional<any>& data)
-		{
-			data = nullopt;
-
-			return ValueSetter();
-		}
-	}}
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::windowWorkDoneProgressCancel = {
+decltype(Methods::windowWorkDoneProgressCancel)
+	Methods::windowWorkDoneProgressCancel = {
 	// Method
 	"window/workDoneProgress/cancel",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<WorkDoneProgressCancelParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::telemetryEvent = {
+// Telemetry
+decltype(Methods::telemetryEvent) Methods::telemetryEvent = {
 	// Method
 	"telemetry/event",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Any(any_cast<Any&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::clientRegisterCapability = {
+// Client
+decltype(Methods::clientRegisterCapability)
+	Methods::clientRegisterCapability = {
 	// Method
 	"client/registerCapability",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<RegistrationParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	{{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler&, optional<any>& data)
-		{
-			data = nullopt;
-
-			return ValueSetter();
-		}
-	}}
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::clientUnregisterCapability = {
+decltype(Methods::clientUnregisterCapability)
+	Methods::clientUnregisterCapability = {
 	// Method
 	"client/unregisterCapability",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<UnregistrationParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	{{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler&, optional<any>& data)
-		{
-			data = nullopt;
-
-			return ValueSetter();
-		}
-	}}
+	// Sender
+	Sender::server
 };
 
-
-const Capability Capability::workspaceWorkspaceFolders = {
+// Workspace
+decltype(Methods::workspaceWorkspaceFolders)
+	Methods::workspaceWorkspaceFolders = {
 	// Method
 	"workspace/workspaceFolders",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	{{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<variant<vector<WorkspaceFolder>, Null>>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				[&params]()
-				{
-					params = Null();
-				},
-
-				// Array
-				[&handler, &params]()
-				{
-					auto* maker = new ObjectArrayMaker<WorkspaceFolder>
-						(params.emplace<vector<WorkspaceFolder>>());
-
-					handler.pushInitializer();
-					maker->fillInitializer(handler.objectStack.top());
-				},
-
-				// Object
-				nullopt
-			};
-		}
-	}}
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::workspaceDidChangeWorkspaceFolders = {
+decltype(Methods::workspaceDidChangeWorkspaceFolders)
+	Methods::workspaceDidChangeWorkspaceFolders = {
 	// Method
 	"workspace/didChangeWorkspaceFolders",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DidChangeWorkspaceFoldersParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::workspaceDidChangeConfiguration = {
+decltype(Methods::workspaceDidChangeConfiguration)
+	Methods::workspaceDidChangeConfiguration = {
 	// Method
-	"workspace/didChangeConfiguration’",
-
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DidChangeConfigurationParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	"workspace/didChangeConfiguration",
+
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::workspaceConfiguration = {
+decltype(Methods::workspaceConfiguration) Methods::workspaceConfiguration = {
 	// Method
 	"workspace/configuration",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<ConfigurationParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	{{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<Array>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				[&handler, &params]()
-				{
-					auto* maker = new ArrayMaker(params);
-
-					handler.pushInitializer();
-					maker->fillInitializer(handler.objectStack.top());
-				},
-
-				// Object
-				nullopt
-			};
-		}
-	}}
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::workspaceDidChangeWatchedFiles = {
+decltype(Methods::workspaceDidChangeWatchedFiles)
+	Methods::workspaceDidChangeWatchedFiles = {
 	// Method
 	"workspace/didChangeWatchedFiles",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DidChangeWatchedFilesParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::workspaceSymbol = {
+decltype(Methods::workspaceSymbol) Methods::workspaceSymbol = {
 	// Method
 	"workspace/symbol",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<WorkspaceSymbolParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<SymbolInformation>& vec)
-				{
-					writer.StartArray();
-					for(auto& i:vec)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			),any_cast<variant<vector<SymbolInformation>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client,
+
+	// Priority
+	Priority::background
 };
 
-const Capability Capability::workspaceExecuteCommand = {
+decltype(Methods::workspaceExecuteCommand) Methods::workspaceExecuteCommand = {
 	// Method
 	"workspace/executeCommand",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<ExecuteCommandParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](Any& anyResponse)
-				{
-					writer.Any(anyResponse);
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			),any_cast<variant<Any, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client,
+
+	// Priority
+	Priority::normal,
+
+	// Access
+	Access::write
 };
 
-const Capability Capability::workspaceApplyEdit = {
+decltype(Methods::workspaceApplyEdit) Methods::workspaceApplyEdit = {
 	// Method
 	"workspace/applyEdit",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<ApplyWorkspaceEditParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	{{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<ApplyWorkspaceEditResponse>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	}}
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::textDocumentDidOpen = {
+// Text Synchronization
+decltype(Methods::textDocumentDidOpen) Methods::textDocumentDidOpen = {
 	// Method
 	"textDocument/didOpen",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DidOpenTextDocumentParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentDidChange = {
+decltype(Methods::textDocumentDidChange) Methods::textDocumentDidChange = {
 	// Method
 	"textDocument/didChange",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DidChangeTextDocumentParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentWillSave = {
+decltype(Methods::textDocumentWillSave) Methods::textDocumentWillSave = {
 	// Method
 	"textDocument/willSave",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<WillSaveTextDocumentParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentWillSaveWaitUntil = {
+decltype(Methods::textDocumentWillSaveWaitUntil)
+	Methods::textDocumentWillSaveWaitUntil = {
 	// Method
 	"textDocument/willSaveWaitUntil",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<WillSaveTextDocumentParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<TextEdit>& vec)
-				{
-					writer.StartArray();
-					for(auto& i:vec)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<TextEdit>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentDidSave = {
+decltype(Methods::textDocumentDidSave) Methods::textDocumentDidSave = {
 	// Method
 	"textDocument/didSave",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DidSaveTextDocumentParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentDidClose = {
+decltype(Methods::textDocumentDidClose) Methods::textDocumentDidClose = {
 	// Method
 	"textDocument/didClose",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DidCloseTextDocumentParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentPublishDiagnostics = {
+// Diagnostics
+decltype(Methods::textDocumentPublishDiagnostics)
+	Methods::textDocumentPublishDiagnostics = {
 	// Method
 	"textDocument/publishDiagnostics",
 
-	// Request
-	{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<PublishDiagnosticsParams&>(data));
-		},
-
-		// Reader
-		nullopt
-	},
-
-	// Response
-	nullopt
+	// Sender
+	Sender::server
 };
 
-const Capability Capability::textDocumentCompletion = {
+// Language Features
+decltype(Methods::textDocumentCompletion) Methods::textDocumentCompletion = {
 	// Method
 	"textDocument/completion",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<CompletionParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<CompletionItem>& vec)
-				{
-					writer.StartArray();
-					for(auto& i:vec)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](CompletionList& obj)
-				{
-					writer.Object(obj);
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<CompletionItem>, CompletionList, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client,
+
+	// Priority
+	Priority::interactive
 };
 
-const Capability Capability::completionItemResolve = {
+decltype(Methods::completionItemResolve) Methods::completionItemResolve = {
 	// Method
 	"completionItem/resolve",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<CompletionItem>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<CompletionItem&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentHover = {
+decltype(Methods::textDocumentHover) Methods::textDocumentHover = {
 	// Method
 	"textDocument/hover",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<HoverParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](Hover& obj)
-				{
-					writer.Object(obj);
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<Hover, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client,
+
+	// Priority
+	Priority::interactive
 };
 
-const Capability Capability::textDocumentSignatureHelp = {
+decltype(Methods::textDocumentSignatureHelp)
+	Methods::textDocumentSignatureHelp = {
 	// Method
 	"textDocument/signatureHelp",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<SignatureHelpParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](SignatureHelp& obj)
-				{
-					writer.Object(obj);
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<SignatureHelp, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client,
+
+	// Priority
+	Priority::interactive
 };
 
-const Capability Capability::textDocumentDeclaration = {
+decltype(Methods::textDocumentDeclaration) Methods::textDocumentDeclaration = {
 	// Method
 	"textDocument/declaration",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DeclarationParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](Location& obj)
-				{
-					writer.Object(obj);
-				},
-				[&writer](vector<Location>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](vector<LocationLink>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<Location, vector<Location>, vector<LocationLink>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentDefinition = {
+decltype(Methods::textDocumentDefinition) Methods::textDocumentDefinition = {
 	// Method
 	"textDocument/definition",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DefinitionParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](Location& obj)
-				{
-					writer.Object(obj);
-				},
-				[&writer](vector<Location>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](vector<LocationLink>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<Location, vector<Location>, vector<LocationLink>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentTypeDefinition = {
+decltype(Methods::textDocumentTypeDefinition)
+	Methods::textDocumentTypeDefinition = {
 	// Method
 	"textDocument/typeDefinition",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<TypeDefinitionParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](Location& obj)
-				{
-					writer.Object(obj);
-				},
-				[&writer](vector<Location>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](vector<LocationLink>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<Location, vector<Location>, vector<LocationLink>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentImplementation = {
+decltype(Methods::textDocumentImplementation)
+	Methods::textDocumentImplementation = {
 	// Method
 	"textDocument/implementation",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<ImplementationParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](Location& obj)
-				{
-					writer.Object(obj);
-				},
-				[&writer](vector<Location>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](vector<LocationLink>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<Location, vector<Location>, vector<LocationLink>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentReferences = {
+decltype(Methods::textDocumentReferences) Methods::textDocumentReferences = {
 	// Method
 	"textDocument/references",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<ReferenceParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<Location>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<Location>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentDocumentHighlight = {
+decltype(Methods::textDocumentDocumentHighlight)
+	Methods::textDocumentDocumentHighlight = {
 	// Method
 	"textDocument/documentHighlight",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DocumentHighlightParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<DocumentHighlight>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<DocumentHighlight>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentDocumentSymbol = {
+decltype(Methods::textDocumentDocumentSymbol)
+	Methods::textDocumentDocumentSymbol = {
 	// Method
 	"textDocument/documentSymbol",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DocumentSymbolParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<DocumentSymbol>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](vector<SymbolInformation>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<DocumentSymbol>, vector<SymbolInformation>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client,
+
+	// Priority
+	Priority::background
 };
 
-const Capability Capability::textDocumentCodeAction = {
+decltype(Methods::textDocumentCodeAction) Methods::textDocumentCodeAction = {
 	// Method
 	"textDocument/codeAction",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<CodeActionParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<variant<Command, CodeAction>>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						visit(overload(
-							[&writer](Command& obj)
-							{
-								writer.Object(obj);
-							},
-							[&writer](CodeAction& obj)
-							{
-								writer.Object(obj);
-							}
-						), i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<variant<Command, CodeAction>>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentCodeLens = {
+decltype(Methods::textDocumentCodeLens) Methods::textDocumentCodeLens = {
 	// Method
 	"textDocument/codeLens",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<CodeLensParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<CodeLens>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<CodeLens>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client,
+
+	// Priority
+	Priority::background
 };
 
-const Capability Capability::codeLensResolve = {
+decltype(Methods::codeLensResolve) Methods::codeLensResolve = {
 	// Method
 	"codeLens/resolve",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<CodeLens>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<CodeLens&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentDocumentLink = {
+decltype(Methods::textDocumentDocumentLink)
+	Methods::textDocumentDocumentLink = {
 	// Method
 	"textDocument/documentLink",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DocumentLinkParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<DocumentLink>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<DocumentLink>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client,
+
+	// Priority
+	Priority::background
 };
 
-const Capability Capability::documentLinkResolve = {
+decltype(Methods::documentLinkResolve) Methods::documentLinkResolve = {
 	// Method
 	"documentLink/resolve",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DocumentLink>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			writer.Object(any_cast<DocumentLink&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentDocumentColor = {
+decltype(Methods::textDocumentDocumentColor)
+	Methods::textDocumentDocumentColor = {
 	// Method
 	"textDocument/documentColor",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DocumentColorParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			auto& arr = any_cast<vector<ColorInformation>&>(data);
-
-			writer.StartArray();
-			for(auto& i: arr)
-			{
-				writer.Object(i);
-			}
-			writer.EndArray();
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentColorPresentation = {
+decltype(Methods::textDocumentColorPresentation)
+	Methods::textDocumentColorPresentation = {
 	// Method
 	"textDocument/colorPresentation",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<ColorPresentationParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			auto& arr = any_cast<vector<ColorPresentation>&>(data);
-
-			writer.StartArray();
-			for(auto& i: arr)
-			{
-				writer.Object(i);
-			}
-			writer.EndArray();
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentFormatting = {
+decltype(Methods::textDocumentFormatting) Methods::textDocumentFormatting = {
 	// Method
 	"textDocument/formatting",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DocumentFormattingParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<TextEdit>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<TextEdit>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentRangeFormatting = {
+decltype(Methods::textDocumentRangeFormatting)
+	Methods::textDocumentRangeFormatting = {
 	// Method
 	"textDocument/rangeFormatting",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DocumentRangeFormattingParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<TextEdit>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<TextEdit>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentOnTypeFormatting = {
+decltype(Methods::textDocumentOnTypeFormatting)
+	Methods::textDocumentOnTypeFormatting = {
 	// Method
 	"textDocument/onTypeFormatting",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<DocumentOnTypeFormattingParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](vector<TextEdit>& arr)
-				{
-					writer.StartArray();
-					for(auto& i: arr)
-					{
-						writer.Object(i);
-					}
-					writer.EndArray();
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<vector<TextEdit>, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
-const Capability Capability::textDocumentRename = {
+decltype(Methods::textDocumentRename) Methods::textDocumentRename = {
 	// Method
 	"textDocument/rename",
 
-	// Request
-	{
-		// Writer
-		nullopt,
-
-		// Reader
-		[](JsonHandler& handler, optional<any>& data)
-		{
-			auto& params = data.emplace().emplace<RenameParams>();
-
-			return ValueSetter{
-				// String
-				nullopt,
-
-				// Number
-				nullopt,
-
-				// Boolean
-				nullopt,
-
-				// Null
-				nullopt,
-
-				// Array
-				nullopt,
-
-				// Object
-				[&handler, &params]()
-				{
-					handler.pushInitializer();
-					params.fillInitializer(handler.objectStack.top());
-				}
-			};
-		}
-	},
-
-	// Response
-	{{
-		// Writer
-		[](JsonWriter& writer, any& data)
-		{
-			visit(overload(
-				[&writer](WorkspaceEdit& obj)
-				{
-					writer.Object(obj);
-				},
-				[&writer](Null)
-				{
-					writer.Null();
-				}
-			), any_cast<variant<WorkspaceEdit, Null>&>(data));
-		},
-
-		// Reader
-		nullopt
-	}}
+	// Sender
+	Sender::client
 };
 
+
+const Capability Capability::cancelRequest =
+	Methods::cancelRequest.untyped();
+
+const Capability Capability::progress =
+	Methods::progress.untyped();
+
+const Capability Capability::initialize =
+	Methods::initialize.untyped();
+
+const Capability Capability::initialized =
+	Methods::initialized.untyped();
+
+const Capability Capability::shutdown =
+	Methods::shutdown.untyped();
+
+const Capability Capability::exit =
+	Methods::exit.untyped();
+
+const Capability Capability::windowShowMessage =
+	Methods::windowShowMessage.untyped();
+
+const Capability Capability::windowShowMessageRequest =
+	Methods::windowShowMessageRequest.untyped();
+
+const Capability Capability::windowLogMessage =
+	Methods::windowLogMessage.untyped();
+
+const Capability Capability::windowWorkDoneProgressCreate =
+	Methods::windowWorkDoneProgressCreate.untyped();
+
+const Capability Capability::windowWorkDoneProgressCancel =
+	Methods::windowWorkDoneProgressCancel.untyped();
+
+const Capability Capability::telemetryEvent =
+	Methods::telemetryEvent.untyped();
+
+const Capability Capability::clientRegisterCapability =
+	Methods::clientRegisterCapability.untyped();
+
+const Capability Capability::clientUnregisterCapability =
+	Methods::clientUnregisterCapability.untyped();
+
+const Capability Capability::workspaceWorkspaceFolders =
+	Methods::workspaceWorkspaceFolders.untyped();
+
+const Capability Capability::workspaceDidChangeWorkspaceFolders =
+	Methods::workspaceDidChangeWorkspaceFolders.untyped();
+
+const Capability Capability::workspaceDidChangeConfiguration =
+	Methods::workspaceDidChangeConfiguration.untyped();
+
+const Capability Capability::workspaceConfiguration =
+	Methods::workspaceConfiguration.untyped();
+
+const Capability Capability::workspaceDidChangeWatchedFiles =
+	Methods::workspaceDidChangeWatchedFiles.untyped();
+
+const Capability Capability::workspaceSymbol =
+	Methods::workspaceSymbol.untyped();
+
+const Capability Capability::workspaceExecuteCommand =
+	Methods::workspaceExecuteCommand.untyped();
+
+const Capability Capability::workspaceApplyEdit =
+	Methods::workspaceApplyEdit.untyped();
+
+const Capability Capability::textDocumentDidOpen =
+	Methods::textDocumentDidOpen.untyped();
+
+const Capability Capability::textDocumentDidChange =
+	Methods::textDocumentDidChange.untyped();
+
+const Capability Capability::textDocumentWillSave =
+	Methods::textDocumentWillSave.untyped();
+
+const Capability Capability::textDocumentWillSaveWaitUntil =
+	Methods::textDocumentWillSaveWaitUntil.untyped();
+
+const Capability Capability::textDocumentDidSave =
+	Methods::textDocumentDidSave.untyped();
+
+const Capability Capability::textDocumentDidClose =
+	Methods::textDocumentDidClose.untyped();
+
+const Capability Capability::textDocumentPublishDiagnostics =
+	Methods::textDocumentPublishDiagnostics.untyped();
+
+const Capability Capability::textDocumentCompletion =
+	Methods::textDocumentCompletion.untyped();
+
+const Capability Capability::completionItemResolve =
+	Methods::completionItemResolve.untyped();
+
+const Capability Capability::textDocumentHover =
+	Methods::textDocumentHover.untyped();
+
+const Capability Capability::textDocumentSignatureHelp =
+	Methods::textDocumentSignatureHelp.untyped();
+
+const Capability Capability::textDocumentDeclaration =
+	Methods::textDocumentDeclaration.untyped();
+
+const Capability Capability::textDocumentDefinition =
+	Methods::textDocumentDefinition.untyped();
+
+const Capability Capability::textDocumentTypeDefinition =
+	Methods::textDocumentTypeDefinition.untyped();
+
+const Capability Capability::textDocumentImplementation =
+	Methods::textDocumentImplementation.untyped();
+
+const Capability Capability::textDocumentReferences =
+	Methods::textDocumentReferences.untyped();
+
+const Capability Capability::textDocumentDocumentHighlight =
+	Methods::textDocumentDocumentHighlight.untyped();
+
+const Capability Capability::textDocumentDocumentSymbol =
+	Methods::textDocumentDocumentSymbol.untyped();
+
+const Capability Capability::textDocumentCodeAction =
+	Methods::textDocumentCodeAction.untyped();
+
+const Capability Capability::textDocumentCodeLens =
+	Methods::textDocumentCodeLens.untyped();
+
+const Capability Capability::codeLensResolve =
+	Methods::codeLensResolve.untyped();
+
+const Capability Capability::textDocumentDocumentLink =
+	Methods::textDocumentDocumentLink.untyped();
+
+const Capability Capability::documentLinkResolve =
+	Methods::documentLinkResolve.untyped();
+
+const Capability Capability::textDocumentDocumentColor =
+	Methods::textDocumentDocumentColor.untyped();
+
+const Capability Capability::textDocumentColorPresentation =
+	Methods::textDocumentColorPresentation.untyped();
+
+const Capability Capability::textDocumentFormatting =
+	Methods::textDocumentFormatting.untyped();
+
+const Capability Capability::textDocumentRangeFormatting =
+	Methods::textDocumentRangeFormatting.untyped();
+
+const Capability Capability::textDocumentOnTypeFormatting =
+	Methods::textDocumentOnTypeFormatting.untyped();
+
+const Capability Capability::textDocumentRename =
+	Methods::textDocumentRename.untyped();
+
 }
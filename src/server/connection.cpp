@@ -0,0 +1,1571 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include <unistd.h>
+
+#include <libclsp/server/connection.hpp>
+#include <libclsp/server/typedCapability.hpp>
+#include <libclsp/types/cancelParams.hpp>
+#include <libclsp/types/didChangeTextDocument.hpp>
+#include <libclsp/types/genericObject.hpp>
+#include <libclsp/types/notificationMessage.hpp>
+#include <libclsp/types/publishDiagnostic.hpp>
+#include <libclsp/types/responseMessage.hpp>
+#include <libclsp/types/workDoneProgress.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+thread_local Connection* Connection::currentConnection = nullptr;
+
+thread_local Connection::IncomingMessage* Connection::currentMessage = nullptr;
+
+Connection::Connection(Server& server, Channel channel):
+	server(server),
+	channel(channel),
+	reader(makeFrameReader(channel.input, server.ioBackend)),
+	writer(makeFrameWriter(channel.output, server.ioBackend)),
+	runningHandlers(*server.pool),
+	accessScheduler(*server.scheduler, runningHandlers)
+{
+	// A single decoder would only hand the messages to the dispatcher, and
+	// on one core the threads only take turns, so the dispatcher decodes
+	bool decodes = server.decoderCount > 1 &&
+		thread::hardware_concurrency() != 1;
+
+	size_t decoders = decodes? server.decoderCount: 1;
+
+	for(size_t i = 0; i < decoders; i++)
+	{
+		frames.emplace_back(make_unique<SpscQueue<shared_ptr<MessageBuffer>>>(
+			server.queueCapacity));
+
+		if(decodes)
+		{
+			decoded.emplace_back(
+				make_unique<SpscQueue<IncomingMessage>>(server.queueCapacity));
+		}
+	}
+
+	for(size_t i = 0; i < decoded.size(); i++)
+	{
+		decoderThreads.emplace_back([this, i]()
+		{
+			currentConnection = this;
+
+			decodeMessages(*frames[i], *decoded[i]);
+		});
+	}
+
+	dispatcherThread = thread([this]()
+	{
+		currentConnection = this;
+
+		dispatchMessages();
+	});
+
+	writerThread = thread([this]()
+	{
+		currentConnection = this;
+
+		writeMessages();
+	});
+}
+
+Connection::~Connection()
+{
+	closeInput();
+
+	if(dispatcherThread.joinable())
+	{
+		dispatcherThread.join();
+	}
+
+	if(channel.owned)
+	{
+		close(channel.input);
+
+		if(channel.output != channel.input)
+		{
+			close(channel.output);
+		}
+	}
+}
+
+Connection::OutgoingMessage::OutgoingMessage(){};
+
+Connection::OutgoingMessage::OutgoingMessage(
+	unique_ptr<ResponseMessage> response,
+	string json,
+	optional<CancellationToken> token,
+	optional<MethodId> method,
+	optional<variant<Number, String>> id,
+	shared_ptr<pmr::memory_resource> arena):
+	arena(move(arena)),
+	response(move(response)),
+	json(move(json)),
+	token(move(token)),
+	method(method),
+	id(move(id))
+{};
+
+Connection::OutgoingMessage::OutgoingMessage(OutgoingMessage&& other) = default;
+
+Connection::OutgoingMessage& Connection::OutgoingMessage::operator=(
+	OutgoingMessage&& other)
+{
+	response = move(other.response);
+	json     = move(other.json);
+	token    = move(other.token);
+	method   = move(other.method);
+	id       = move(other.id);
+
+	// The old arena can go now
+	arena = move(other.arena);
+
+	return *this;
+}
+
+Connection::OutgoingMessage::~OutgoingMessage(){};
+
+void Connection::readInput()
+{
+	TraceSpan span(server.tracer, "read");
+
+	if(reader->read() <= 0)
+	{
+		inputEnded = true;
+		return;
+	}
+
+	// One read() can have many messages
+	while(shared_ptr<MessageBuffer> buffer = reader->next())
+	{
+		queueFrame(move(buffer));
+	}
+
+	if(reader->failed())
+	{
+		// The messages can't be split anymore
+		queueFrame(nullptr);
+		inputEnded = true;
+	}
+}
+
+void Connection::queueFrame(shared_ptr<MessageBuffer> buffer)
+{
+	if(backlog.empty() && frames[nextFrame]->tryPush(buffer))
+	{
+		nextFrame = (nextFrame + 1) % frames.size();
+		return;
+	}
+
+	backlog.emplace_back(move(buffer));
+}
+
+bool Connection::flushBacklog()
+{
+	while(!backlog.empty())
+	{
+		if(!frames[nextFrame]->tryPush(backlog.front()))
+		{
+			stalled = true;
+
+			// A decoder that popped before it saw the flag made space for
+			// this try
+			atomic_thread_fence(memory_order_seq_cst);
+
+			if(!frames[nextFrame]->tryPush(backlog.front()))
+			{
+				return false;
+			}
+		}
+
+		backlog.pop_front();
+		nextFrame = (nextFrame + 1) % frames.size();
+	}
+
+	return true;
+}
+
+void Connection::closeInput()
+{
+	if(inputClosed)
+	{
+		return;
+	}
+
+	inputClosed = true;
+
+	backlog.clear();
+
+	for(auto& queue: frames)
+	{
+		queue->close();
+	}
+}
+
+bool Connection::popFrame(SpscQueue<shared_ptr<MessageBuffer>>& frames,
+	shared_ptr<MessageBuffer>& buffer,
+	bool wait)
+{
+	if(!(wait? frames.pop(buffer): frames.tryPop(buffer)))
+	{
+		return false;
+	}
+
+	// The pop made space for the backlog
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if(stalled.load(memory_order_relaxed) && stalled.exchange(false))
+	{
+		server.wake();
+	}
+
+	return true;
+}
+
+void Connection::decodeMessages(SpscQueue<shared_ptr<MessageBuffer>>& frames,
+	SpscQueue<IncomingMessage>& decoded)
+{
+	shared_ptr<MessageBuffer> buffer;
+
+	while(popFrame(frames, buffer, true))
+	{
+		decoded.push(decodeMessage(move(buffer)));
+	}
+
+	decoded.close();
+}
+
+void Connection::traceMessage(Tracer& tracer,
+	const char* name,
+	const IncomingMessage& message,
+	chrono::steady_clock::time_point start,
+	chrono::steady_clock::time_point end)
+{
+	TraceEvent event;
+
+	event.reset(name);
+
+	if(message.capability != nullptr)
+	{
+		event.setMethod(message.capability->methodId);
+	}
+
+	if(message.envelope.has_value() && message.envelope->id.has_value())
+	{
+		event.setId(*message.envelope->id);
+	}
+
+	if(message.document.has_value())
+	{
+		event.setUri(string_view(message.document->uri.data(),
+			message.document->uri.size()));
+	}
+
+	tracer.record(event, start, end);
+}
+
+void Connection::traceMessage(Tracer& tracer,
+	const char* name,
+	const OutgoingMessage& message,
+	chrono::steady_clock::time_point start,
+	chrono::steady_clock::time_point end)
+{
+	TraceEvent event;
+
+	event.reset(name);
+
+	if(message.method.has_value())
+	{
+		event.setMethod(*message.method);
+	}
+
+	if(message.response != nullptr)
+	{
+		event.setId(message.response->id);
+	}
+	else if(message.id.has_value())
+	{
+		event.setId(*message.id);
+	}
+
+	tracer.record(event, start, end);
+}
+
+Connection::IncomingMessage Connection::decodeMessage(
+	shared_ptr<MessageBuffer> buffer)
+{
+	IncomingMessage message;
+
+	if(buffer == nullptr)
+	{
+		message.invalidHeader = true;
+		return message;
+	}
+
+	auto start  = chrono::steady_clock::now();
+	size_t bytes = buffer->length;
+
+	bool tracing = server.tracer.isEnabled();
+
+	message.envelope = MessageEnvelope::parse(move(buffer));
+
+	auto parsed = tracing ? chrono::steady_clock::now() : start;
+
+	if(!message.envelope.has_value() || !message.envelope->method.has_value())
+	{
+		if(tracing)
+		{
+			traceMessage(server.tracer, "parse", message, start, parsed);
+		}
+
+		if(server.collectStatistics)
+		{
+			server.statistics.countIn(nullopt, bytes);
+		}
+		return message;
+	}
+
+	String& method = *message.envelope->method;
+
+	message.capability = server.getCapability(method);
+
+	message.document = message.envelope->document();
+
+	if(method == Capability::cancelRequest.method)
+	{
+		// The server reads the cancellations even without a handler
+		message.validParams = !message.envelope->decodeParams(
+			Capability::cancelRequest.params, message.params).IsError();
+
+		// The dispatcher cancels it again in order, this only makes it
+		// sooner if the request is already there
+		if(message.validParams)
+		{
+			cancelRequest(any_cast<CancelParams&>(*message.params).id);
+		}
+	}
+	else if(message.capability != nullptr &&
+		message.capability->typedHandler != nullptr)
+	{
+		message.typedParams =
+			message.capability->typedHandler->decode(*message.envelope);
+
+		message.validParams = message.typedParams != nullptr;
+	}
+	else if(message.capability != nullptr &&
+		message.capability->handler.has_value())
+	{
+		message.validParams = !message.envelope->decodeParams(
+			message.capability->params, message.params).IsError();
+	}
+
+	if(server.collectStatistics)
+	{
+		optional<MethodId> method;
+
+		if(message.capability != nullptr)
+		{
+			method = message.capability->methodId;
+
+			server.statistics.record(*method,
+				Stage::decode,
+				chrono::steady_clock::now() - start);
+		}
+
+		server.statistics.countIn(method, bytes);
+	}
+
+	if(tracing)
+	{
+		traceMessage(server.tracer, "parse", message, start, parsed);
+		traceMessage(server.tracer,
+			"decode",
+			message,
+			parsed,
+			chrono::steady_clock::now());
+	}
+
+	return message;
+}
+
+void Connection::writeMessages()
+{
+	OutgoingMessage message;
+
+	while(outbox.pop(message))
+	{
+		if(message.token.has_value() && message.token->isCancelled())
+		{
+			// The result isn't written, it isn't needed anymore
+			variant<Number, String, Null> id = message.response->id;
+
+			visit(overload
+			(
+				[this](Number n)
+				{
+					completeRequest(n, RequestKind::fromClient);
+				},
+				[this](String& str)
+				{
+					completeRequest(str, RequestKind::fromClient);
+				},
+				[](Null)
+				{
+				}
+			), id);
+
+			message.response = make_unique<ResponseMessage>(server,
+				id,
+				message.token->error());
+		}
+
+		auto start = chrono::steady_clock::now();
+		size_t bytes;
+
+		if(message.response != nullptr)
+		{
+			try
+			{
+				JsonWriter json;
+
+				json.Object(*message.response);
+
+				bytes = json.GetSize();
+
+				auto encoded = chrono::steady_clock::now();
+
+				if(server.collectStatistics && message.method.has_value())
+				{
+					server.statistics.record(*message.method,
+						Stage::encode,
+						encoded - start);
+				}
+
+				if(server.tracer.isEnabled())
+				{
+					traceMessage(server.tracer, "encode", message, start, encoded);
+				}
+
+				start = encoded;
+
+				writer->write({json.GetString(), json.GetSize()});
+			}
+			catch(exception& error)
+			{
+				// The result can't be written
+				ResponseMessage response(server,
+					message.response->id,
+					ResponseError(ErrorCodes::InternalError, error.what(), nullopt));
+
+				JsonWriter json;
+
+				json.Object(response);
+
+				bytes = json.GetSize();
+
+				writer->write({json.GetString(), json.GetSize()});
+			}
+		}
+		else
+		{
+			bytes = message.json.size();
+
+			writer->write(message.json);
+		}
+
+		if(server.collectStatistics)
+		{
+			if(message.method.has_value())
+			{
+				server.statistics.record(*message.method,
+					Stage::write,
+					chrono::steady_clock::now() - start);
+			}
+
+			server.statistics.countOut(bytes);
+		}
+
+		if(server.tracer.isEnabled())
+		{
+			traceMessage(server.tracer,
+				"write",
+				message,
+				start,
+				chrono::steady_clock::now());
+		}
+	}
+}
+
+void Connection::post(OutgoingMessage message, Priority lane, string key)
+{
+	// The responses that the writer serializes count as empty, they are
+	// bounded by the requests
+	size_t size = message.json.size();
+
+	outbox.push(move(message), lane, size, move(key));
+}
+
+void Connection::sendError(variant<Number, String, Null> id,
+	ErrorCodes code,
+	String message)
+{
+	post({
+		make_unique<ResponseMessage>(server,
+			id,
+			ResponseError(code, message, nullopt)),
+		{},
+		nullopt
+	});
+}
+
+bool Connection::coalesceChange(IncomingMessage& change, IncomingMessage& next)
+{
+	auto isChange = [](IncomingMessage& message)
+	{
+		return message.envelope.has_value() &&
+			message.envelope->method.has_value() &&
+			!message.envelope->id.has_value() &&
+			*message.envelope->method ==
+				Capability::textDocumentDidChange.method &&
+			message.validParams &&
+			message.document.has_value();
+	};
+
+	if(!isChange(change) || !isChange(next) ||
+		change.document->uri != next.document->uri)
+	{
+		return false;
+	}
+
+	auto paramsOf = [](IncomingMessage& message)
+	{
+		if(message.typedParams != nullptr)
+		{
+			return message.typedParams->as<DidChangeTextDocumentParams>();
+		}
+
+		if(!message.params.has_value())
+		{
+			return (DidChangeTextDocumentParams*)nullptr;
+		}
+
+		return any_cast<DidChangeTextDocumentParams>(&*message.params);
+	};
+
+	DidChangeTextDocumentParams* params     = paramsOf(change);
+	DidChangeTextDocumentParams* nextParams = paramsOf(next);
+
+	if(params == nullptr || nextParams == nullptr)
+	{
+		return false;
+	}
+
+	for(auto& event: nextParams->contentChanges)
+	{
+		// The full text replaces everything before it
+		if(!event.range.has_value())
+		{
+			params->contentChanges.clear();
+		}
+
+		params->contentChanges.emplace_back(move(event));
+	}
+
+	// The version after all the changes
+	params->textDocument.version = nextParams->textDocument.version;
+	change.document->version    = next.document->version;
+
+	return true;
+}
+
+void Connection::dispatchMessages()
+{
+	size_t turn = 0;
+
+	auto pop = [this, &turn](IncomingMessage& message, bool wait)
+	{
+		if(decoded.empty())
+		{
+			shared_ptr<MessageBuffer> buffer;
+
+			if(!popFrame(*frames[0], buffer, wait))
+			{
+				return false;
+			}
+
+			message = decodeMessage(move(buffer));
+
+			return true;
+		}
+
+		bool popped = wait ?
+			decoded[turn]->pop(message):
+			decoded[turn]->tryPop(message);
+
+		if(popped)
+		{
+			turn = (turn + 1) % decoded.size();
+		}
+
+		return popped;
+	};
+
+	IncomingMessage message;
+
+	// A queued message that wasn't merged into the last didChange
+	IncomingMessage next;
+	bool hasNext = false;
+
+	while(true)
+	{
+		if(hasNext)
+		{
+			message = move(next);
+			hasNext = false;
+		}
+		else if(!pop(message, true))
+		{
+			break;
+		}
+
+		// Only the messages that are already queued are merged, so a burst
+		// isn't delayed to wait for more.
+		if(server.coalesceChanges)
+		{
+			while(!hasNext && pop(next, false))
+			{
+				hasNext = !coalesceChange(message, next);
+			}
+		}
+
+		// The messages after the exit notification are dropped
+		if(running)
+		{
+			dispatchMessage(message);
+		}
+	}
+
+	running = false;
+
+	for(thread& decoderThread: decoderThreads)
+	{
+		decoderThread.join();
+	}
+
+	// No more responses come, the handlers that wait for them go on with an
+	// error and can still send messages
+	closeAwaited();
+
+	runningHandlers.wait();
+
+	outbox.close();
+	writerThread.join();
+
+	finished = true;
+
+	// The event loop removes the connection
+	server.wake();
+}
+
+void Connection::dispatchMessage(IncomingMessage& message)
+{
+	if(message.invalidHeader)
+	{
+		sendError(Null(), ErrorCodes::ParseError, "Invalid header");
+		return;
+	}
+
+	if(!message.envelope.has_value())
+	{
+		sendError(Null(), ErrorCodes::ParseError, "Invalid json");
+		return;
+	}
+
+	MessageEnvelope& envelope = *message.envelope;
+
+	if(!envelope.method.has_value())
+	{
+		// A response to a request sent to the client
+		if(envelope.id.has_value())
+		{
+			readResponse(envelope);
+		}
+		return;
+	}
+
+	String& method = *envelope.method;
+
+	// Notifications don't have an id
+	variant<Number, String, Null> id = Null();
+	bool isRequest = envelope.id.has_value();
+
+	if(isRequest)
+	{
+		visit([&id](auto& value)
+		{
+			id = value;
+		}, *envelope.id);
+	}
+
+	if(method == Capability::exit.method)
+	{
+		running = false;
+
+		// The event loop stops reading
+		server.wake();
+	}
+	else if(method == Capability::initialize.method)
+	{
+		initialized = true;
+	}
+	else if(!initialized)
+	{
+		if(isRequest)
+		{
+			sendError(id, ErrorCodes::ServerNotInitialized,
+				"The server isn't initialized");
+		}
+		return;
+	}
+
+	const Capability* capability = message.capability;
+
+	if(method == Capability::cancelRequest.method)
+	{
+		if(message.validParams)
+		{
+			cancelRequest(any_cast<CancelParams&>(*message.params).id);
+		}
+
+		// It doesn't wait for the requests, it's meant for them
+		if(capability != nullptr && capability->hasHandler())
+		{
+			runHandler(message);
+		}
+		return;
+	}
+
+	if(capability == nullptr || !capability->hasHandler())
+	{
+		if(isRequest)
+		{
+			sendError(id, ErrorCodes::MethodNotFound, "Unknown method");
+		}
+		return;
+	}
+
+	if(!message.validParams)
+	{
+		if(isRequest)
+		{
+			sendError(id, ErrorCodes::InvalidParams, "Invalid params");
+		}
+		return;
+	}
+
+	if(isRequest)
+	{
+		CancellationToken token;
+
+		requestsRecieved.insert(*envelope.id, {capability->methodId, token});
+
+		message.token = move(token);
+
+		if(message.document.has_value() && capability->cancelOnChange)
+		{
+			addDocumentRequest(*message.document, *envelope.id);
+		}
+	}
+	else if(message.document.has_value())
+	{
+		// Before it waits for the requests that it makes useless
+		updateDocument(method, *message.document);
+	}
+
+	if(method != Capability::initialize.method &&
+		method != Capability::shutdown.method &&
+		method != Capability::exit.method)
+	{
+		Priority priority = capability->priority;
+		Access   access   = capability->access;
+
+		optional<String> document;
+
+		if(message.document.has_value())
+		{
+			document = message.document->uri;
+		}
+
+		message.dispatched = chrono::steady_clock::now();
+
+		accessScheduler.submit([this, message = move(message)]() mutable
+			{
+				// The handler can send messages to its connection, a worker
+				// that waits can run the handlers of others
+				Connection* previous = exchange(currentConnection, this);
+
+				runHandler(message);
+
+				currentConnection = previous;
+			},
+			priority,
+			access,
+			move(document));
+	}
+	else
+	{
+		// Everything before it must be done
+		runningHandlers.wait();
+
+		runHandler(message);
+	}
+}
+
+void Connection::runHandler(IncomingMessage& message)
+{
+	MessageEnvelope& envelope = *message.envelope;
+
+	// Notifications don't have an id
+	variant<Number, String, Null> id = Null();
+	bool isRequest = envelope.id.has_value();
+
+	if(isRequest)
+	{
+		visit([&id](auto& value)
+		{
+			id = value;
+		}, *envelope.id);
+	}
+
+	if(isRequest && message.token->isCancelled())
+	{
+		// Cancelled while it was queued
+		completeRequest(*envelope.id, RequestKind::fromClient);
+
+		post({
+			make_unique<ResponseMessage>(server, id, message.token->error()),
+			{},
+			nullopt
+		}, message.capability->priority);
+		return;
+	}
+
+	auto start = chrono::steady_clock::now();
+
+	bool tracing = server.tracer.isEnabled();
+
+	if(server.collectStatistics &&
+		message.dispatched != chrono::steady_clock::time_point())
+	{
+		server.statistics.record(message.capability->methodId,
+			Stage::queue,
+			start - message.dispatched);
+	}
+
+	if(tracing && message.dispatched != chrono::steady_clock::time_point())
+	{
+		traceMessage(server.tracer, "queue", message, message.dispatched, start);
+	}
+
+	// The json types that the handler makes go to its arena, the response
+	// keeps it until the writer serializes it
+	optional<MemoryScope> memory;
+
+	if(server.requestArenas)
+	{
+		message.arena = make_shared<pmr::monotonic_buffer_resource>();
+
+		memory.emplace(message.arena.get());
+	}
+
+	// The handler can defer its response
+	IncomingMessage* previous = exchange(currentMessage, &message);
+
+	try
+	{
+		optional<CancellationScope> scope;
+
+		if(isRequest)
+		{
+			scope.emplace(*message.token);
+		}
+
+		if(message.capability->typedHandler != nullptr)
+		{
+			runTypedHandler(message, id);
+		}
+		else
+		{
+			any result = (*message.capability->handler)(message.params);
+
+			if(isRequest && !message.deferred)
+			{
+				post({
+					make_unique<ResponseMessage>(server, id, move(result)),
+					{},
+					message.token,
+					message.capability->methodId,
+					nullopt,
+					message.arena
+				}, message.capability->priority);
+			}
+		}
+	}
+	catch(ResponseError& error)
+	{
+		if(isRequest && !message.deferred)
+		{
+			completeRequest(*envelope.id, RequestKind::fromClient);
+
+			post({
+				make_unique<ResponseMessage>(server, id, error),
+				{},
+				nullopt,
+				nullopt,
+				nullopt,
+				message.arena
+			}, message.capability->priority);
+		}
+	}
+	catch(exception& error)
+	{
+		if(isRequest && !message.deferred)
+		{
+			completeRequest(*envelope.id, RequestKind::fromClient);
+
+			sendError(id, ErrorCodes::InternalError, error.what());
+		}
+	}
+
+	currentMessage = previous;
+
+	auto end = chrono::steady_clock::now();
+
+	if(server.collectStatistics)
+	{
+		server.statistics.record(message.capability->methodId,
+			Stage::handler,
+			end - start);
+	}
+
+	if(tracing)
+	{
+		traceMessage(server.tracer, "handler", message, start, end);
+	}
+}
+
+void Connection::runTypedHandler(IncomingMessage& message,
+	variant<Number, String, Null> id)
+{
+	MessageEnvelope& envelope = *message.envelope;
+
+	bool isRequest = envelope.id.has_value();
+
+	// The response is written here, its result doesn't need std::any
+	JsonWriter json;
+
+	if(isRequest)
+	{
+		json.StartObject();
+
+		json.Key(Message::jsonrpc.first);
+		json.String(Message::jsonrpc.second);
+
+		json.Key(string_view("id"));
+		visit(overload
+		(
+			[&json](Number n)
+			{
+				json.Number(n);
+			},
+			[&json](String& str)
+			{
+				json.String(str);
+			},
+			[&json](Null)
+			{
+				json.Null();
+			}
+		), id);
+
+		json.Key(string_view("result"));
+	}
+
+	message.capability->typedHandler->run(*message.typedParams, json);
+
+	// A deferred response is given later
+	if(!isRequest || message.deferred)
+	{
+		return;
+	}
+
+	json.EndObject();
+
+	// The result isn't needed anymore
+	message.token->throwIfCancelled();
+
+	completeRequest(*envelope.id, RequestKind::fromClient);
+
+	post({
+		nullptr,
+		string(json.GetString(), json.GetSize()),
+		nullopt,
+		message.capability->methodId,
+		envelope.id
+	}, message.capability->priority);
+}
+
+/// The version of a document as an int
+static int versionOf(const optional<Number>& version)
+{
+	if(!version.has_value())
+	{
+		return 0;
+	}
+
+	return visit([](auto n)
+	{
+		return (int)n;
+	}, *version);
+}
+
+void Connection::updateDocument(const String& method,
+	const DocumentRef& document)
+{
+	if(method == Capability::textDocumentDidClose.method)
+	{
+		documents.erase(document.uri);
+		return;
+	}
+
+	if(method != Capability::textDocumentDidOpen.method &&
+		method != Capability::textDocumentDidChange.method)
+	{
+		return;
+	}
+
+	DocumentState& state = documents[document.uri];
+
+	int version = versionOf(document.version);
+
+	if(method == Capability::textDocumentDidChange.method &&
+		version > state.version)
+	{
+		for(auto& [id, requestVersion]: state.requests)
+		{
+			if(requestVersion >= version)
+			{
+				continue;
+			}
+
+			optional<RequestTable::Entry> request = requestsRecieved.find(id);
+
+			if(request.has_value() && request->token.has_value())
+			{
+				request->token->supersede();
+			}
+		}
+
+		state.requests.clear();
+	}
+
+	state.version = version;
+}
+
+void Connection::addDocumentRequest(const DocumentRef& document,
+	variant<Number, String> id)
+{
+	DocumentState& state = documents[document.uri];
+
+	state.requests.emplace_back(move(id), state.version);
+
+	if(state.requests.size() < state.cleanSize)
+	{
+		return;
+	}
+
+	// Forgets the requests that are done
+	auto done = remove_if(state.requests.begin(), state.requests.end(),
+		[this](auto& request)
+		{
+			return !requestsRecieved.contains(request.first);
+		});
+
+	state.requests.erase(done, state.requests.end());
+
+	state.cleanSize = max<size_t>(32, state.requests.size() * 2);
+}
+
+void Connection::cancelRequest(variant<Number, String> id)
+{
+	optional<RequestTable::Entry> request = requestsRecieved.find(id);
+
+	if(request.has_value() && request->token.has_value())
+	{
+		request->token->cancel();
+	}
+}
+
+void Connection::addRequest(variant<Number, String> id,
+	String method,
+	RequestKind kind)
+{
+	switch(kind)
+	{
+		case RequestKind::toClient:
+			requestsSent.insert(id, {internMethod(method), nullopt});
+			break;
+
+		case RequestKind::fromClient:
+			requestsRecieved.insert(id,
+				{internMethod(method), CancellationToken()});
+			break;
+	}
+}
+
+int Connection::addRequest(String method)
+{
+	return requestsSent.issue(internMethod(method));
+}
+
+optional<DeferredResponse> Connection::deferResponse()
+{
+	IncomingMessage* message = currentMessage;
+
+	if(message == nullptr || message->deferred)
+	{
+		return nullopt;
+	}
+
+	message->deferred = true;
+
+	optional<variant<Number, String>> id;
+
+	if(message->envelope->id.has_value())
+	{
+		id = *message->envelope->id;
+	}
+
+	auto state = make_shared<DeferredResponse::State>(*this,
+		move(id),
+		message->capability->methodId,
+		message->capability->priority,
+		message->token.value_or(CancellationToken()),
+		runningHandlers.add([](){}),
+		message->arena);
+
+	return DeferredResponse(move(state));
+}
+
+ResponseFuture Connection::sendRequest(const Capability& capability,
+	optional<any> params,
+	chrono::milliseconds timeout)
+{
+	auto state = make_shared<ResponseFuture::State>();
+
+	state->result = capability.result;
+
+	ClientResponse ended{
+		nullopt,
+		ResponseError(ErrorCodes::RequestCancelled,
+			"The connection ended",
+			nullopt)
+	};
+
+	{
+		lock_guard lock(awaitedMutex);
+
+		if(awaitedClosed)
+		{
+			state->response = move(ended);
+			return ResponseFuture(move(state));
+		}
+	}
+
+	int id = requestsSent.issue(internMethod(capability.method));
+
+	JsonWriter json;
+
+	try
+	{
+		json.StartObject();
+
+		json.Key(Message::jsonrpc.first);
+		json.String(Message::jsonrpc.second);
+
+		json.Key(string_view("id"));
+		json.Number(id);
+
+		json.Key(string_view("method"));
+		json.String(capability.method);
+
+		if(params.has_value() && capability.params.writer.has_value())
+		{
+			json.Key(string_view("params"));
+			(*capability.params.writer)(json, *params);
+		}
+
+		json.EndObject();
+	}
+	catch(...)
+	{
+		requestsSent.erase(Number(id));
+		throw;
+	}
+
+	{
+		lock_guard lock(awaitedMutex);
+
+		if(awaitedClosed)
+		{
+			requestsSent.erase(Number(id));
+
+			state->response = move(ended);
+			return ResponseFuture(move(state));
+		}
+
+		// While it's awaited the connection cancels its timer before it ends
+		if(timeout.count() > 0)
+		{
+			state->timeout = server.timers->schedule(timeout, [this, id]()
+			{
+				expireRequest(id);
+			});
+		}
+
+		awaited.emplace(id, state);
+	}
+
+	post({nullptr, string(json.GetString(), json.GetSize()), nullopt});
+
+	return ResponseFuture(move(state));
+}
+
+void Connection::resolve(shared_ptr<ResponseFuture::State> state,
+	ClientResponse response)
+{
+	function<void(ClientResponse&)> continuation;
+
+	{
+		lock_guard lock(state->stateMutex);
+
+		if(state->response.has_value())
+		{
+			return;
+		}
+
+		state->response = move(response);
+		continuation    = move(state->continuation);
+	}
+
+	if(!continuation)
+	{
+		return;
+	}
+
+	server.scheduler->submit(runningHandlers.add(
+		[this, state, continuation = move(continuation)]()
+		{
+			Connection* previous = exchange(currentConnection, this);
+
+			try
+			{
+				continuation(*state->response);
+			}
+			catch(...)
+			{
+				// There isn't a request to answer with the error
+			}
+
+			currentConnection = previous;
+		}),
+		Priority::normal);
+}
+
+void Connection::readResponse(MessageEnvelope& envelope)
+{
+	completeRequest(*envelope.id, RequestKind::toClient);
+
+	// sendRequest() only makes integer ids
+	auto number = get_if<Number>(&*envelope.id);
+
+	if(number == nullptr || !holds_alternative<int>(*number))
+	{
+		return;
+	}
+
+	shared_ptr<ResponseFuture::State> state;
+
+	{
+		lock_guard lock(awaitedMutex);
+
+		auto request = awaited.find(get<int>(*number));
+
+		if(request == awaited.end())
+		{
+			return;
+		}
+
+		state = move(request->second);
+		awaited.erase(request);
+	}
+
+	server.timers->cancel(state->timeout);
+
+	ClientResponse response;
+
+	if(!envelope.error.empty())
+	{
+		GenericObject error;
+		JsonHandler   handler;
+
+		handler.objectStack.emplace().extraSetter = jsonReader(handler, error);
+
+		int    code = (int)ErrorCodes::InternalError;
+		String text = "Invalid error";
+
+		if(!envelope.decode(envelope.error, handler).IsError())
+		{
+			if(auto member = error.children.find("code");
+				member != error.children.end())
+			{
+				if(auto n = get_if<Number>(&member->second))
+				{
+					code = visit([](auto value)
+					{
+						return (int)value;
+					}, *n);
+				}
+			}
+
+			if(auto member = error.children.find("message");
+				member != error.children.end())
+			{
+				if(auto str = get_if<String>(&member->second))
+				{
+					text = move(*str);
+				}
+			}
+		}
+
+		response.error = ResponseError((ErrorCodes)code, move(text), nullopt);
+	}
+	else if(state->result.has_value() && state->result->reader.has_value() &&
+		!envelope.result.empty())
+	{
+		if(envelope.decode(envelope.result, *state->result, response.result).
+			IsError())
+		{
+			response.result.reset();
+			response.error = ResponseError(ErrorCodes::ParseError,
+				"Invalid result",
+				nullopt);
+		}
+	}
+
+	resolve(move(state), move(response));
+}
+
+void Connection::expireRequest(int id)
+{
+	// Under the lock, so the dispatcher waits for the continuation before it
+	// ends the connection
+	lock_guard lock(awaitedMutex);
+
+	auto request = awaited.find(id);
+
+	if(request == awaited.end())
+	{
+		return;
+	}
+
+	shared_ptr<ResponseFuture::State> state = move(request->second);
+
+	awaited.erase(request);
+
+	requestsSent.erase(Number(id));
+
+	// The client can stop working on it
+	JsonWriter json;
+
+	json.StartObject();
+
+	json.Key(Message::jsonrpc.first);
+	json.String(Message::jsonrpc.second);
+
+	json.Key(string_view("method"));
+	json.String(Capability::cancelRequest.method);
+
+	json.Key(string_view("params"));
+	json.StartObject();
+	json.Key(string_view("id"));
+	json.Number(id);
+	json.EndObject();
+
+	json.EndObject();
+
+	post({nullptr, string(json.GetString(), json.GetSize()), nullopt});
+
+	resolve(move(state), {
+		nullopt,
+		ResponseError(ErrorCodes::RequestCancelled,
+			"The client didn't answer in time",
+			nullopt)
+	});
+}
+
+void Connection::closeAwaited()
+{
+	unordered_map<int, shared_ptr<ResponseFuture::State>> pending;
+
+	{
+		lock_guard lock(awaitedMutex);
+
+		awaitedClosed = true;
+		pending       = move(awaited);
+
+		awaited.clear();
+	}
+
+	for(auto& [id, state]: pending)
+	{
+		// The event loop never runs it after the connection is removed
+		server.timers->cancel(state->timeout);
+
+		requestsSent.erase(Number(id));
+
+		resolve(state, {
+			nullopt,
+			ResponseError(ErrorCodes::RequestCancelled,
+				"The connection ended",
+				nullopt)
+		});
+	}
+}
+
+string_view Connection::completeRequest(variant<Number, String> id,
+	RequestKind kind)
+{
+	optional<RequestTable::Entry> request;
+
+	switch(kind)
+	{
+		case RequestKind::toClient:
+			request = requestsSent.erase(id);
+			break;
+
+		case RequestKind::fromClient:
+			request = requestsRecieved.erase(id);
+			break;
+	}
+
+	if(!request.has_value())
+	{
+		return {};
+	}
+
+	return methodName(request->method);
+}
+
+void Connection::send(ObjectT& message)
+{
+	Priority lane = Priority::normal;
+	string   key;
+
+	// The diagnostics of a document and the progress reports of a token
+	// only matter until a newer one is queued
+	if(auto notification = dynamic_cast<NotificationMessage*>(&message);
+		notification != nullptr && notification->params.has_value())
+	{
+		any& params = *notification->params;
+
+		if(notification->method ==
+			Capability::textDocumentPublishDiagnostics.method)
+		{
+			lane = Priority::background;
+
+			if(auto diagnostics = any_cast<PublishDiagnosticsParams>(&params))
+			{
+				key = "diagnostics ";
+				key += string_view(diagnostics->uri);
+			}
+		}
+		else if(notification->method == Capability::progress.method)
+		{
+			lane = Priority::background;
+
+			if(auto progress = any_cast<ProgressParams>(&params);
+				progress != nullptr &&
+				holds_alternative<WorkDoneProgressReport>(progress->value))
+			{
+				key = "progress ";
+
+				visit(overload
+				(
+					[&key](Number& n)
+					{
+						key += visit([](auto value)
+						{
+							return to_string(value);
+						}, n);
+					},
+					[&key](String& str)
+					{
+						key += string_view(str);
+					}
+				), progress->token);
+			}
+		}
+	}
+
+	// The handler waits while the client doesn't read
+	outbox.throttle(server.outboxLimit);
+
+	JsonWriter writer;
+
+	writer.Object(message);
+
+	post({nullptr, string(writer.GetString(), writer.GetSize()), nullopt},
+		lane,
+		move(key));
+}
+
+size_t Connection::pendingBytes() const
+{
+	return outbox.pendingBytes();
+}
+
+bool Connection::isFinished() const
+{
+	return finished;
+}
+
+Connection* Connection::current()
+{
+	return currentConnection;
+}
+
+}
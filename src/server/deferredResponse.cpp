@@ -0,0 +1,175 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <utility>
+
+#include <libclsp/server/connection.hpp>
+#include <libclsp/server/deferredResponse.hpp>
+#include <libclsp/types/responseMessage.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+DeferredResponse::State::State(Connection& connection,
+	optional<variant<Number, String>> id,
+	MethodId method,
+	Priority priority,
+	CancellationToken token,
+	function<void()> release,
+	shared_ptr<pmr::memory_resource> arena):
+	arena(move(arena)),
+	connection(connection),
+	id(move(id)),
+	method(method),
+	priority(priority),
+	token(move(token)),
+	release(move(release))
+{};
+
+DeferredResponse::State::~State()
+{
+	// The last copy was dropped without an answer
+	finish(*this, nullopt, ResponseError(ErrorCodes::InternalError,
+		"The handler didn't answer",
+		nullopt));
+}
+
+DeferredResponse::DeferredResponse(shared_ptr<State> state):
+	state(move(state))
+{};
+
+DeferredResponse::~DeferredResponse(){};
+
+void DeferredResponse::finish(State& state,
+	optional<any> result,
+	optional<ResponseError> error)
+{
+	if(state.done.exchange(true))
+	{
+		return;
+	}
+
+	if(state.id.has_value())
+	{
+		Connection& connection = state.connection;
+
+		variant<Number, String, Null> id = visit([](auto& value)
+			{
+				return variant<Number, String, Null>(value);
+			}, *state.id);
+
+		if(error.has_value())
+		{
+			connection.completeRequest(*state.id, RequestKind::fromClient);
+
+			connection.post({
+				make_unique<ResponseMessage>(connection.server,
+					id,
+					move(*error)),
+				{},
+				nullopt,
+				nullopt,
+				nullopt,
+				state.arena
+			}, state.priority);
+		}
+		else
+		{
+			// A cancelled request is answered with the error by the writer
+			connection.post({
+				make_unique<ResponseMessage>(connection.server,
+					id,
+					move(*result)),
+				{},
+				state.token,
+				state.method,
+				nullopt,
+				state.arena
+			}, state.priority);
+		}
+	}
+
+	// After the response is queued, so the writer sends it
+	state.release();
+}
+
+optional<DeferredResponse> DeferredResponse::defer()
+{
+	Connection* connection = Connection::current();
+
+	if(connection == nullptr)
+	{
+		return nullopt;
+	}
+
+	return connection->deferResponse();
+}
+
+void DeferredResponse::resolve(any result)
+{
+	finish(*state, move(result), nullopt);
+}
+
+void DeferredResponse::fail(ResponseError error)
+{
+	finish(*state, nullopt, move(error));
+}
+
+bool DeferredResponse::isDone() const
+{
+	return state->done;
+}
+
+const CancellationToken& DeferredResponse::token() const
+{
+	return state->token;
+}
+
+HandlerContext::HandlerContext(Connection* connection,
+	CancellationToken token):
+	connection(connection),
+	token(move(token))
+{};
+
+HandlerContext::~HandlerContext(){};
+
+HandlerContext HandlerContext::current()
+{
+	return HandlerContext(Connection::current(), CancellationToken::current());
+}
+
+void HandlerContext::run(const function<void()>& function) const
+{
+	Connection* previous = exchange(Connection::currentConnection, connection);
+
+	CancellationScope scope(token);
+
+	try
+	{
+		function();
+	}
+	catch(...)
+	{
+		Connection::currentConnection = previous;
+		throw;
+	}
+
+	Connection::currentConnection = previous;
+}
+
+}
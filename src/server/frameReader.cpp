@@ -0,0 +1,292 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+#include <unistd.h>
+
+#include <libclsp/server/frameReader.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+constexpr size_t npos = string_view::npos;
+
+/// If the name of a header is Content-Length, in any case.
+/// The first character of the name is passed apart because it can be in
+/// FrameReader::carry.
+static bool isContentLength(char first, const char* rest, size_t length)
+{
+	constexpr string_view contentLength = "content-length";
+
+	if(length != contentLength.length() || tolower((unsigned char)first) != contentLength[0])
+	{
+		return false;
+	}
+
+	for(size_t i = 1; i < length; i++)
+	{
+		if(tolower((unsigned char)rest[i]) != contentLength[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FrameReader::FrameReader(int fd, size_t chunkSize):
+	fd(fd),
+	chunk(new char[chunkSize + 1]),
+	chunkSize(chunkSize),
+	bodyLength(npos)
+{};
+
+FrameReader::~FrameReader(){};
+
+void FrameReader::reserve(size_t n)
+{
+	// The tail is never after the end of the chunk
+	if(n <= chunkSize - tail)
+	{
+		return;
+	}
+
+	size_t pending = tail - head;
+
+	// Chunks only grow, so a big message doesn't make more of them
+	size_t size = max(chunkSize, pending + n);
+
+	if(size == chunkSize && chunk.use_count() == 1)
+	{
+		// No message uses the chunk
+		memmove(chunk.get(), chunk.get() + head, pending);
+	}
+	else
+	{
+		shared_ptr<char[]> next(new char[size + 1]);
+
+		memcpy(next.get(), chunk.get() + head, pending);
+
+		chunk     = move(next);
+		chunkSize = size;
+	}
+
+	// The '\0' of the previous message isn't in this memory
+	if(carried)
+	{
+		chunk[0] = carry;
+		carried  = false;
+	}
+
+	if(bodyLength != npos)
+	{
+		bodyStart -= head;
+	}
+
+	head = 0;
+	tail = pending;
+}
+
+bool FrameReader::parseHeader()
+{
+	const char* begin = chunk.get() + head;
+	const char* end   = chunk.get() + tail;
+
+	// The \r\n\r\n after the header
+	const char* headerEnd = nullptr;
+
+	for(const char* p = begin;
+		(p = (const char*)memchr(p, '\r', end - p)) != nullptr && end - p >= 4;
+		p++)
+	{
+		if(p[1] == '\n' && p[2] == '\r' && p[3] == '\n')
+		{
+			headerEnd = p;
+			break;
+		}
+	}
+
+	if(headerEnd == nullptr)
+	{
+		invalid = (size_t)(end - begin) > maxHeaderLength;
+
+		return false;
+	}
+
+	size_t length = npos;
+
+	for(const char* line = begin; line < headerEnd;)
+	{
+		const char* lineEnd = (const char*)memchr(line, '\r', headerEnd - line);
+
+		if(lineEnd == nullptr)
+		{
+			lineEnd = headerEnd;
+		}
+
+		const char* colon = (const char*)memchr(line, ':', lineEnd - line);
+
+		if(colon == nullptr || colon == line)
+		{
+			invalid = true;
+			return false;
+		}
+
+		char first = line == begin && carried? carry: line[0];
+
+		if(isContentLength(first, line, colon - line))
+		{
+			const char* value = colon + 1;
+
+			while(value < lineEnd && *value == ' ')
+			{
+				value++;
+			}
+
+			auto [last, error] = from_chars(value, lineEnd, length);
+
+			if(error != errc() || last != lineEnd)
+			{
+				invalid = true;
+				return false;
+			}
+		}
+
+		// Other headers like Content-Type are ignored
+		line = lineEnd + 2;
+	}
+
+	size_t start = headerEnd + 4 - chunk.get();
+
+	// The end of the json must fit in a size_t, see read() and next()
+	if(length == npos ||
+		length > maxBodyLength ||
+		length > numeric_limits<size_t>::max() - start)
+	{
+		invalid = true;
+		return false;
+	}
+
+	bodyStart  = start;
+	bodyLength = length;
+	carried    = false;
+
+	return true;
+}
+
+ssize_t FrameReader::read()
+{
+	size_t wanted = minReadSize;
+
+	// The whole json of the next message must fit in the chunk
+	if(bodyLength != npos && bodyStart + bodyLength > tail)
+	{
+		wanted = max(wanted, bodyStart + bodyLength - tail);
+	}
+
+	reserve(wanted);
+
+	ssize_t n = readSome(chunk.get() + tail, chunkSize - tail);
+
+	if(n > 0)
+	{
+		tail += n;
+	}
+
+	return n;
+}
+
+shared_ptr<MessageBuffer> FrameReader::next()
+{
+	if(invalid || (bodyLength == npos && !parseHeader()))
+	{
+		return nullptr;
+	}
+
+	size_t end = bodyStart + bodyLength;
+
+	if(end > tail)
+	{
+		return nullptr;
+	}
+
+	if(end < tail)
+	{
+		// The next message starts where the '\0' goes
+		carry   = chunk[end];
+		carried = true;
+		head    = end;
+	}
+	else
+	{
+		// The next read() starts after the '\0'. A message that ends with
+		// the chunk has its '\0' in the extra byte, so the chunk is full.
+		head = min(end + 1, chunkSize);
+		tail = head;
+	}
+
+	chunk[end] = '\0';
+
+	auto message = make_shared<MessageBuffer>(chunk,
+		chunk.get() + bodyStart,
+		bodyLength);
+
+	bodyLength = npos;
+
+	return message;
+}
+
+bool FrameReader::failed() const
+{
+	return invalid;
+}
+
+int FrameReader::pollFd() const
+{
+	return fd;
+}
+
+bool FrameReader::inChunk(const char* buffer, size_t length) const
+{
+	const char* begin = chunk.get();
+	const char* end   = begin + chunkSize;
+
+	return buffer >= begin && buffer <= end && length <= (size_t)(end - buffer);
+}
+
+ssize_t FrameReader::readSome(char* buffer, size_t length)
+{
+	ssize_t n;
+
+	do
+	{
+		n = ::read(fd, buffer, length);
+	}
+	while(n < 0 && errno == EINTR);
+
+	return n;
+}
+
+}
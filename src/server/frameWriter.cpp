@@ -0,0 +1,116 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include <libclsp/server/frameWriter.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+FrameWriter::FrameWriter(int fd):
+	fd(fd)
+{
+	struct stat status;
+
+	socket = fstat(fd, &status) == 0 && S_ISSOCK(status.st_mode);
+};
+
+FrameWriter::~FrameWriter(){};
+
+bool FrameWriter::write(string_view json)
+{
+	constexpr string_view name = "Content-Length: ";
+
+	lock_guard<mutex> lock(writeMutex);
+
+	memcpy(header, name.data(), name.length());
+
+	char* end = to_chars(header + name.length(),
+		header + maxHeaderLength,
+		json.length()).ptr;
+
+	memcpy(end, "\r\n\r\n", 4);
+
+	iovec parts[2] = {
+		// Header
+		{header, (size_t)(end + 4 - header)},
+
+		// Json
+		{(void*)json.data(), json.length()}
+	};
+
+	iovec* part = parts;
+	int    left = 2;
+
+	while(!broken && left > 0)
+	{
+		ssize_t n = writeParts(part, left);
+
+		if(n < 0)
+		{
+			broken = errno != EINTR;
+			continue;
+		}
+
+		// Skips what was written
+		while(left > 0 && (size_t)n >= part->iov_len)
+		{
+			n -= part->iov_len;
+			part++;
+			left--;
+		}
+
+		if(left > 0)
+		{
+			part->iov_base = (char*)part->iov_base + n;
+			part->iov_len -= n;
+		}
+	}
+
+	return !broken;
+}
+
+ssize_t FrameWriter::writeParts(iovec* parts, int count)
+{
+	if(!socket)
+	{
+		return writev(fd, parts, count);
+	}
+
+	// A closed connection is an error, not a SIGPIPE
+	msghdr socketMessage = {};
+
+	socketMessage.msg_iov    = parts;
+	socketMessage.msg_iovlen = count;
+
+	return sendmsg(fd, &socketMessage, MSG_NOSIGNAL);
+}
+
+bool FrameWriter::failed() const
+{
+	return broken;
+}
+
+}
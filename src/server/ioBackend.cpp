@@ -0,0 +1,549 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+
+#ifdef LIBCLSP_URING
+#include <liburing.h>
+#endif
+
+#include <libclsp/server/ioBackend.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+#ifdef LIBCLSP_URING
+
+/// The number of entries of the rings
+constexpr unsigned ringEntries = 8;
+
+/// The offset of a write at the position of the file
+constexpr uint64_t currentPosition = (uint64_t)-1;
+
+/// Reads an input with a multishot read of io_uring.
+///
+/// The kernel reads the input in the background into buffers that are
+/// registered with the ring, and the event loop watches the file descriptor
+/// of the ring, which is readable when a read completed. The completions are
+/// copied to the chunk of the FrameReader, so the messages still don't copy
+/// it.
+class UringFrameReader: public FrameReader
+{
+private:
+	/// The number of registered buffers, a power of 2
+	constexpr static unsigned bufferCount = 16;
+
+	/// The size of each buffer.
+	/// FrameReader::read() always has space for a whole one.
+	constexpr static unsigned bufferSize = FrameReader::minReadSize;
+
+	/// The group of the buffers
+	constexpr static int bufferGroup = 0;
+
+	io_uring ring;
+
+	/// If the ring was made
+	bool ready = false;
+
+	/// The ring of the buffers that the kernel can fill
+	io_uring_buf_ring* buffers = nullptr;
+
+	/// The memory of the buffers
+	unique_ptr<char[]> memory;
+
+	/// If the multishot read is submitted.
+	/// The kernel ends it when there aren't free buffers.
+	bool armed = false;
+
+	/// If the input ended
+	bool ended = false;
+
+	/// The error of the read, 0 if there isn't one
+	int error = 0;
+
+	UringFrameReader(int fd);
+
+	/// Makes the ring and registers the buffers.
+	/// false if this kernel can't do it.
+	bool start();
+
+	/// Submits the multishot read
+	void arm();
+
+	/// Gives a buffer back to the kernel
+	void recycle(unsigned id);
+
+protected:
+	ssize_t readSome(char* buffer, size_t length) override;
+
+public:
+	virtual ~UringFrameReader();
+
+	int pollFd() const override;
+
+	/// The reader of an input, nullptr if it isn't a pipe or a socket, or
+	/// if io_uring can't read it.
+	static unique_ptr<FrameReader> make(int fd);
+};
+
+UringFrameReader::UringFrameReader(int fd):
+	FrameReader(fd)
+{};
+
+UringFrameReader::~UringFrameReader()
+{
+	if(buffers != nullptr)
+	{
+		io_uring_free_buf_ring(&ring, buffers, bufferCount, bufferGroup);
+	}
+
+	// It cancels the read
+	if(ready)
+	{
+		io_uring_queue_exit(&ring);
+	}
+};
+
+bool UringFrameReader::start()
+{
+	if(io_uring_queue_init(ringEntries, &ring, 0) < 0)
+	{
+		return false;
+	}
+
+	ready = true;
+
+	io_uring_probe* probe = io_uring_get_probe_ring(&ring);
+
+	bool multishot = probe != nullptr &&
+		io_uring_opcode_supported(probe, IORING_OP_READ_MULTISHOT);
+
+	io_uring_free_probe(probe);
+
+	if(!multishot)
+	{
+		return false;
+	}
+
+	int result;
+
+	buffers = io_uring_setup_buf_ring(&ring,
+		bufferCount,
+		bufferGroup,
+		0,
+		&result);
+
+	if(buffers == nullptr)
+	{
+		return false;
+	}
+
+	memory.reset(new char[bufferCount * bufferSize]);
+
+	for(unsigned id = 0; id < bufferCount; id++)
+	{
+		io_uring_buf_ring_add(buffers,
+			memory.get() + id * bufferSize,
+			bufferSize,
+			id,
+			io_uring_buf_ring_mask(bufferCount),
+			id);
+	}
+
+	io_uring_buf_ring_advance(buffers, bufferCount);
+
+	arm();
+
+	return true;
+}
+
+void UringFrameReader::arm()
+{
+	io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+
+	io_uring_prep_read_multishot(sqe, fd, 0, 0, bufferGroup);
+
+	io_uring_submit(&ring);
+
+	armed = true;
+}
+
+void UringFrameReader::recycle(unsigned id)
+{
+	io_uring_buf_ring_add(buffers,
+		memory.get() + id * bufferSize,
+		bufferSize,
+		id,
+		io_uring_buf_ring_mask(bufferCount),
+		0);
+
+	io_uring_buf_ring_advance(buffers, 1);
+}
+
+ssize_t UringFrameReader::readSome(char* buffer, size_t length)
+{
+	// The completions are copied, so the buffer must be real
+	if(!inChunk(buffer, length))
+	{
+		errno = EFAULT;
+		return -1;
+	}
+
+	size_t n = 0;
+
+	while(error == 0 && !ended)
+	{
+		io_uring_cqe* cqe;
+
+		// Only the first completion is waited for, the rest are taken while
+		// they are there
+		int result = n == 0?
+			io_uring_wait_cqe(&ring, &cqe):
+			io_uring_peek_cqe(&ring, &cqe);
+
+		if(result == -EINTR)
+		{
+			continue;
+		}
+
+		if(result < 0)
+		{
+			error = n == 0? -result: 0;
+			break;
+		}
+
+		result = cqe->res;
+
+		// A completion is taken whole, a part left in a buffer wouldn't make
+		// the ring readable
+		if(result > 0 && n + result > length)
+		{
+			break;
+		}
+
+		unsigned flags = cqe->flags;
+
+		io_uring_cqe_seen(&ring, cqe);
+
+		if(!(flags & IORING_CQE_F_MORE))
+		{
+			armed = false;
+		}
+
+		if(result > 0)
+		{
+			unsigned id = flags >> IORING_CQE_BUFFER_SHIFT;
+
+			memcpy(buffer + n, memory.get() + id * bufferSize, result);
+			n += result;
+
+			recycle(id);
+		}
+		else if(result == 0)
+		{
+			ended = true;
+		}
+		else if(result != -ENOBUFS && result != -EINTR && result != -EAGAIN)
+		{
+			error = -result;
+		}
+
+		// -ENOBUFS ends the read when all the buffers are full, they are
+		// free again after their completions
+		if(!armed && !ended && error == 0)
+		{
+			arm();
+		}
+	}
+
+	if(n > 0)
+	{
+		return n;
+	}
+
+	if(error != 0)
+	{
+		errno = error;
+		return -1;
+	}
+
+	return 0;
+}
+
+int UringFrameReader::pollFd() const
+{
+	return ring.ring_fd;
+}
+
+unique_ptr<FrameReader> UringFrameReader::make(int fd)
+{
+	struct stat status;
+
+	// A multishot read needs an input that can be polled
+	if(fstat(fd, &status) != 0 ||
+		!(S_ISFIFO(status.st_mode) || S_ISSOCK(status.st_mode)))
+	{
+		return nullptr;
+	}
+
+	unique_ptr<UringFrameReader> reader(new UringFrameReader(fd));
+
+	if(!reader->start())
+	{
+		return nullptr;
+	}
+
+	return reader;
+}
+
+/// Writes messages with io_uring.
+///
+/// The header and the json are two linked writes submitted with one system
+/// call, and the header is written from a buffer registered with the ring.
+class UringFrameWriter: public FrameWriter
+{
+private:
+	io_uring ring;
+
+	/// If the ring was made
+	bool ready = false;
+
+	/// If the header buffer is registered
+	bool registered = false;
+
+	UringFrameWriter(int fd);
+
+	/// Makes the ring and registers the header.
+	/// false if this kernel can't do it.
+	bool start();
+
+protected:
+	ssize_t writeParts(iovec* parts, int count) override;
+
+public:
+	virtual ~UringFrameWriter();
+
+	/// The writer of an output, nullptr if io_uring can't write it
+	static unique_ptr<FrameWriter> make(int fd);
+};
+
+UringFrameWriter::UringFrameWriter(int fd):
+	FrameWriter(fd)
+{};
+
+UringFrameWriter::~UringFrameWriter()
+{
+	if(ready)
+	{
+		io_uring_queue_exit(&ring);
+	}
+};
+
+bool UringFrameWriter::start()
+{
+	if(io_uring_queue_init(ringEntries, &ring, 0) < 0)
+	{
+		return false;
+	}
+
+	ready = true;
+
+	iovec headerBuffer = {header, maxHeaderLength};
+
+	// Without it the header is a normal write
+	registered = io_uring_register_buffers(&ring, &headerBuffer, 1) == 0;
+
+	return true;
+}
+
+ssize_t UringFrameWriter::writeParts(iovec* parts, int count)
+{
+	count = min(count, (int)ringEntries);
+
+	for(int i = 0; i < count; i++)
+	{
+		io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+
+		char*  base   = (char*)parts[i].iov_base;
+		size_t length = parts[i].iov_len;
+
+		if(socket)
+		{
+			// A closed connection is an error, not a SIGPIPE
+			io_uring_prep_send(sqe, fd, base, length, MSG_NOSIGNAL);
+		}
+		else if(registered && base >= header && base < header + maxHeaderLength)
+		{
+			io_uring_prep_write_fixed(sqe, fd, base, length, currentPosition, 0);
+		}
+		else
+		{
+			io_uring_prep_write(sqe, fd, base, length, currentPosition);
+		}
+
+		io_uring_sqe_set_data64(sqe, i);
+
+		// A short write cancels the parts after it
+		if(i + 1 < count)
+		{
+			sqe->flags |= IOSQE_IO_LINK;
+		}
+	}
+
+	int submitted = io_uring_submit_and_wait(&ring, count);
+
+	if(submitted < 0)
+	{
+		errno = -submitted;
+		return -1;
+	}
+
+	int results[ringEntries];
+
+	for(int i = 0; i < submitted; i++)
+	{
+		io_uring_cqe* cqe;
+		int result;
+
+		do
+		{
+			result = io_uring_wait_cqe(&ring, &cqe);
+		}
+		while(result == -EINTR);
+
+		if(result < 0)
+		{
+			errno = -result;
+			return -1;
+		}
+
+		results[io_uring_cqe_get_data64(cqe)] = cqe->res;
+
+		io_uring_cqe_seen(&ring, cqe);
+	}
+
+	ssize_t written = 0;
+
+	for(int i = 0; i < submitted; i++)
+	{
+		if(results[i] < 0)
+		{
+			if(written == 0)
+			{
+				errno = -results[i];
+				return -1;
+			}
+			break;
+		}
+
+		written += results[i];
+
+		if((size_t)results[i] < parts[i].iov_len)
+		{
+			break;
+		}
+	}
+
+	return written;
+}
+
+unique_ptr<FrameWriter> UringFrameWriter::make(int fd)
+{
+	unique_ptr<UringFrameWriter> writer(new UringFrameWriter(fd));
+
+	if(!writer->start())
+	{
+		return nullptr;
+	}
+
+	return writer;
+}
+
+#endif
+
+bool uringAvailable()
+{
+#ifdef LIBCLSP_URING
+	static const bool available = []()
+	{
+		io_uring ring;
+
+		if(io_uring_queue_init(2, &ring, 0) < 0)
+		{
+			return false;
+		}
+
+		io_uring_probe* probe = io_uring_get_probe_ring(&ring);
+
+		bool multishot = probe != nullptr &&
+			io_uring_opcode_supported(probe, IORING_OP_READ_MULTISHOT);
+
+		io_uring_free_probe(probe);
+		io_uring_queue_exit(&ring);
+
+		return multishot;
+	}();
+
+	return available;
+#else
+	return false;
+#endif
+}
+
+unique_ptr<FrameReader> makeFrameReader(int fd, IoBackend backend)
+{
+#ifdef LIBCLSP_URING
+	if(backend == IoBackend::uring)
+	{
+		if(unique_ptr<FrameReader> reader = UringFrameReader::make(fd))
+		{
+			return reader;
+		}
+	}
+#else
+	(void)backend;
+#endif
+
+	return make_unique<FrameReader>(fd);
+}
+
+unique_ptr<FrameWriter> makeFrameWriter(int fd, IoBackend backend)
+{
+#ifdef LIBCLSP_URING
+	if(backend == IoBackend::uring)
+	{
+		if(unique_ptr<FrameWriter> writer = UringFrameWriter::make(fd))
+		{
+			return writer;
+		}
+	}
+#else
+	(void)backend;
+#endif
+
+	return make_unique<FrameWriter>(fd);
+}
+
+}
@@ -15,6 +15,7 @@
 // along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <libclsp/server/jsonHandler.hpp>
+#include <libclsp/server/objectDescriptor.hpp>
 #include <libclsp/types/objectT.hpp>
 
 namespace clsp
@@ -22,143 +23,80 @@ namespace clsp
 
 using namespace std;
 
-bool JsonHandler::Null()
+template<class StaticSetter, class DynamicSetter, class... Args>
+bool JsonHandler::setValue(StaticSetter FieldSetter::* staticSetter,
+	DynamicSetter ValueSetter::* dynamicSetter,
+	Args&&... args)
 {
-
-	function<void()> setNull;
-
-
 	auto& topObject = objectStack.top();
 
-	auto& setterMap = topObject.setterMap;
-
-	auto jsonPair = setterMap.find(lastKey);
+	if(topObject.field != nullptr) // Key found in the descriptor
+	{
+		auto* field = topObject.field;
 
+		auto setter = field->setter.*staticSetter;
 
-	if(jsonPair != setterMap.end()) // Key found in map
-	{
-		if(jsonPair->second.setNull.has_value())
-		{
-			setNull = jsonPair->second.setNull.value();
-		}
-		else
+		if(setter == nullptr)
 		{
-			// This Key is not a Null
+			// The member doesn't have this json type
 			return false;
 		}
-	}
-	else // Key not found
-	{
-		auto& extraSetter = topObject.extraSetter;
 
-		if(extraSetter.has_value())
+		if(topObject.fieldIndex < ObjectDescriptor::maxMembers)
 		{
-			setNull = extraSetter->setNull.value();
+			topObject.neededMask &= ~(uint64_t(1) << topObject.fieldIndex);
 		}
-		else
-		{
-			// Key not found and no extra members on the object
-			return false;
-		}
-	}
-
-	//TODO add exceptions
-
-	setNull();
-
-	return true;
-}
-
-bool JsonHandler::Bool(bool b)
-{
-	function<void(bool)> setBoolean;
 
+		//TODO add exceptions
 
-	auto& topObject = objectStack.top();
+		setter(topObject.fieldObject, *this, forward<Args>(args)...);
 
-	auto& setterMap = topObject.setterMap;
+		return true;
+	}
 
-	auto jsonPair = setterMap.find(lastKey);
+	if(topObject.descriptor != nullptr)
+	{
+		auto* descriptor = topObject.descriptor;
 
+		auto extraSetter = descriptor->extraSetter.*staticSetter;
 
-	if(jsonPair != setterMap.end()) // Key found in map
-	{
-		if(jsonPair->second.setBoolean.has_value())
-		{
-			setBoolean = jsonPair->second.setBoolean.value();
-		}
-		else
+		if(extraSetter != nullptr)
 		{
-			// This Key is not a Boolean
-			return false;
-		}
-	}
-	else // Key not found
-	{
-		auto& extraSetter = topObject.extraSetter;
+			extraSetter(topObject.self, *this, forward<Args>(args)...);
 
-		if(extraSetter.has_value())
-		{
-			setBoolean = extraSetter->setBoolean.value();
-		}
-		else
-		{
-			// Key not found and no extra members on the object
-			return false;
+			return true;
 		}
 	}
 
-	//TODO add exceptions
-
-	setBoolean(b);
-
-	return true;
-}
-
-bool JsonHandler::Number(clsp::Number n)
-{
-	function<void(clsp::Number)> setNumber;
-
+	auto& extraSetter = topObject.extraSetter;
 
-	auto& topObject = objectStack.top();
-
-	auto& setterMap = topObject.setterMap;
-
-	auto jsonPair = setterMap.find(lastKey);
+	if(extraSetter.has_value() && ((*extraSetter).*dynamicSetter).has_value())
+	{
+		// A copy, the setter can change the stack
+		auto setter = ((*extraSetter).*dynamicSetter).value();
 
+		setter(forward<Args>(args)...);
 
-	if(jsonPair != setterMap.end()) // Key found in map
-	{
-		if(jsonPair->second.setNumber.has_value())
-		{
-			setNumber = jsonPair->second.setNumber.value();
-		}
-		else
-		{
-			// This Key is not a Number
-			return false;
-		}
+		return true;
 	}
-	else // Key not found
-	{
-		auto& extraSetter = topObject.extraSetter;
 
-		if(extraSetter.has_value())
-		{
-			setNumber = extraSetter->setNumber.value();
-		}
-		else
-		{
-			// Key not found and no extra members on the object
-			return false;
-		}
-	}
+	// Key not found and no extra members on the object
+	return false;
+}
 
-	//TODO add exceptions
+bool JsonHandler::Null()
+{
+	return setValue(&FieldSetter::setNull, &ValueSetter::setNull);
+}
 
-	setNumber(n);
+bool JsonHandler::Bool(bool b)
+{
+	return setValue(&FieldSetter::setBoolean, &ValueSetter::setBoolean, b);
+}
 
-	return true;
+bool JsonHandler::Number(clsp::Number n)
+{
+	return setValue(&FieldSetter::setNumber, &ValueSetter::setNumber, n);
 }
 
 bool JsonHandler::Int(int i)
@@ -186,101 +124,43 @@ bool JsonHandler::Double(double d)
 	return Number(d);
 }
 
-bool JsonHandler::String(const char* str, SizeType, bool)
+bool JsonHandler::String(const char* str, SizeType length, bool)
 {
-	function<void(clsp::String)> setString;
-
-
-	auto& topObject = objectStack.top();
-
-	auto& setterMap = topObject.setterMap;
-
-	auto jsonPair = setterMap.find(lastKey);
-
-
-	if(jsonPair != setterMap.end()) // Key found in map
-	{
-		if(jsonPair->second.setString.has_value())
-		{
-			setString = jsonPair->second.setString.value();
-		}
-		else
-		{
-			// This Key is not a String
-			return false;
-		}
-	}
-	else // Key not found
-	{
-		auto& extraSetter = topObject.extraSetter;
-
-		if(extraSetter.has_value())
-		{
-			setString = extraSetter->setString.value();
-		}
-		else
-		{
-			// Key not found and no extra members on the object
-			return false;
-		}
-	}
-
-	//TODO add exceptions
-
-	setString(str);
-
-	return true;
+	// The string is copied once out of the reader, the setters move it to
+	// its member
+	return setValue(&FieldSetter::setString, &ValueSetter::setString,
+		clsp::String(str, length));
 }
 
 bool JsonHandler::StartObject()
 {
-	function<void()> setObject;
-
+	return setValue(&FieldSetter::setObject, &ValueSetter::setObject);
+}
 
+bool JsonHandler::Key(const char* str, SizeType length, bool)
+{
 	auto& topObject = objectStack.top();
 
-	auto& setterMap = topObject.setterMap;
-
-	auto jsonPair = setterMap.find(lastKey);
+	if(topObject.descriptor != nullptr)
+	{
+		auto member = topObject.descriptor->find({str, length}, topObject.self);
 
+		topObject.field       = member.field;
+		topObject.fieldObject = member.object;
+		topObject.fieldIndex  = member.index;
 
-	if(jsonPair != setterMap.end()) // Key found in map
-	{
-		if(jsonPair->second.setObject.has_value())
-		{
-			setObject = jsonPair->second.setObject.value();
-		}
-		else
+		if(member.field != nullptr)
 		{
-			// This Key is not a Object
-			return false;
+			return true;
 		}
 	}
-	else // Key not found
+	else
 	{
-		auto& extraSetter = topObject.extraSetter;
-
-		if(extraSetter.has_value())
-		{
-			setObject = extraSetter->setObject.value();
-		}
-		else
-		{
-			// Key not found and no extra members on the object
-			return false;
-		}
+		topObject.field = nullptr;
 	}
 
-	//TODO add exceptions
-
-	setObject();
-
-	return true;
-}
-
-bool JsonHandler::Key(const char* str, SizeType, bool)
-{
-	lastKey = str;
+	// Only the extra members need the key
+	lastKey.assign(str, length);
 
 	return true;
 }
@@ -291,61 +171,19 @@ bool JsonHandler::EndObject(SizeType)
 	{
 		objectStack.pop();
 
-		// The key returns to the last Object/Array
-		lastKey = objectStack.top().key;
-
 		return true;
 	}
 	else
 	{
+		missingMembers = objectStack.top().missingMembers();
+
 		return false;
 	}
 }
 
 bool JsonHandler::StartArray()
 {
-	function<void()> setArray;
-
-
-	auto& topArray = objectStack.top();
-
-	auto& setterMap = topArray.setterMap;
-
-	auto jsonPair = setterMap.find(lastKey);
-
-
-	if(jsonPair != setterMap.end()) // Key found in map
-	{
-		if(jsonPair->second.setArray.has_value())
-		{
-			setArray = jsonPair->second.setArray.value();
-		}
-		else
-		{
-			// This Key is not a Array
-			return false;
-		}
-	}
-	else // Key not found
-	{
-		auto& extraSetter = topArray.extraSetter;
-
-		if(extraSetter.has_value())
-		{
-			setArray = extraSetter->setArray.value();
-		}
-		else
-		{
-			// Key not found and no extra members on the object
-			return false;
-		}
-	}
-
-	//TODO add exceptions
-
-	setArray();
-
-	return true;
+	return setValue(&FieldSetter::setArray, &ValueSetter::setArray);
 }
 
 bool JsonHandler::EndArray(SizeType elementCount)
@@ -357,18 +195,27 @@ bool JsonHandler::EndArray(SizeType elementCount)
 void JsonHandler::pushInitializer()
 {
 	objectStack.emplace(ObjectInitializer{
-		// Key
-		lastKey,
+		// NeededMask
+		0,
 
-		// SetterMap
-		{},
+		// Object
+		nullptr,
 
-		// NeededMap
-		{},
+		// Self
+		nullptr,
 
-		// Object
+		// Descriptor
 		nullptr,
 
+		// Field
+		nullptr,
+
+		// FieldObject
+		nullptr,
+
+		// FieldIndex
+		0,
+
 		// Handler,
 		this,
 
@@ -380,4 +227,55 @@ void JsonHandler::pushInitializer()
 	});
 }
 
+/// Space for the initializers of the first levels of nesting
+constexpr size_t reservedDepth = 8;
+
+/// An empty stack in the arena
+static pmr::vector<ObjectInitializer> makeStack(pmr::memory_resource* arena)
+{
+	pmr::vector<ObjectInitializer> stack(arena);
+
+	stack.reserve(reservedDepth);
+
+	return stack;
+}
+
+JsonHandler::JsonHandler():
+	arena(arenaBuffer, sizeof(arenaBuffer)),
+	objectStack(makeStack(&arena))
+{};
+
+void MakerDeleter::operator()(ObjectT* maker) const
+{
+	maker->~ObjectT();
+}
+
+void JsonHandler::pushObject(ObjectT& object)
+{
+	pushInitializer();
+	object.fillInitializer(objectStack.top());
+}
+
+void ObjectInitializer::bind(ObjectT* object,
+	void* self,
+	const ObjectDescriptor& descriptor)
+{
+	this->object     = object;
+	this->self       = self;
+	this->descriptor = &descriptor;
+
+	// Binding again changes all the members
+	neededMask = descriptor.neededMask();
+}
+
+vector<string_view> ObjectInitializer::missingMembers() const
+{
+	if(descriptor == nullptr)
+	{
+		return {};
+	}
+
+	return descriptor->keys(neededMask);
+}
+
 }
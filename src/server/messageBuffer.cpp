@@ -0,0 +1,50 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cstring>
+
+#include <libclsp/server/messageBuffer.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+MessageBuffer::MessageBuffer(size_t length):
+	owned(new char[length + 1]),
+	data(owned.get()),
+	length(length)
+{
+	data[length] = '\0';
+};
+
+MessageBuffer::MessageBuffer(string_view json):
+	MessageBuffer(json.length())
+{
+	memcpy(data, json.data(), json.length());
+};
+
+MessageBuffer::MessageBuffer(shared_ptr<char[]> shared,
+	char* data,
+	size_t length):
+		shared(move(shared)),
+		data(data),
+		length(length)
+{};
+
+MessageBuffer::~MessageBuffer(){};
+
+}
@@ -0,0 +1,495 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <libclsp/server/messageEnvelope.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+constexpr size_t npos = string_view::npos;
+
+/// Reads the id or the method of a message
+struct ScalarHandler: public BaseReaderHandler<UTF8<>, ScalarHandler>
+{
+	optional<variant<Number, clsp::String>> value;
+
+	bool Default()
+	{
+		return false;
+	}
+
+	bool Null()
+	{
+		return true;
+	}
+
+	bool Int(int i)
+	{
+		value = Number(i);
+		return true;
+	}
+
+	bool Uint(unsigned u)
+	{
+		return Int((int)u);
+	}
+
+	bool Int64(int64_t i)
+	{
+		return Int((int)i);
+	}
+
+	bool Uint64(uint64_t u)
+	{
+		return Int((int)u);
+	}
+
+	bool Double(double d)
+	{
+		value = Number(d);
+		return true;
+	}
+
+	bool String(const char* str, SizeType length, bool)
+	{
+		value = clsp::String(str, length);
+		return true;
+	}
+};
+
+/// The position of the first non whitespace character after i
+static size_t skipSpace(const char* json, size_t i, size_t length)
+{
+	while(i < length &&
+		(json[i] == ' ' || json[i] == '\t' || json[i] == '\n' || json[i] == '\r'))
+	{
+		i++;
+	}
+
+	return i;
+}
+
+/// The position after the string that starts at i
+static size_t skipString(const char* json, size_t i, size_t length)
+{
+	for(i++; i < length; i++)
+	{
+		if(json[i] == '\\')
+		{
+			// The escaped character can be a quote
+			i++;
+		}
+		else if(json[i] == '"')
+		{
+			return i + 1;
+		}
+	}
+
+	return npos;
+}
+
+/// The position after the value that starts at i.
+/// Only the bounds of the value are checked, the content is checked when
+/// it's decoded.
+static size_t skipValue(const char* json, size_t i, size_t length)
+{
+	if(i >= length)
+	{
+		return npos;
+	}
+
+	switch(json[i])
+	{
+		case '"':
+			return skipString(json, i, length);
+
+		case '{':
+		case '[':
+			break;
+
+		// Numbers, true, false and null
+		default:
+			while(i < length &&
+				json[i] != ',' && json[i] != '}' && json[i] != ']' &&
+				json[i] != ' ' && json[i] != '\t' &&
+				json[i] != '\n' && json[i] != '\r')
+			{
+				i++;
+			}
+			return i;
+	}
+
+	size_t depth = 0;
+
+	while(i < length)
+	{
+		switch(json[i])
+		{
+			case '"':
+				i = skipString(json, i, length);
+
+				if(i == npos)
+				{
+					return npos;
+				}
+				break;
+
+			case '{':
+			case '[':
+				depth++;
+				i++;
+				break;
+
+			case '}':
+			case ']':
+				depth--;
+				i++;
+
+				if(depth == 0)
+				{
+					return i;
+				}
+				break;
+
+			default:
+				i++;
+				break;
+		}
+	}
+
+	return npos;
+}
+
+/// If the object that ends at i is the last value of the json
+static bool endOf(const char* json, size_t i, size_t length)
+{
+	return skipSpace(json, i + 1, length) == length;
+}
+
+/// Parses the scalar that starts at json without modifying it
+static bool readScalar(const char* json,
+	optional<variant<Number, String>>& value)
+{
+	ScalarHandler handler;
+
+	Reader reader;
+
+	StringStream stream(json);
+
+	if(reader.Parse<kParseStopWhenDoneFlag>(stream, handler).IsError())
+	{
+		return false;
+	}
+
+	value = move(handler.value);
+
+	return true;
+}
+
+bool JsonSlice::empty() const
+{
+	return begin == end;
+}
+
+optional<MessageEnvelope> MessageEnvelope::parse(
+	shared_ptr<MessageBuffer> buffer)
+{
+	const char* json = buffer->data;
+	size_t length    = buffer->length;
+
+	MessageEnvelope envelope = {
+		// Buffer
+		buffer,
+
+		// Id
+		nullopt,
+
+		// Method
+		nullopt,
+
+		// Params
+		{0, 0},
+
+		// Result
+		{0, 0},
+
+		// Error
+		{0, 0}
+	};
+
+	size_t i = skipSpace(json, 0, length);
+
+	if(i >= length || json[i] != '{')
+	{
+		return nullopt;
+	}
+
+	i = skipSpace(json, i + 1, length);
+
+	if(i < length && json[i] == '}')
+	{
+		if(!endOf(json, i, length))
+		{
+			return nullopt;
+		}
+
+		return envelope;
+	}
+
+	while(i < length && json[i] == '"')
+	{
+		// Key
+		size_t keyEnd = skipString(json, i, length);
+
+		if(keyEnd == npos)
+		{
+			return nullopt;
+		}
+
+		string_view key(json + i + 1, keyEnd - i - 2);
+
+		i = skipSpace(json, keyEnd, length);
+
+		if(i >= length || json[i] != ':')
+		{
+			return nullopt;
+		}
+
+		// Value
+		size_t begin = skipSpace(json, i + 1, length);
+		size_t end   = skipValue(json, begin, length);
+
+		if(end == npos)
+		{
+			return nullopt;
+		}
+
+		if(key == "id")
+		{
+			if(!readScalar(json + begin, envelope.id))
+			{
+				return nullopt;
+			}
+		}
+		else if(key == "method")
+		{
+			optional<variant<Number, String>> method;
+
+			if(!readScalar(json + begin, method) ||
+				!method.has_value() ||
+				!holds_alternative<String>(*method))
+			{
+				return nullopt;
+			}
+
+			envelope.method = move(get<String>(*method));
+		}
+		else if(key == "params")
+		{
+			envelope.params = {begin, end};
+		}
+		else if(key == "result")
+		{
+			envelope.result = {begin, end};
+		}
+		else if(key == "error")
+		{
+			envelope.error = {begin, end};
+		}
+
+		// jsonrpc and unknown members aren't needed to route the message
+
+		i = skipSpace(json, end, length);
+
+		if(i < length && json[i] == ',')
+		{
+			i = skipSpace(json, i + 1, length);
+		}
+		else if(i < length && json[i] == '}')
+		{
+			if(!endOf(json, i, length))
+			{
+				return nullopt;
+			}
+
+			return envelope;
+		}
+		else
+		{
+			return nullopt;
+		}
+	}
+
+	return nullopt;
+}
+
+/// Calls a function with the key and the bounds of each value of the object
+/// in [begin, end).
+/// false if the object is invalid.
+template<class Function>
+static bool forEachMember(const char* json,
+	size_t begin,
+	size_t end,
+	Function function)
+{
+	size_t i = skipSpace(json, begin, end);
+
+	if(i >= end || json[i] != '{')
+	{
+		return false;
+	}
+
+	i = skipSpace(json, i + 1, end);
+
+	while(i < end && json[i] == '"')
+	{
+		size_t keyEnd = skipString(json, i, end);
+
+		if(keyEnd == npos)
+		{
+			return false;
+		}
+
+		string_view key(json + i + 1, keyEnd - i - 2);
+
+		i = skipSpace(json, keyEnd, end);
+
+		if(i >= end || json[i] != ':')
+		{
+			return false;
+		}
+
+		size_t valueBegin = skipSpace(json, i + 1, end);
+		size_t valueEnd   = skipValue(json, valueBegin, end);
+
+		if(valueEnd == npos)
+		{
+			return false;
+		}
+
+		function(key, valueBegin, valueEnd);
+
+		i = skipSpace(json, valueEnd, end);
+
+		if(i < end && json[i] == ',')
+		{
+			i = skipSpace(json, i + 1, end);
+		}
+		else
+		{
+			return i < end && json[i] == '}';
+		}
+	}
+
+	return i < end && json[i] == '}';
+}
+
+optional<DocumentRef> MessageEnvelope::document() const
+{
+	const char* json = buffer->data;
+
+	optional<DocumentRef> document;
+
+	forEachMember(json, params.begin, params.end,
+		[json, &document](string_view key, size_t begin, size_t end)
+		{
+			if(key != "textDocument")
+			{
+				return;
+			}
+
+			optional<variant<Number, String>> uri;
+			optional<variant<Number, String>> version;
+
+			forEachMember(json, begin, end,
+				[json, &uri, &version](string_view key, size_t begin, size_t)
+				{
+					if(key == "uri")
+					{
+						readScalar(json + begin, uri);
+					}
+					else if(key == "version")
+					{
+						readScalar(json + begin, version);
+					}
+				});
+
+			if(uri.has_value() && holds_alternative<String>(*uri))
+			{
+				document = DocumentRef{move(get<String>(*uri)), nullopt};
+
+				if(version.has_value() && holds_alternative<Number>(*version))
+				{
+					document->version = get<Number>(*version);
+				}
+			}
+		});
+
+	return document;
+}
+
+string_view MessageEnvelope::text(JsonSlice slice) const
+{
+	return {buffer->data + slice.begin, slice.end - slice.begin};
+}
+
+ParseResult MessageEnvelope::decode(JsonSlice slice,
+	const Capability::JsonIO& io,
+	optional<any>& data) const
+{
+	if(slice.empty())
+	{
+		// Nothing to decode
+		return ParseResult();
+	}
+
+	if(!io.reader.has_value())
+	{
+		return ParseResult(kParseErrorTermination, slice.begin);
+	}
+
+	JsonHandler handler;
+
+	handler.objectStack.emplace().extraSetter = (*io.reader)(handler, data);
+
+	return decode(slice, handler);
+}
+
+ParseResult MessageEnvelope::decode(JsonSlice slice, JsonHandler& handler) const
+{
+	if(slice.empty())
+	{
+		// Nothing to decode
+		return ParseResult();
+	}
+
+	Reader reader;
+
+	StringStream stream(buffer->data + slice.begin);
+
+	// Only the slice is parsed
+	return reader.Parse<kParseStopWhenDoneFlag>(stream, handler);
+}
+
+ParseResult MessageEnvelope::decodeParams(const Capability::JsonIO& io,
+	optional<any>& data) const
+{
+	return decode(params, io, data);
+}
+
+}
@@ -0,0 +1,230 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include <libclsp/server/methodId.hpp>
+#include <libclsp/server/objectDescriptor.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The methods of the LSP, the index is the MethodId
+constexpr static string_view knownMethods[] = {
+	"$/cancelRequest",
+	"$/progress",
+	"initialize",
+	"initialized",
+	"shutdown",
+	"exit",
+	"window/showMessage",
+	"window/showMessageRequest",
+	"window/logMessage",
+	"window/workDoneProgress/create",
+	"window/workDoneProgress/cancel",
+	"telemetry/event",
+	"client/registerCapability",
+	"client/unregisterCapability",
+	"workspace/workspaceFolders",
+	"workspace/didChangeWorkspaceFolders",
+	"workspace/didChangeConfiguration",
+	"workspace/configuration",
+	"workspace/didChangeWatchedFiles",
+	"workspace/symbol",
+	"workspace/executeCommand",
+	"workspace/applyEdit",
+	"textDocument/didOpen",
+	"textDocument/didChange",
+	"textDocument/willSave",
+	"textDocument/willSaveWaitUntil",
+	"textDocument/didSave",
+	"textDocument/didClose",
+	"textDocument/publishDiagnostics",
+	"textDocument/completion",
+	"completionItem/resolve",
+	"textDocument/hover",
+	"textDocument/signatureHelp",
+	"textDocument/declaration",
+	"textDocument/definition",
+	"textDocument/typeDefinition",
+	"textDocument/implementation",
+	"textDocument/references",
+	"textDocument/documentHighlight",
+	"textDocument/documentSymbol",
+	"textDocument/codeAction",
+	"textDocument/codeLens",
+	"codeLens/resolve",
+	"textDocument/documentLink",
+	"documentLink/resolve",
+	"textDocument/documentColor",
+	"textDocument/colorPresentation",
+	"textDocument/formatting",
+	"textDocument/rangeFormatting",
+	"textDocument/onTypeFormatting",
+	"textDocument/rename",
+	"textDocument/prepareRename",
+	"textDocument/foldingRange",
+	"textDocument/selectionRange"
+};
+
+constexpr static size_t knownCount = size(knownMethods);
+
+/// A perfect hash from the known methods to their ids, like a KeyTable
+struct KnownMethodTable
+{
+	/// The number of slots, it must be a power of 2
+	constexpr static size_t slotCount = 512;
+
+	/// The seed that makes the hash perfect for the methods
+	uint32_t seed;
+
+	/// The id of the method in each slot plus one.
+	/// 0 is an empty slot.
+	uint8_t slots[slotCount];
+
+	constexpr static size_t slotOf(string_view method, uint32_t seed)
+	{
+		return KeyTable::hash(method, seed) & (slotCount - 1);
+	}
+
+	/// Searches a seed without collisions between the methods
+	constexpr static KnownMethodTable make()
+	{
+		static_assert(knownCount < 256, "Too many known methods");
+
+		for(uint32_t seed = 0;; seed++)
+		{
+			KnownMethodTable table = {seed, {}};
+
+			bool collision = false;
+
+			for(size_t i = 0; i < knownCount && !collision; i++)
+			{
+				auto& slot = table.slots[slotOf(knownMethods[i], seed)];
+
+				collision = slot != 0;
+
+				slot = i + 1;
+			}
+
+			if(!collision)
+			{
+				return table;
+			}
+		}
+	}
+};
+
+constexpr static KnownMethodTable knownTable = KnownMethodTable::make();
+
+/// The methods that aren't known, they are made the first time that they
+/// are used so a static Capability can intern its method.
+struct InternedMethods
+{
+	/// The names, the index plus knownCount is the MethodId.
+	/// They don't use the Allocator of the json types, they outlive any
+	/// MemoryScope.
+	deque<string> names;
+
+	/// The ids of the names, the keys point into names
+	unordered_map<string_view, MethodId> ids;
+
+	/// A mutex for names and ids
+	shared_mutex mutex;
+
+	static InternedMethods& get()
+	{
+		static InternedMethods interned;
+
+		return interned;
+	}
+};
+
+optional<MethodId> knownMethod(string_view method)
+{
+	size_t slot = KnownMethodTable::slotOf(method, knownTable.seed);
+
+	int id = knownTable.slots[slot] - 1;
+
+	if(id >= 0 && knownMethods[id] == method)
+	{
+		return id;
+	}
+
+	return nullopt;
+}
+
+MethodId internMethod(string_view method)
+{
+	if(optional<MethodId> id = knownMethod(method))
+	{
+		return *id;
+	}
+
+	InternedMethods& interned = InternedMethods::get();
+
+	{
+		shared_lock lock(interned.mutex);
+
+		auto id = interned.ids.find(method);
+
+		if(id != interned.ids.end())
+		{
+			return id->second;
+		}
+	}
+
+	unique_lock lock(interned.mutex);
+
+	// Another thread could have added it
+	auto id = interned.ids.find(method);
+
+	if(id != interned.ids.end())
+	{
+		return id->second;
+	}
+
+	MethodId newId = knownCount + interned.names.size();
+
+	string& name = interned.names.emplace_back(method);
+
+	interned.ids.emplace(name, newId);
+
+	return newId;
+}
+
+string_view methodName(MethodId method)
+{
+	if(method < knownCount)
+	{
+		return knownMethods[method];
+	}
+
+	InternedMethods& interned = InternedMethods::get();
+
+	shared_lock lock(interned.mutex);
+
+	return interned.names.at(method - knownCount);
+}
+
+}
@@ -0,0 +1,158 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cassert>
+
+#include <libclsp/server/objectDescriptor.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+DescribedMember ObjectDescriptor::find(string_view key, void* object) const
+{
+	return find(key, object, 0);
+}
+
+DescribedMember ObjectDescriptor::find(string_view key,
+	void* object,
+	size_t offset) const
+{
+	if(fieldCount != 0)
+	{
+		int index = keyTable.find(fields, key);
+
+		if(index >= 0)
+		{
+			return {&fields[index], object, offset + index};
+		}
+	}
+
+	offset += fieldCount;
+
+	for(auto& parent: parents)
+	{
+		if(parent.descriptor != nullptr)
+		{
+			auto member = parent.descriptor->find(key,
+				parent.cast(object),
+				offset);
+
+			if(member.field != nullptr)
+			{
+				return member;
+			}
+
+			offset += parent.descriptor->memberCount();
+		}
+	}
+
+	return {nullptr, object, 0};
+}
+
+size_t ObjectDescriptor::memberCount() const
+{
+	// The lookups that go to a parent need it, it's counted only once
+	size_t cached = cachedCount.load(memory_order_relaxed);
+
+	if(cached != 0)
+	{
+		return cached - 1;
+	}
+
+	size_t count = fieldCount;
+
+	for(auto& parent: parents)
+	{
+		if(parent.descriptor != nullptr)
+		{
+			count += parent.descriptor->memberCount();
+		}
+	}
+
+	cachedCount.store(count + 1, memory_order_relaxed);
+
+	return count;
+}
+
+uint64_t ObjectDescriptor::neededMask() const
+{
+	if(maskCached.load(memory_order_acquire))
+	{
+		return cachedMask.load(memory_order_relaxed);
+	}
+
+	uint64_t mask   = requiredMask;
+	size_t   offset = fieldCount;
+
+	for(auto& parent: parents)
+	{
+		if(parent.descriptor != nullptr)
+		{
+			uint64_t parentMask = parent.descriptor->neededMask();
+
+			// The bits of the required members would be dropped, and a
+			// missing member accepted
+			assert(parentMask == 0 ||
+				offset + 63 - __builtin_clzll(parentMask) < maxMembers);
+
+			mask   |= offset < maxMembers? parentMask << offset: 0;
+			offset += parent.descriptor->memberCount();
+		}
+	}
+
+	cachedMask.store(mask, memory_order_relaxed);
+	maskCached.store(true, memory_order_release);
+
+	return mask;
+}
+
+vector<string_view> ObjectDescriptor::keys(uint64_t mask) const
+{
+	vector<string_view> out;
+
+	keys(mask, 0, out);
+
+	return out;
+}
+
+void ObjectDescriptor::keys(uint64_t mask,
+	size_t offset,
+	vector<string_view>& out) const
+{
+	for(size_t i = 0; i < fieldCount && offset + i < maxMembers; i++)
+	{
+		if(mask & (uint64_t(1) << (offset + i)))
+		{
+			out.push_back(fields[i].key);
+		}
+	}
+
+	offset += fieldCount;
+
+	for(auto& parent: parents)
+	{
+		if(parent.descriptor != nullptr)
+		{
+			parent.descriptor->keys(mask, offset, out);
+
+			offset += parent.descriptor->memberCount();
+		}
+	}
+}
+
+}
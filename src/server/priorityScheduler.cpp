@@ -0,0 +1,165 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <algorithm>
+
+#include <libclsp/server/priorityScheduler.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+PriorityScheduler::PriorityScheduler(ThreadPool& pool,
+	Clock::duration aging,
+	size_t reservedWorkers):
+	pool(pool),
+	aging(aging),
+	backgroundLimit(pool.size() > reservedWorkers?
+		pool.size() - reservedWorkers:
+		0)
+{};
+
+PriorityScheduler::~PriorityScheduler(){};
+
+void PriorityScheduler::submit(function<void()> task, Priority priority)
+{
+	{
+		lock_guard<mutex> lock(queueMutex);
+
+		queues[(size_t)priority].push_back({move(task), Clock::now()});
+	}
+
+	pool.submit([this]()
+	{
+		runNext();
+	});
+}
+
+size_t PriorityScheduler::queued(Priority priority)
+{
+	lock_guard<mutex> lock(queueMutex);
+
+	return queues[(size_t)priority].size();
+}
+
+bool PriorityScheduler::take(Task& task, Priority& priority)
+{
+	Clock::time_point now = Clock::now();
+
+	size_t best = priorityCount;
+	long   bestLevel = 0;
+
+	bool interactiveWaits = !queues[(size_t)Priority::interactive].empty();
+
+	for(size_t level = 0; level < priorityCount; level++)
+	{
+		if(queues[level].empty())
+		{
+			continue;
+		}
+
+		// Without free workers a background request only takes one that
+		// no interactive request waits for
+		if((Priority)level == Priority::background &&
+			(backgroundLimit == 0?
+				runningBackground > 0 || interactiveWaits:
+				runningBackground >= backgroundLimit))
+		{
+			continue;
+		}
+
+		// The oldest of each queue is the one that aged the most.
+		// It only goes up to the priority above its own.
+		bool aged = aging.count() > 0 && level > 0 &&
+			now - queues[level].front().queued >= aging;
+
+		long effective = (long)level - (aged? 1: 0);
+
+		// A tie goes to an interactive request, or else to the oldest
+		if(best == priorityCount ||
+			effective < bestLevel ||
+			(effective == bestLevel &&
+				(Priority)best != Priority::interactive &&
+				queues[level].front().queued < queues[best].front().queued))
+		{
+			best      = level;
+			bestLevel = effective;
+		}
+	}
+
+	if(best == priorityCount)
+	{
+		return false;
+	}
+
+	task     = move(queues[best].front());
+	priority = (Priority)best;
+
+	queues[best].pop_front();
+
+	if(priority == Priority::background)
+	{
+		runningBackground++;
+	}
+
+	return true;
+}
+
+void PriorityScheduler::runNext()
+{
+	Task task;
+	Priority priority;
+
+	{
+		lock_guard<mutex> lock(queueMutex);
+
+		// The background requests that are left wait for the ones that run,
+		// which submit a slot for them when they end
+		if(!take(task, priority))
+		{
+			return;
+		}
+	}
+
+	task.run();
+
+	if(priority != Priority::background)
+	{
+		return;
+	}
+
+	bool waiting;
+
+	{
+		lock_guard<mutex> lock(queueMutex);
+
+		runningBackground--;
+
+		waiting = !queues[(size_t)Priority::background].empty();
+	}
+
+	if(waiting)
+	{
+		pool.submit([this]()
+		{
+			runNext();
+		});
+	}
+}
+
+}
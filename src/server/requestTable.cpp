@@ -0,0 +1,424 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <climits>
+#include <functional>
+#include <thread>
+
+#include <libclsp/server/jsonWriter.hpp>
+#include <libclsp/server/requestTable.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The id as an int, if it is one
+static optional<int> integerOf(const variant<Number, String>& id)
+{
+	if(auto number = get_if<Number>(&id))
+	{
+		if(auto integer = get_if<int>(number))
+		{
+			return *integer;
+		}
+	}
+
+	return nullopt;
+}
+
+size_t RequestTable::hashOf(int id)
+{
+	uint64_t h = (uint64_t)(unsigned)id * 0x9e3779b97f4a7c15u;
+
+	return h ^ (h >> 32);
+}
+
+RequestTable::Shard& RequestTable::shardOf(const variant<Number, String>& id)
+{
+	size_t h = visit(overload
+	(
+		[](const Number& n)
+		{
+			return visit(overload
+			(
+				[](int i)
+				{
+					// The high bits, the low ones choose the slot
+					return hashOf(i) >> 28;
+				},
+				[](double d)
+				{
+					return hash<double>()(d);
+				}
+			), n);
+		},
+		[](const String& str)
+		{
+			return hash<string_view>()(str);
+		}
+	), id);
+
+	return shards[h & (shardCount - 1)];
+}
+
+RequestTable::IssuedSlot* RequestTable::takeIssued(int id)
+{
+	if(id <= 0)
+	{
+		return nullptr;
+	}
+
+	IssuedSlot& slot = issued[id & (issuedCount - 1)];
+
+	int tag = slot.tag.load(memory_order_acquire);
+
+	while(true)
+	{
+		if(tag == id)
+		{
+			if(slot.tag.compare_exchange_weak(tag, busyTag,
+				memory_order_acquire))
+			{
+				return &slot;
+			}
+		}
+		else if(tag == busyTag)
+		{
+			// Another thread uses it for a moment
+			this_thread::yield();
+
+			tag = slot.tag.load(memory_order_acquire);
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+}
+
+RequestTable::IntegerSlot* RequestTable::findInteger(Shard& shard, int id)
+{
+	if(shard.integers.empty())
+	{
+		return nullptr;
+	}
+
+	size_t mask = shard.integers.size() - 1;
+
+	for(size_t i = hashOf(id) & mask;; i = (i + 1) & mask)
+	{
+		IntegerSlot& slot = shard.integers[i];
+
+		if(!slot.used)
+		{
+			return nullptr;
+		}
+
+		if(slot.id == id)
+		{
+			return &slot;
+		}
+	}
+}
+
+void RequestTable::insertInteger(Shard& shard, int id, Entry entry)
+{
+	if(IntegerSlot* slot = findInteger(shard, id))
+	{
+		slot->entry = move(entry);
+		return;
+	}
+
+	// At most half of the slots are used
+	if((shard.integerCount + 1) * 2 > shard.integers.size())
+	{
+		vector<IntegerSlot> old(max<size_t>(16, shard.integers.size() * 2));
+
+		old.swap(shard.integers);
+
+		size_t mask = shard.integers.size() - 1;
+
+		for(IntegerSlot& slot: old)
+		{
+			if(slot.used)
+			{
+				size_t i = hashOf(slot.id) & mask;
+
+				while(shard.integers[i].used)
+				{
+					i = (i + 1) & mask;
+				}
+
+				shard.integers[i] = move(slot);
+			}
+		}
+	}
+
+	size_t mask = shard.integers.size() - 1;
+	size_t i    = hashOf(id) & mask;
+
+	while(shard.integers[i].used)
+	{
+		i = (i + 1) & mask;
+	}
+
+	shard.integers[i] = {true, id, move(entry)};
+	shard.integerCount++;
+}
+
+void RequestTable::eraseInteger(Shard& shard, IntegerSlot& slot)
+{
+	size_t mask = shard.integers.size() - 1;
+	size_t hole = &slot - shard.integers.data();
+
+	slot = {};
+	shard.integerCount--;
+
+	// The next slots that would be found before the hole move into it, so
+	// the searches don't stop there.
+	for(size_t i = (hole + 1) & mask;
+		shard.integers[i].used;
+		i = (i + 1) & mask)
+	{
+		size_t home = hashOf(shard.integers[i].id) & mask;
+
+		// If home is cyclically in (hole, i] the slot stays
+		bool stays = hole <= i ?
+			hole < home && home <= i:
+			hole < home || home <= i;
+
+		if(!stays)
+		{
+			shard.integers[hole] = move(shard.integers[i]);
+			shard.integers[i]    = {};
+
+			hole = i;
+		}
+	}
+}
+
+void RequestTable::insert(const variant<Number, String>& id, Entry entry)
+{
+	Shard& shard = shardOf(id);
+
+	lock_guard lock(shard.lock);
+
+	visit(overload
+	(
+		[&shard, &entry](const Number& n)
+		{
+			visit(overload
+			(
+				[&shard, &entry](int i)
+				{
+					insertInteger(shard, i, move(entry));
+				},
+				[&shard, &entry](double d)
+				{
+					shard.numbers.insert_or_assign(d, move(entry));
+				}
+			), n);
+		},
+		[&shard, &entry](const String& str)
+		{
+			auto found = shard.strings.find(string_view(str));
+
+			if(found != shard.strings.end())
+			{
+				found->second = move(entry);
+			}
+			else
+			{
+				shard.strings.emplace(string(str), move(entry));
+			}
+		}
+	), id);
+}
+
+optional<RequestTable::Entry> RequestTable::erase(
+	const variant<Number, String>& id)
+{
+	optional<int> integer = integerOf(id);
+
+	if(integer.has_value())
+	{
+		if(IssuedSlot* slot = takeIssued(*integer))
+		{
+			Entry entry = move(slot->entry);
+
+			slot->entry = {};
+			slot->tag.store(freeTag, memory_order_release);
+
+			return entry;
+		}
+	}
+
+	Shard& shard = shardOf(id);
+
+	lock_guard lock(shard.lock);
+
+	optional<Entry> resu;
+
+	if(integer.has_value())
+	{
+		if(IntegerSlot* slot = findInteger(shard, *integer))
+		{
+			resu = move(slot->entry);
+
+			eraseInteger(shard, *slot);
+		}
+	}
+	else if(auto str = get_if<String>(&id))
+	{
+		auto found = shard.strings.find(string_view(*str));
+
+		if(found != shard.strings.end())
+		{
+			resu = move(found->second);
+
+			shard.strings.erase(found);
+		}
+	}
+	else
+	{
+		auto found = shard.numbers.find(get<double>(get<Number>(id)));
+
+		if(found != shard.numbers.end())
+		{
+			resu = move(found->second);
+
+			shard.numbers.erase(found);
+		}
+	}
+
+	return resu;
+}
+
+optional<RequestTable::Entry> RequestTable::find(
+	const variant<Number, String>& id)
+{
+	optional<int> integer = integerOf(id);
+
+	if(integer.has_value())
+	{
+		if(IssuedSlot* slot = takeIssued(*integer))
+		{
+			Entry entry = slot->entry;
+
+			slot->tag.store(*integer, memory_order_release);
+
+			return entry;
+		}
+	}
+
+	Shard& shard = shardOf(id);
+
+	lock_guard lock(shard.lock);
+
+	if(integer.has_value())
+	{
+		if(IntegerSlot* slot = findInteger(shard, *integer))
+		{
+			return slot->entry;
+		}
+	}
+	else if(auto str = get_if<String>(&id))
+	{
+		auto found = shard.strings.find(string_view(*str));
+
+		if(found != shard.strings.end())
+		{
+			return found->second;
+		}
+	}
+	else
+	{
+		auto found = shard.numbers.find(get<double>(get<Number>(id)));
+
+		if(found != shard.numbers.end())
+		{
+			return found->second;
+		}
+	}
+
+	return nullopt;
+}
+
+bool RequestTable::contains(const variant<Number, String>& id)
+{
+	optional<int> integer = integerOf(id);
+
+	if(integer.has_value() && *integer > 0)
+	{
+		int tag = issued[*integer & (issuedCount - 1)].tag.load(
+			memory_order_acquire);
+
+		if(tag == *integer)
+		{
+			return true;
+		}
+	}
+
+	Shard& shard = shardOf(id);
+
+	lock_guard lock(shard.lock);
+
+	if(integer.has_value())
+	{
+		return findInteger(shard, *integer) != nullptr;
+	}
+	else if(auto str = get_if<String>(&id))
+	{
+		return shard.strings.count(string_view(*str)) != 0;
+	}
+
+	return shard.numbers.count(get<double>(get<Number>(id))) != 0;
+}
+
+int RequestTable::issue(MethodId method)
+{
+	int id;
+
+	do
+	{
+		id = (lastId.fetch_add(1, memory_order_relaxed) + 1) & INT_MAX;
+	}
+	while(id == 0);
+
+	IssuedSlot& slot = issued[id & (issuedCount - 1)];
+
+	int tag = freeTag;
+
+	if(slot.tag.compare_exchange_strong(tag, busyTag, memory_order_acquire))
+	{
+		slot.entry = {method, nullopt};
+
+		slot.tag.store(id, memory_order_release);
+	}
+	else
+	{
+		// An older request still has the slot
+		insert(Number(id), {method, nullopt});
+	}
+
+	return id;
+}
+
+RequestTable::RequestTable(){};
+RequestTable::~RequestTable(){};
+
+}
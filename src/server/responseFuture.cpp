@@ -0,0 +1,53 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <libclsp/server/responseFuture.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+ResponseFuture::ResponseFuture(shared_ptr<State> state):
+	state(move(state))
+{};
+
+ResponseFuture::~ResponseFuture(){};
+
+void ResponseFuture::then(function<void(ClientResponse&)> continuation)
+{
+	{
+		lock_guard lock(state->stateMutex);
+
+		if(!state->response.has_value())
+		{
+			state->continuation = move(continuation);
+			return;
+		}
+	}
+
+	// The response doesn't change after it's resolved
+	continuation(*state->response);
+}
+
+bool ResponseFuture::isReady() const
+{
+	lock_guard lock(state->stateMutex);
+
+	return state->response.has_value();
+}
+
+}
@@ -14,6 +14,18 @@
 // You should have received a copy of the GNU General Public License
 // along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
 
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <unordered_map>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <libclsp/server/connection.hpp>
+#include <libclsp/server/responseFuture.hpp>
 #include <libclsp/server/server.hpp>
 
 namespace clsp
@@ -23,101 +35,574 @@ using namespace std;
 
 void Server::startIO()
 {
-	// TODO
+	startIO(STDIN_FILENO, STDOUT_FILENO);
 }
 
-void Server::addCapability(Capability capability)
+void Server::startIO(int input, int output)
 {
-	capabilityMutex.lock();
+	addTransport(make_unique<StdioTransport>(input, output));
 
-	capabiliyMap.emplace(capability.method, capability);
+	serve();
+}
 
-	capabilityMutex.unlock();
+void Server::addTransport(unique_ptr<Transport> transport)
+{
+	transports.emplace_back(move(transport));
 }
 
-optional<Capability> Server::getCapability(String method)
+void Server::serve()
 {
-	optional<Capability> resu;
+	vector<unique_ptr<Transport>> serving = move(transports);
 
-	capabilityMutex.lock_shared();
+	transports.clear();
 
-	auto capability = capabiliyMap.find(method);
+	int loop = epoll_create1(EPOLL_CLOEXEC);
+	wakeFd   = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
 
-	if(capability != capabiliyMap.end())
+	if(loop < 0 || wakeFd < 0)
 	{
-		resu = capability->second;
+		if(loop >= 0)
+		{
+			close(loop);
+		}
+
+		if(wakeFd >= 0)
+		{
+			close(wakeFd);
+			wakeFd = -1;
+		}
+		return;
 	}
-	else
+
+	pool      = make_unique<ThreadPool>(workerCount);
+	scheduler = make_unique<PriorityScheduler>(*pool,
+		priorityAging,
+		reservedWorkers);
+	timers    = make_unique<TimerWheel>();
+
+	// The event loop doesn't tick without timers
+	timers->armed = [this]()
+	{
+		wake();
+	};
+
+	// Level-triggered, a connection is read once per turn so every client
+	// gets its turn
+	auto watch = [loop](int fd)
+	{
+		epoll_event event = {};
+
+		event.events  = EPOLLIN;
+		event.data.fd = fd;
+
+		return epoll_ctl(loop, EPOLL_CTL_ADD, fd, &event) == 0;
+	};
+
+	auto unwatch = [loop](int fd)
+	{
+		epoll_ctl(loop, EPOLL_CTL_DEL, fd, nullptr);
+	};
+
+	// The transports that listen, by file descriptor
+	unordered_map<int, Transport*> listeners;
+
+	// The connections that are watched, by their input
+	unordered_map<int, Connection*> inputs;
+
+	auto acceptAll = [this, &watch, &inputs](Transport& transport)
+	{
+		while(optional<Channel> channel = transport.accept())
+		{
+			auto connection = make_unique<Connection>(*this, *channel);
+
+			int input = connection->reader->pollFd();
+
+			if(watch(input))
+			{
+				connection->watched = true;
+				inputs[input]       = connection.get();
+			}
+			else
+			{
+				// epoll doesn't take regular files, they are always readable
+				connection->alwaysReadable = true;
+			}
+
+			lock_guard lock(connectionsMutex);
+
+			connections.emplace_back(move(connection));
+		}
+	};
+
+	watch(wakeFd);
+
+	for(auto& transport: serving)
 	{
-		resu = nullopt;
+		if(!transport->open())
+		{
+			continue;
+		}
+
+		int listener = transport->listener();
+
+		if(listener >= 0 && watch(listener))
+		{
+			listeners[listener] = transport.get();
+		}
+
+		acceptAll(*transport);
 	}
 
-	capabilityMutex.unlock_shared();
+	epoll_event events[64];
 
-	return resu;
+	while(!listeners.empty() || !connections.empty())
+	{
+		// A regular file is read without waiting, and so is the input after
+		// stop(), even if it was called before serve()
+		int timeout = stopping ? 0 : -1;
+
+		for(auto& connection: connections)
+		{
+			if(connection->alwaysReadable && connection->backlog.empty() &&
+				!connection->inputEnded && !connection->inputClosed)
+			{
+				timeout = 0;
+			}
+		}
 
+		// The timers are advanced every tick while there is one
+		if(timeout != 0 && !timers->empty())
+		{
+			timeout = max<int>(1, chrono::duration_cast<chrono::milliseconds>(
+				timers->getTick()).count());
+		}
+
+		int n = epoll_wait(loop, events, size(events), timeout);
+
+		if(n < 0)
+		{
+			if(errno != EINTR)
+			{
+				stopping = true;
+			}
+			n = 0;
+		}
+
+		for(int i = 0; i < n; i++)
+		{
+			int fd = events[i].data.fd;
+
+			if(fd == wakeFd)
+			{
+				uint64_t count;
+
+				// The wake is level-triggered, a counter that can't be
+				// cleared would spin the loop
+				if(read(wakeFd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+				{
+					stopping = true;
+				}
+			}
+			else if(auto listener = listeners.find(fd);
+				listener != listeners.end())
+			{
+				acceptAll(*listener->second);
+			}
+			else if(auto input = inputs.find(fd); input != inputs.end())
+			{
+				input->second->readInput();
+			}
+		}
+
+		timers->advance();
+
+		if(stopping)
+		{
+			for(auto& [fd, transport]: listeners)
+			{
+				unwatch(fd);
+				transport->close();
+			}
+
+			listeners.clear();
+		}
+
+		for(auto it = connections.begin(); it != connections.end();)
+		{
+			Connection& connection = **it;
+
+			if(connection.alwaysReadable && connection.backlog.empty() &&
+				!connection.inputEnded && !connection.inputClosed)
+			{
+				connection.readInput();
+			}
+
+			bool flushed = connection.flushBacklog();
+
+			// After the exit notification the rest of the input is dropped
+			if(stopping || !connection.running ||
+				(connection.inputEnded && flushed))
+			{
+				connection.closeInput();
+			}
+
+			// The input isn't read while the decoders are full
+			bool watched = !connection.inputClosed &&
+				!connection.inputEnded &&
+				!connection.alwaysReadable &&
+				flushed;
+
+			int input = connection.reader->pollFd();
+
+			if(watched && !connection.watched && watch(input))
+			{
+				connection.watched = true;
+				inputs[input]      = &connection;
+			}
+			else if(!watched && connection.watched)
+			{
+				connection.watched = false;
+				unwatch(input);
+				inputs.erase(input);
+			}
+
+			if(!connection.isFinished())
+			{
+				it++;
+				continue;
+			}
+
+			unique_ptr<Connection> finished;
+
+			{
+				lock_guard lock(connectionsMutex);
+
+				finished = move(*it);
+				it       = connections.erase(it);
+			}
+		}
+	}
+
+	for(auto& transport: serving)
+	{
+		transport->close();
+	}
+
+	// The slots left in the pool use the scheduler
+	pool.reset();
+	scheduler.reset();
+	timers.reset();
+
+	close(loop);
+	close(wakeFd);
+	wakeFd = -1;
 }
 
-void Server::addRequest(variant<Number, String> id,
-	String method,
-	RequestKind kind)
+void Server::stop()
 {
-	switch(kind)
+	stopping = true;
+
+	wake();
+}
+
+void Server::wake()
+{
+	if(wakeFd < 0)
 	{
-		case RequestKind::toClient:
-			requestSentMutex.lock();
+		return;
+	}
+
+	uint64_t one = 1;
 
-			requestSentMap.emplace(id, method);
+	// It only fails with a full counter, and then the loop wakes anyway
+	[[maybe_unused]] ssize_t written = write(wakeFd, &one, sizeof(one));
+}
 
-			requestSentMutex.unlock();
-			break;
+bool Server::withConnection(const function<void(Connection&)>& function)
+{
+	Connection* connection = Connection::current();
 
-		case RequestKind::fromClient:
-			requestRecievedMutex.lock();
+	if(connection != nullptr && &connection->server == this)
+	{
+		function(*connection);
+		return true;
+	}
 
-			requestRecievedMap.emplace(id, method);
+	lock_guard lock(connectionsMutex);
 
-			requestRecievedMutex.unlock();
-			break;
+	if(connections.size() != 1)
+	{
+		return false;
 	}
+
+	function(*connections.front());
+	return true;
 }
 
-String Server::completeRequest(variant<Number, String> id, RequestKind kind)
+void Server::send(ObjectT& message)
 {
-	String resu;
+	withConnection([&message](Connection& connection)
+	{
+		connection.send(message);
+	});
+}
 
-	map<variant<Number, String>, String>::iterator mapIterator;
+size_t Server::pendingBytes()
+{
+	size_t bytes = 0;
 
-	switch(kind)
+	withConnection([&bytes](Connection& connection)
 	{
-		case RequestKind::toClient:
-			requestSentMutex.lock();
+		bytes = connection.pendingBytes();
+	});
 
-			mapIterator = requestSentMap.find(id);
-			if(mapIterator != requestSentMap.end())
-			{
-				resu = mapIterator->second;
-				requestSentMap.erase(mapIterator);
-			}
+	return bytes;
+}
 
-			requestSentMutex.unlock();
-			break;
+ResponseFuture Server::sendRequest(const Capability& capability,
+	optional<any> params)
+{
+	return sendRequest(capability, move(params), requestTimeout);
+}
 
-		case RequestKind::fromClient:
-			requestRecievedMutex.lock();
+ResponseFuture Server::sendRequest(const Capability& capability,
+	optional<any> params,
+	chrono::milliseconds timeout)
+{
+	optional<ResponseFuture> future;
 
-			mapIterator = requestRecievedMap.find(id);
-			if(mapIterator != requestRecievedMap.end())
-			{
-				resu = mapIterator->second;
-				requestRecievedMap.erase(mapIterator);
-			}
+	withConnection([&](Connection& connection)
+	{
+		future = connection.sendRequest(capability, move(params), timeout);
+	});
 
-			requestRecievedMutex.unlock();
-			break;
+	if(future.has_value())
+	{
+		return *future;
 	}
 
-	return resu;
+	auto state = make_shared<ResponseFuture::State>();
+
+	state->response = ClientResponse{
+		nullopt,
+		ResponseError(ErrorCodes::RequestCancelled,
+			"There isn't a connection",
+			nullopt)
+	};
+
+	return ResponseFuture(move(state));
+}
+
+bool Server::submit(function<void()> task, Priority priority)
+{
+	if(scheduler == nullptr)
+	{
+		return false;
+	}
+
+	scheduler->submit(move(task), priority);
+
+	return true;
+}
+
+bool Server::submitAfter(chrono::milliseconds delay,
+	function<void()> task,
+	Priority priority)
+{
+	if(timers == nullptr)
+	{
+		return false;
+	}
+
+	timers->schedule(delay, [this, task = move(task), priority]()
+	{
+		scheduler->submit(task, priority);
+	});
+
+	return true;
+}
+
+StatisticsSnapshot Server::getStatistics()
+{
+	StatisticsSnapshot snapshot = statistics.snapshot();
+
+	if(PriorityScheduler* queues = scheduler.get())
+	{
+		snapshot.queued[(size_t)Priority::interactive] =
+			queues->queued(Priority::interactive);
+		snapshot.queued[(size_t)Priority::normal] =
+			queues->queued(Priority::normal);
+		snapshot.queued[(size_t)Priority::background] =
+			queues->queued(Priority::background);
+	}
+
+	lock_guard lock(connectionsMutex);
+
+	snapshot.connections = connections.size();
+
+	for(auto& connection: connections)
+	{
+		snapshot.pendingBytes += connection->pendingBytes();
+	}
+
+	return snapshot;
+}
+
+void Server::addStatisticsCapability(String method)
+{
+	Capability::JsonIO params(nullopt, [](JsonHandler&, optional<any>& data)
+	{
+		data = nullopt;
+
+		return ValueSetter();
+	});
+
+	Capability::JsonIO result([](JsonWriter& writer, any& data)
+	{
+		any_cast<StatisticsSnapshot&>(data).write(writer);
+	}, nullopt);
+
+	Capability capability(move(method), params, result);
+
+	capability.handler = [this](optional<any>&) -> any
+	{
+		return getStatistics();
+	};
+
+	addCapability(move(capability));
+}
+
+bool Server::startTrace(const string& path)
+{
+	return tracer.start(path);
+}
+
+void Server::stopTrace()
+{
+	tracer.stop();
+}
+
+ThreadPool* Server::getPool()
+{
+	return pool.get();
+}
+
+void Server::addCapability(Capability capability)
+{
+	lock_guard lock(capabilityMutex);
+
+	Capability& added = capabilities.emplace_back(move(capability));
+
+	added.methodId = internMethod(added.method);
+
+	auto table = make_unique<DispatchTable>();
+
+	if(const DispatchTable* current = dispatchTable.load(memory_order_relaxed))
+	{
+		*table = *current;
+	}
+
+	if(table->byId.size() <= added.methodId)
+	{
+		table->byId.resize(added.methodId + 1, nullptr);
+	}
+
+	table->byId[added.methodId] = &added;
+
+	if(!knownMethod(added.method).has_value())
+	{
+		table->byName.insert_or_assign(added.method, &added);
+	}
+
+	dispatchTable.store(table.get(), memory_order_release);
+
+	dispatchTables.emplace_back(move(table));
+}
+
+void Server::addCapability(Capability capability, Priority priority)
+{
+	capability.priority = priority;
+
+	addCapability(move(capability));
+}
+
+const Capability* Server::getCapability(string_view method) const
+{
+	if(optional<MethodId> id = knownMethod(method))
+	{
+		return getCapability(*id);
+	}
+
+	const DispatchTable* table = dispatchTable.load(memory_order_acquire);
+
+	if(table == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto capability = table->byName.find(method);
+
+	if(capability == table->byName.end())
+	{
+		return nullptr;
+	}
+
+	return capability->second;
+}
+
+const Capability* Server::getCapability(MethodId method) const
+{
+	const DispatchTable* table = dispatchTable.load(memory_order_acquire);
+
+	if(table == nullptr || method >= table->byId.size())
+	{
+		return nullptr;
+	}
+
+	return table->byId[method];
+}
+
+void Server::addRequest(variant<Number, String> id,
+	String method,
+	RequestKind kind)
+{
+	withConnection([&](Connection& connection)
+	{
+		connection.addRequest(move(id), move(method), kind);
+	});
+}
+
+int Server::addRequest(String method)
+{
+	int id = -1;
+
+	withConnection([&](Connection& connection)
+	{
+		id = connection.addRequest(move(method));
+	});
+
+	return id;
+}
+
+string_view Server::completeRequest(variant<Number, String> id,
+	RequestKind kind)
+{
+	string_view method;
+
+	withConnection([&](Connection& connection)
+	{
+		method = connection.completeRequest(move(id), kind);
+	});
+
+	return method;
+}
+
+void Server::cancelRequest(variant<Number, String> id)
+{
+	withConnection([&id](Connection& connection)
+	{
+		connection.cancelRequest(move(id));
+	});
 }
 
 Server::Server(){};
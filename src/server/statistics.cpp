@@ -0,0 +1,512 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+
+#include <libclsp/server/statistics.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+string_view stageName(Stage stage)
+{
+	switch(stage)
+	{
+		case Stage::queue:
+			return "queue";
+
+		case Stage::decode:
+			return "decode";
+
+		case Stage::handler:
+			return "handler";
+
+		case Stage::encode:
+			return "encode";
+
+		case Stage::write:
+			return "write";
+	}
+
+	return "";
+}
+
+size_t LatencyHistogram::bucketOf(uint64_t value)
+{
+	if(value < subCount)
+	{
+		return value;
+	}
+
+	// The highest bit, at least subBits
+	unsigned exponent = 63 - __builtin_clzll(value);
+
+	size_t group = exponent - subBits + 1;
+
+	if(group > shiftCount)
+	{
+		return bucketCount - 1;
+	}
+
+	size_t sub = (value >> (exponent - subBits)) - subCount;
+
+	return group * subCount + sub;
+}
+
+uint64_t LatencyHistogram::lowestOf(size_t bucket)
+{
+	size_t group = bucket / subCount;
+	size_t sub   = bucket % subCount;
+
+	if(group == 0)
+	{
+		return sub;
+	}
+
+	return (uint64_t)(subCount + sub) << (group - 1);
+}
+
+uint64_t LatencyHistogram::highestOf(size_t bucket)
+{
+	size_t group = bucket / subCount;
+
+	if(group == 0)
+	{
+		return bucket;
+	}
+
+	return lowestOf(bucket) + ((uint64_t)1 << (group - 1)) - 1;
+}
+
+void LatencyHistogram::record(chrono::nanoseconds value)
+{
+	uint64_t n = std::max<int64_t>(value.count(), 0);
+
+	counts[bucketOf(n)]++;
+	count++;
+	sum += n;
+	max  = std::max(max, n);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+	for(size_t i = 0; i < bucketCount; i++)
+	{
+		counts[i] += other.counts[i];
+	}
+
+	count += other.count;
+	sum   += other.sum;
+	max    = std::max(max, other.max);
+}
+
+chrono::nanoseconds LatencyHistogram::percentile(double fraction) const
+{
+	if(count == 0)
+	{
+		return {};
+	}
+
+	uint64_t rank = std::max<uint64_t>(1, (uint64_t)ceil(fraction * count));
+
+	uint64_t seen = 0;
+
+	for(size_t i = 0; i < bucketCount; i++)
+	{
+		seen += counts[i];
+
+		if(seen >= rank)
+		{
+			uint64_t middle = lowestOf(i) + (highestOf(i) - lowestOf(i)) / 2;
+
+			return chrono::nanoseconds(std::min(middle, max));
+		}
+	}
+
+	return chrono::nanoseconds(max);
+}
+
+chrono::nanoseconds LatencyHistogram::mean() const
+{
+	if(count == 0)
+	{
+		return {};
+	}
+
+	return chrono::nanoseconds(sum / count);
+}
+
+const LatencyHistogram& MethodStatistics::stage(Stage stage) const
+{
+	return stages[(size_t)stage];
+}
+
+void StatisticsSnapshot::write(JsonWriter& writer) const
+{
+	auto micros = [](chrono::nanoseconds value)
+	{
+		return value.count() / 1000.0;
+	};
+
+	writer.StartObject();
+
+	writer.Key(string_view("messagesIn"));
+	writer.Uint64(messagesIn);
+
+	writer.Key(string_view("messagesOut"));
+	writer.Uint64(messagesOut);
+
+	writer.Key(string_view("bytesIn"));
+	writer.Uint64(bytesIn);
+
+	writer.Key(string_view("bytesOut"));
+	writer.Uint64(bytesOut);
+
+	writer.Key(string_view("queued"));
+	writer.StartObject();
+	writer.Key(string_view("interactive"));
+	writer.Uint64(queued[0]);
+	writer.Key(string_view("normal"));
+	writer.Uint64(queued[1]);
+	writer.Key(string_view("background"));
+	writer.Uint64(queued[2]);
+	writer.EndObject();
+
+	writer.Key(string_view("pendingBytes"));
+	writer.Uint64(pendingBytes);
+
+	writer.Key(string_view("connections"));
+	writer.Uint64(connections);
+
+	writer.Key(string_view("methods"));
+	writer.StartObject();
+
+	for(const MethodStatistics& method: methods)
+	{
+		writer.Key(method.method);
+		writer.StartObject();
+
+		writer.Key(string_view("messages"));
+		writer.Uint64(method.messages);
+
+		for(size_t i = 0; i < stageCount; i++)
+		{
+			const LatencyHistogram& histogram = method.stages[i];
+
+			if(histogram.count == 0)
+			{
+				continue;
+			}
+
+			writer.Key(stageName((Stage)i));
+			writer.StartObject();
+
+			writer.Key(string_view("count"));
+			writer.Uint64(histogram.count);
+
+			writer.Key(string_view("meanUs"));
+			writer.Double(micros(histogram.mean()));
+
+			writer.Key(string_view("p50Us"));
+			writer.Double(micros(histogram.percentile(0.5)));
+
+			writer.Key(string_view("p90Us"));
+			writer.Double(micros(histogram.percentile(0.9)));
+
+			writer.Key(string_view("p99Us"));
+			writer.Double(micros(histogram.percentile(0.99)));
+
+			writer.Key(string_view("p999Us"));
+			writer.Double(micros(histogram.percentile(0.999)));
+
+			writer.Key(string_view("maxUs"));
+			writer.Double(micros(chrono::nanoseconds(histogram.max)));
+
+			writer.EndObject();
+		}
+
+		writer.EndObject();
+	}
+
+	writer.EndObject();
+
+	writer.EndObject();
+}
+
+Statistics::MethodSlot::~MethodSlot()
+{
+	for(auto& stage: stages)
+	{
+		delete stage.load();
+	}
+}
+
+Statistics::Shard::~Shard()
+{
+	for(auto& chunk: chunks)
+	{
+		delete chunk.load();
+	}
+}
+
+Statistics::Shard& Statistics::Registry::lease()
+{
+	lock_guard lock(shardsMutex);
+
+	for(auto& shard: shards)
+	{
+		if(!shard->leased)
+		{
+			shard->leased = true;
+			return *shard;
+		}
+	}
+
+	Shard& shard = *shards.emplace_back(make_unique<Shard>());
+
+	shard.leased = true;
+
+	return shard;
+}
+
+void Statistics::Registry::release(Shard& shard)
+{
+	lock_guard lock(shardsMutex);
+
+	shard.leased = false;
+}
+
+struct Statistics::Leases
+{
+	/// The shards of this thread, by registry
+	vector<pair<shared_ptr<Registry>, Shard*>> shards;
+
+	~Leases()
+	{
+		for(auto& [registry, shard]: shards)
+		{
+			registry->release(*shard);
+		}
+	}
+};
+
+thread_local Statistics::Leases Statistics::leases;
+
+Statistics::Statistics():
+	registry(make_shared<Registry>())
+{};
+
+Statistics::~Statistics(){};
+
+Statistics::Shard& Statistics::shard()
+{
+	// Usually there is only one server
+	for(auto& [leased, shard]: leases.shards)
+	{
+		if(leased == registry)
+		{
+			return *shard;
+		}
+	}
+
+	Shard& shard = registry->lease();
+
+	leases.shards.emplace_back(registry, &shard);
+
+	return shard;
+}
+
+Statistics::MethodSlot* Statistics::slot(MethodId method)
+{
+	size_t index = method >> chunkBits;
+
+	if(index >= chunkCount)
+	{
+		return nullptr;
+	}
+
+	atomic<Chunk*>& chunk = shard().chunks[index];
+
+	Chunk* slots = chunk.load(memory_order_relaxed);
+
+	if(slots == nullptr)
+	{
+		// Published for the snapshots
+		slots = new Chunk();
+		chunk.store(slots, memory_order_release);
+	}
+
+	return &slots->slots[method & (chunkSize - 1)];
+}
+
+void Statistics::add(atomic<uint64_t>& counter, uint64_t value)
+{
+	// Only the thread of the shard writes, it doesn't need a locked add
+	counter.store(counter.load(memory_order_relaxed) + value,
+		memory_order_relaxed);
+}
+
+void Statistics::record(MethodId method, Stage stage, chrono::nanoseconds latency)
+{
+	MethodSlot* methodSlot = slot(method);
+
+	if(methodSlot == nullptr)
+	{
+		return;
+	}
+
+	atomic<SharedHistogram*>& histogram = methodSlot->stages[(size_t)stage];
+
+	SharedHistogram* shared = histogram.load(memory_order_relaxed);
+
+	if(shared == nullptr)
+	{
+		shared = new SharedHistogram();
+		histogram.store(shared, memory_order_release);
+	}
+
+	uint64_t n = max<int64_t>(latency.count(), 0);
+
+	add(shared->counts[LatencyHistogram::bucketOf(n)], 1);
+	add(shared->count, 1);
+	add(shared->sum, n);
+
+	if(n > shared->max.load(memory_order_relaxed))
+	{
+		shared->max.store(n, memory_order_relaxed);
+	}
+}
+
+void Statistics::countIn(optional<MethodId> method, size_t bytes)
+{
+	Shard& own = shard();
+
+	add(own.messagesIn, 1);
+	add(own.bytesIn, bytes);
+
+	if(method.has_value())
+	{
+		if(MethodSlot* methodSlot = slot(*method))
+		{
+			add(methodSlot->messages, 1);
+		}
+	}
+}
+
+void Statistics::countOut(size_t bytes)
+{
+	Shard& own = shard();
+
+	add(own.messagesOut, 1);
+	add(own.bytesOut, bytes);
+}
+
+StatisticsSnapshot Statistics::snapshot() const
+{
+	StatisticsSnapshot snapshot;
+
+	map<MethodId, MethodStatistics> methods;
+
+	lock_guard lock(registry->shardsMutex);
+
+	for(auto& shard: registry->shards)
+	{
+		snapshot.messagesIn  += shard->messagesIn.load(memory_order_relaxed);
+		snapshot.messagesOut += shard->messagesOut.load(memory_order_relaxed);
+		snapshot.bytesIn     += shard->bytesIn.load(memory_order_relaxed);
+		snapshot.bytesOut    += shard->bytesOut.load(memory_order_relaxed);
+
+		for(size_t c = 0; c < chunkCount; c++)
+		{
+			Chunk* chunk = shard->chunks[c].load(memory_order_acquire);
+
+			if(chunk == nullptr)
+			{
+				continue;
+			}
+
+			for(size_t i = 0; i < chunkSize; i++)
+			{
+				const MethodSlot& slot = chunk->slots[i];
+
+				uint64_t messages = slot.messages.load(memory_order_relaxed);
+
+				bool used = messages != 0;
+
+				for(auto& stage: slot.stages)
+				{
+					used = used || stage.load(memory_order_acquire) != nullptr;
+				}
+
+				if(!used)
+				{
+					continue;
+				}
+
+				MethodId id = (MethodId)((c << chunkBits) | i);
+
+				MethodStatistics& method = methods[id];
+
+				method.method    = methodName(id);
+				method.messages += messages;
+
+				for(size_t s = 0; s < stageCount; s++)
+				{
+					SharedHistogram* shared =
+						slot.stages[s].load(memory_order_acquire);
+
+					if(shared == nullptr)
+					{
+						continue;
+					}
+
+					LatencyHistogram& histogram = method.stages[s];
+
+					for(size_t b = 0; b < LatencyHistogram::bucketCount; b++)
+					{
+						histogram.counts[b] +=
+							shared->counts[b].load(memory_order_relaxed);
+					}
+
+					histogram.count += shared->count.load(memory_order_relaxed);
+					histogram.sum   += shared->sum.load(memory_order_relaxed);
+					histogram.max    = max(histogram.max,
+						shared->max.load(memory_order_relaxed));
+				}
+			}
+		}
+	}
+
+	for(auto& [id, method]: methods)
+	{
+		snapshot.methods.emplace_back(move(method));
+	}
+
+	sort(snapshot.methods.begin(), snapshot.methods.end(),
+		[](const MethodStatistics& a, const MethodStatistics& b)
+		{
+			return a.method < b.method;
+		});
+
+	return snapshot;
+}
+
+}
@@ -0,0 +1,316 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <chrono>
+
+#include <libclsp/server/threadPool.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+thread_local ThreadPool* ThreadPool::currentPool = nullptr;
+thread_local size_t ThreadPool::currentWorker    = 0;
+
+ThreadPool::ThreadPool(size_t workerCount)
+{
+	if(workerCount == 0)
+	{
+		workerCount = max(thread::hardware_concurrency(), 1u);
+	}
+
+	for(size_t i = 0; i < workerCount; i++)
+	{
+		workers.emplace_back(make_unique<Worker>());
+	}
+
+	// The threads start after every worker exists
+	for(size_t i = 0; i < workerCount; i++)
+	{
+		workers[i]->runner = thread([this, i]()
+		{
+			run(i);
+		});
+	}
+};
+
+ThreadPool::~ThreadPool()
+{
+	{
+		lock_guard<mutex> lock(sleepMutex);
+
+		stopping = true;
+		sleep.notify_all();
+	}
+
+	for(auto& worker: workers)
+	{
+		worker->runner.join();
+	}
+};
+
+size_t ThreadPool::size() const
+{
+	return workers.size();
+}
+
+void ThreadPool::push(size_t index, bool fork, function<void()> task)
+{
+	Worker& worker = *workers[index];
+
+	{
+		lock_guard<mutex> lock(worker.queueMutex);
+
+		if(fork)
+		{
+			worker.forked.emplace_back(move(task));
+		}
+		else
+		{
+			worker.submitted.emplace_back(move(task));
+		}
+
+		queued++;
+	}
+
+	// queued and sleepers are sequentially consistent, so either this
+	// thread sees the sleeper or the sleeper sees the task
+	if(sleepers > 0)
+	{
+		lock_guard<mutex> lock(sleepMutex);
+
+		sleep.notify_one();
+	}
+}
+
+bool ThreadPool::take(Worker& worker, bool owner, function<void()>& task)
+{
+	lock_guard<mutex> lock(worker.queueMutex);
+
+	if(!worker.forked.empty())
+	{
+		// The owner goes depth first, thieves take the biggest subtasks
+		if(owner)
+		{
+			task = move(worker.forked.back());
+			worker.forked.pop_back();
+		}
+		else
+		{
+			task = move(worker.forked.front());
+			worker.forked.pop_front();
+		}
+	}
+	else if(!worker.submitted.empty())
+	{
+		task = move(worker.submitted.front());
+		worker.submitted.pop_front();
+	}
+	else
+	{
+		return false;
+	}
+
+	queued--;
+
+	return true;
+}
+
+bool ThreadPool::runPending()
+{
+	bool worker  = currentPool == this;
+	size_t first = worker? currentWorker: 0;
+
+	function<void()> task;
+
+	// The own queues first and then the others
+	for(size_t i = 0; i < workers.size(); i++)
+	{
+		if(take(*workers[(first + i) % workers.size()], worker && i == 0, task))
+		{
+			task();
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ThreadPool::run(size_t index)
+{
+	currentPool   = this;
+	currentWorker = index;
+
+	while(true)
+	{
+		if(runPending())
+		{
+			continue;
+		}
+
+		unique_lock<mutex> lock(sleepMutex);
+
+		sleepers++;
+
+		sleep.wait(lock, [this]()
+		{
+			return queued > 0 || stopping;
+		});
+
+		sleepers--;
+
+		if(stopping && queued == 0)
+		{
+			return;
+		}
+	}
+}
+
+void ThreadPool::submit(function<void()> task)
+{
+	push(nextWorker++ % workers.size(), false, move(task));
+}
+
+void ThreadPool::submit(function<void()> task, size_t affinity)
+{
+	push(affinity % workers.size(), false, move(task));
+}
+
+void ThreadPool::fork(function<void()> task)
+{
+	if(currentPool == this)
+	{
+		push(currentWorker, true, move(task));
+	}
+	else
+	{
+		submit(move(task));
+	}
+}
+
+ThreadPool* ThreadPool::current()
+{
+	return currentPool;
+}
+
+
+TaskGroup::TaskGroup(ThreadPool& pool):
+	pool(pool)
+{};
+
+TaskGroup::~TaskGroup()
+{
+	try
+	{
+		wait();
+	}
+	catch(...)
+	{
+		// Nobody can get the exception anymore
+	}
+};
+
+function<void()> TaskGroup::wrap(function<void()> task)
+{
+	pending++;
+
+	return [this, task = move(task)]()
+	{
+		try
+		{
+			task();
+		}
+		catch(...)
+		{
+			lock_guard<mutex> lock(errorMutex);
+
+			if(error == nullptr)
+			{
+				error = current_exception();
+			}
+		}
+
+		// The group can be destroyed when the mutex is released
+		lock_guard<mutex> lock(doneMutex);
+
+		if(--pending == 0)
+		{
+			done.notify_all();
+		}
+	};
+}
+
+void TaskGroup::fork(function<void()> task)
+{
+	pool.fork(wrap(move(task)));
+}
+
+void TaskGroup::fork(function<void()> task, size_t affinity)
+{
+	pool.submit(wrap(move(task)), affinity);
+}
+
+function<void()> TaskGroup::add(function<void()> task)
+{
+	return wrap(move(task));
+}
+
+void TaskGroup::wait()
+{
+	while(true)
+	{
+		if(pending == 0)
+		{
+			// The last task releases the mutex before the group can go away
+			lock_guard<mutex> lock(doneMutex);
+			break;
+		}
+
+		if(pool.runPending())
+		{
+			continue;
+		}
+
+		// The tasks that aren't queued run in other workers.
+		// It checks the queues again from time to time because a task can
+		// be submitted to a worker that is waiting too.
+		unique_lock<mutex> lock(doneMutex);
+
+		if(done.wait_for(lock, chrono::milliseconds(1), [this]()
+		{
+			return pending == 0;
+		}))
+		{
+			break;
+		}
+	}
+
+	lock_guard<mutex> lock(errorMutex);
+
+	if(error != nullptr)
+	{
+		exception_ptr thrown = error;
+
+		error = nullptr;
+
+		rethrow_exception(thrown);
+	}
+}
+
+}
@@ -0,0 +1,210 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+
+#include <libclsp/server/timerWheel.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+TimerWheel::TimerWheel(Clock::duration tick):
+	tick(max<Clock::duration>(tick, chrono::milliseconds(1))),
+	start(Clock::now())
+{};
+
+TimerWheel::~TimerWheel(){};
+
+uint64_t TimerWheel::tickOf(Clock::time_point time) const
+{
+	if(time <= start)
+	{
+		return 0;
+	}
+
+	return (time - start) / tick;
+}
+
+void TimerWheel::place(shared_ptr<Timer> timer)
+{
+	// Longer delays are shortened to the last slot
+	constexpr uint64_t limit = (uint64_t)1 << (slotBits * levelCount);
+
+	uint64_t delta = timer->expiry - current;
+
+	if(delta >= limit)
+	{
+		delta         = limit - 1;
+		timer->expiry = current + delta;
+	}
+
+	for(size_t level = 0; level < levelCount; level++)
+	{
+		unsigned shift = slotBits * level;
+
+		if(delta < ((uint64_t)1 << (shift + slotBits)))
+		{
+			size_t slot = (timer->expiry >> shift) & (slotCount - 1);
+
+			slots[level][slot].emplace_back(move(timer));
+			return;
+		}
+	}
+}
+
+bool TimerWheel::cascade(size_t level)
+{
+	size_t index = (current >> (slotBits * level)) & (slotCount - 1);
+
+	vector<shared_ptr<Timer>> timers = move(slots[level][index]);
+
+	slots[level][index].clear();
+
+	for(auto& timer: timers)
+	{
+		if(!timer->done)
+		{
+			place(move(timer));
+		}
+	}
+
+	return index == 0;
+}
+
+shared_ptr<TimerWheel::Timer> TimerWheel::schedule(Clock::duration delay,
+	function<void()> callback)
+{
+	auto timer = make_shared<Timer>();
+
+	timer->callback = move(callback);
+
+	uint64_t ticks = max<Clock::duration>(delay, {}) / tick;
+
+	if(ticks * tick < delay || ticks == 0)
+	{
+		ticks++;
+	}
+
+	bool first;
+
+	{
+		lock_guard lock(wheelMutex);
+
+		uint64_t now = tickOf(Clock::now());
+
+		// An idle wheel isn't advanced, it only has cancelled timers
+		if(live == 0)
+		{
+			for(auto& level: slots)
+			{
+				for(auto& slot: level)
+				{
+					slot.clear();
+				}
+			}
+
+			current = max(current, now);
+		}
+
+		// The ticks that the owner didn't run yet don't shorten the delay
+		timer->expiry = max(current, now) + ticks;
+
+		// advance() counts the timers that ran without the lock, so only the
+		// increment tells if the owner may have seen the wheel empty
+		first = live++ == 0;
+
+		place(timer);
+	}
+
+	if(first && armed)
+	{
+		armed();
+	}
+
+	return timer;
+}
+
+bool TimerWheel::cancel(const shared_ptr<Timer>& timer)
+{
+	if(timer == nullptr || timer->done.exchange(true))
+	{
+		return false;
+	}
+
+	live--;
+
+	return true;
+}
+
+void TimerWheel::advance(Clock::time_point now)
+{
+	vector<shared_ptr<Timer>> due;
+
+	{
+		lock_guard lock(wheelMutex);
+
+		uint64_t target = tickOf(now);
+
+		if(live == 0)
+		{
+			current = max(current, target);
+			return;
+		}
+
+		while(current < target)
+		{
+			current++;
+
+			if((current & (slotCount - 1)) == 0)
+			{
+				for(size_t level = 1; level < levelCount && cascade(level); level++);
+			}
+
+			auto& slot = slots[0][current & (slotCount - 1)];
+
+			for(auto& timer: slot)
+			{
+				due.emplace_back(move(timer));
+			}
+
+			slot.clear();
+		}
+	}
+
+	for(auto& timer: due)
+	{
+		if(!timer->done.exchange(true))
+		{
+			live--;
+
+			timer->callback();
+		}
+	}
+}
+
+bool TimerWheel::empty() const
+{
+	return live == 0;
+}
+
+TimerWheel::Clock::duration TimerWheel::getTick() const
+{
+	return tick;
+}
+
+}
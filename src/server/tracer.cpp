@@ -0,0 +1,421 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <utility>
+
+#include <unistd.h>
+
+#include <libclsp/server/jsonWriter.hpp>
+#include <libclsp/server/tracer.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// Copies a string to a buffer, cut to fit
+template<size_t size>
+static void copyTag(char (&buffer)[size], string_view str)
+{
+	size_t length = min(str.size(), size - 1);
+
+	memcpy(buffer, str.data(), length);
+
+	buffer[length] = '\0';
+}
+
+void TraceEvent::reset(const char* name)
+{
+	this->name = name;
+	hasMethod  = false;
+	id[0]      = '\0';
+	uri[0]     = '\0';
+}
+
+void TraceEvent::setMethod(MethodId method)
+{
+	this->method = method;
+	hasMethod    = true;
+}
+
+void TraceEvent::setId(const variant<Number, String>& id)
+{
+	visit(overload(
+		[this](const Number& n)
+		{
+			char* end = this->id + sizeof(this->id) - 1;
+
+			if(holds_alternative<int>(n))
+			{
+				end = to_chars(this->id, end, get<int>(n)).ptr;
+			}
+			else
+			{
+				end = this->id + min<size_t>(
+					snprintf(this->id, sizeof(this->id), "%g", get<double>(n)),
+					sizeof(this->id) - 1);
+			}
+
+			*end = '\0';
+		},
+		[this](const String& str)
+		{
+			copyTag(this->id, string_view(str.data(), str.size()));
+		}
+	), id);
+}
+
+void TraceEvent::setId(const variant<Number, String, Null>& id)
+{
+	if(holds_alternative<Number>(id))
+	{
+		setId(variant<Number, String>(get<Number>(id)));
+	}
+	else if(holds_alternative<String>(id))
+	{
+		const String& str = get<String>(id);
+
+		copyTag(this->id, string_view(str.data(), str.size()));
+	}
+	else
+	{
+		this->id[0] = '\0';
+	}
+}
+
+void TraceEvent::setUri(string_view uri)
+{
+	copyTag(this->uri, uri);
+}
+
+Tracer::Ring& Tracer::Registry::lease()
+{
+	lock_guard lock(ringsMutex);
+
+	Ring* ring = nullptr;
+
+	for(auto& unused: rings)
+	{
+		if(!unused->leased)
+		{
+			ring = unused.get();
+			break;
+		}
+	}
+
+	if(ring == nullptr)
+	{
+		ring = rings.emplace_back(make_unique<Ring>()).get();
+	}
+
+	// The events of different threads don't merge in the timeline
+	ring->leased = true;
+	ring->thread = ++lastThread;
+
+	return *ring;
+}
+
+void Tracer::Registry::release(Ring& ring)
+{
+	lock_guard lock(ringsMutex);
+
+	ring.leased = false;
+}
+
+struct Tracer::Leases
+{
+	/// The rings of this thread, by registry
+	vector<pair<shared_ptr<Registry>, Ring*>> rings;
+
+	~Leases()
+	{
+		for(auto& [registry, ring]: rings)
+		{
+			registry->release(*ring);
+		}
+	}
+};
+
+thread_local Tracer::Leases Tracer::leases;
+
+Tracer::Tracer():
+	registry(make_shared<Registry>())
+{};
+
+Tracer::~Tracer()
+{
+	stop();
+};
+
+Tracer::Ring& Tracer::ring()
+{
+	// Usually there is only one server
+	for(auto& [leased, ring]: leases.rings)
+	{
+		if(leased == registry)
+		{
+			return *ring;
+		}
+	}
+
+	Ring& ring = registry->lease();
+
+	leases.rings.emplace_back(registry, &ring);
+
+	return ring;
+}
+
+bool Tracer::start(const string& path)
+{
+	lock_guard lock(controlMutex);
+
+	if(file != nullptr)
+	{
+		return false;
+	}
+
+	file = fopen(path.c_str(), "w");
+
+	if(file == nullptr)
+	{
+		return false;
+	}
+
+	fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+
+	// The events of an older trace aren't written
+	{
+		lock_guard ringsLock(registry->ringsMutex);
+
+		for(auto& ring: registry->rings)
+		{
+			ring->tail.store(ring->head.load(memory_order_acquire),
+				memory_order_release);
+		}
+	}
+
+	origin.store(Clock::now().time_since_epoch().count(),
+		memory_order_relaxed);
+
+	written  = false;
+	stopping = false;
+	dropped  = 0;
+
+	writerThread = thread(&Tracer::writeEvents, this);
+
+	enabled.store(true, memory_order_release);
+
+	return true;
+}
+
+void Tracer::stop()
+{
+	lock_guard lock(controlMutex);
+
+	if(file == nullptr)
+	{
+		return;
+	}
+
+	enabled.store(false, memory_order_relaxed);
+
+	{
+		lock_guard flushLock(flushMutex);
+
+		stopping = true;
+	}
+
+	flushed.notify_all();
+
+	writerThread.join();
+
+	// The spans that ended after the last flush
+	flush();
+
+	fputs("]}\n", file);
+	fclose(file);
+
+	file = nullptr;
+}
+
+uint64_t Tracer::droppedEvents() const
+{
+	return dropped.load(memory_order_relaxed);
+}
+
+void Tracer::record(TraceEvent& event,
+	Clock::time_point start,
+	Clock::time_point end)
+{
+	// Off the fast path of TraceSpan, it sees the origin of its trace
+	if(!enabled.load(memory_order_acquire))
+	{
+		return;
+	}
+
+	Clock::time_point origin(Clock::duration(
+		this->origin.load(memory_order_relaxed)));
+
+	// A span of before the start of the trace is cut
+	start = max(start, origin);
+	end   = max(end, start);
+
+	event.start    = chrono::nanoseconds(start - origin).count();
+	event.duration = chrono::nanoseconds(end - start).count();
+
+	Ring& own = ring();
+
+	// A ring that a new thread leased can still have the events of the last
+	// one
+	event.thread = own.thread;
+
+	uint64_t head = own.head.load(memory_order_relaxed);
+
+	if(head - own.tail.load(memory_order_acquire) >= ringCapacity)
+	{
+		dropped.fetch_add(1, memory_order_relaxed);
+		return;
+	}
+
+	own.events[head % ringCapacity] = event;
+
+	own.head.store(head + 1, memory_order_release);
+}
+
+void Tracer::flush()
+{
+	JsonWriter writer;
+
+	int pid = getpid();
+
+	size_t count = 0;
+
+	writer.StartArray();
+
+	{
+		lock_guard lock(registry->ringsMutex);
+
+		for(auto& ring: registry->rings)
+		{
+			uint64_t tail = ring->tail.load(memory_order_relaxed);
+			uint64_t head = ring->head.load(memory_order_acquire);
+
+			for(; tail != head; tail++)
+			{
+				const TraceEvent& event = ring->events[tail % ringCapacity];
+
+				writer.StartObject();
+
+				writer.Key(string_view("name"));
+				writer.String(string_view(event.name));
+
+				writer.Key(string_view("cat"));
+				writer.String(string_view("clsp"));
+
+				writer.Key(string_view("ph"));
+				writer.String(string_view("X"));
+
+				// The format is in microseconds
+				writer.Key(string_view("ts"));
+				writer.Double(event.start / 1000.0);
+
+				writer.Key(string_view("dur"));
+				writer.Double(event.duration / 1000.0);
+
+				writer.Key(string_view("pid"));
+				writer.Int(pid);
+
+				writer.Key(string_view("tid"));
+				writer.Uint(event.thread);
+
+				writer.Key(string_view("args"));
+				writer.StartObject();
+
+				if(event.hasMethod)
+				{
+					writer.Key(string_view("method"));
+					writer.String(methodName(event.method));
+				}
+
+				if(event.id[0] != '\0')
+				{
+					writer.Key(string_view("id"));
+					writer.String(string_view(event.id));
+				}
+
+				if(event.uri[0] != '\0')
+				{
+					writer.Key(string_view("uri"));
+					writer.String(string_view(event.uri));
+				}
+
+				writer.EndObject();
+
+				writer.EndObject();
+
+				count++;
+			}
+
+			ring->tail.store(tail, memory_order_release);
+		}
+	}
+
+	writer.EndArray();
+
+	if(count == 0)
+	{
+		return;
+	}
+
+	// The events without the brackets of the array
+	string_view events(writer.GetString() + 1, writer.GetSize() - 2);
+
+	if(written)
+	{
+		fputc(',', file);
+	}
+
+	fwrite(events.data(), 1, events.size(), file);
+	fflush(file);
+
+	written = true;
+}
+
+void Tracer::writeEvents()
+{
+	unique_lock lock(flushMutex);
+
+	while(!stopping)
+	{
+		flushed.wait_for(lock, flushInterval);
+
+		if(stopping)
+		{
+			break;
+		}
+
+		lock.unlock();
+
+		flush();
+
+		lock.lock();
+	}
+}
+
+}
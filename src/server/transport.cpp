@@ -0,0 +1,303 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <cerrno>
+#include <cstring>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <libclsp/server/transport.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+Transport::Transport(){};
+Transport::~Transport(){};
+
+StdioTransport::StdioTransport(int input, int output):
+	input(input),
+	output(output)
+{};
+
+StdioTransport::~StdioTransport(){};
+
+bool StdioTransport::open()
+{
+	accepted = false;
+
+	return true;
+}
+
+int StdioTransport::listener() const
+{
+	return -1;
+}
+
+optional<Channel> StdioTransport::accept()
+{
+	if(accepted)
+	{
+		return nullopt;
+	}
+
+	accepted = true;
+
+	return Channel{
+		// Input
+		input,
+
+		// Output
+		output,
+
+		// Owned
+		false
+	};
+}
+
+void StdioTransport::close()
+{
+}
+
+SocketTransport::SocketTransport(int backlog):
+	backlog(backlog)
+{};
+
+SocketTransport::~SocketTransport()
+{
+	SocketTransport::close();
+};
+
+bool SocketTransport::listenOn(int family, const void* address, size_t length)
+{
+	int listening = socket(family,
+		SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+		0);
+
+	if(listening < 0)
+	{
+		return false;
+	}
+
+	if(family != AF_UNIX)
+	{
+		int reuse = 1;
+
+		setsockopt(listening, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+	}
+
+	if(bind(listening, (const sockaddr*)address, length) != 0 ||
+		listen(listening, backlog) != 0)
+	{
+		int error = errno;
+
+		::close(listening);
+
+		errno = error;
+		return false;
+	}
+
+	// Only a socket that listens is seen by the other threads
+	fd = listening;
+
+	return true;
+}
+
+int SocketTransport::listener() const
+{
+	return fd;
+}
+
+optional<Channel> SocketTransport::accept()
+{
+	int listening = fd;
+
+	if(listening < 0)
+	{
+		return nullopt;
+	}
+
+	int client;
+
+	do
+	{
+		// The connection blocks, only the listener doesn't
+		client = accept4(listening, nullptr, nullptr, SOCK_CLOEXEC);
+	}
+	while(client < 0 && errno == EINTR);
+
+	if(client < 0)
+	{
+		return nullopt;
+	}
+
+	return Channel{
+		// Input
+		client,
+
+		// Output
+		client,
+
+		// Owned
+		true
+	};
+}
+
+void SocketTransport::close()
+{
+	int listening = fd.exchange(-1);
+
+	if(listening >= 0)
+	{
+		::close(listening);
+	}
+}
+
+UnixTransport::UnixTransport(string path, int backlog):
+	SocketTransport(backlog),
+	path(move(path))
+{};
+
+UnixTransport::~UnixTransport()
+{
+	UnixTransport::close();
+};
+
+bool UnixTransport::open()
+{
+	sockaddr_un address = {};
+
+	address.sun_family = AF_UNIX;
+
+	if(path.length() >= sizeof(address.sun_path))
+	{
+		errno = ENAMETOOLONG;
+		return false;
+	}
+
+	memcpy(address.sun_path, path.c_str(), path.length() + 1);
+
+	// A socket left by another server
+	unlink(path.c_str());
+
+	bound = listenOn(AF_UNIX, &address, sizeof(address));
+
+	return bound;
+}
+
+void UnixTransport::close()
+{
+	SocketTransport::close();
+
+	if(bound)
+	{
+		unlink(path.c_str());
+		bound = false;
+	}
+}
+
+TcpTransport::TcpTransport(string host, uint16_t port, int backlog):
+	SocketTransport(backlog),
+	host(move(host)),
+	requestedPort(port)
+{};
+
+TcpTransport::~TcpTransport(){};
+
+bool TcpTransport::open()
+{
+	addrinfo hints = {};
+
+	hints.ai_family   = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_flags    = AI_PASSIVE | AI_NUMERICSERV;
+
+	addrinfo* addresses;
+
+	int error = getaddrinfo(host.c_str(),
+		to_string(requestedPort).c_str(),
+		&hints,
+		&addresses);
+
+	if(error != 0)
+	{
+		errno = error == EAI_SYSTEM? errno: EADDRNOTAVAIL;
+		return false;
+	}
+
+	// The first address that works
+	for(addrinfo* address = addresses; address != nullptr;
+		address = address->ai_next)
+	{
+		if(listenOn(address->ai_family, address->ai_addr, address->ai_addrlen))
+		{
+			break;
+		}
+	}
+
+	freeaddrinfo(addresses);
+
+	return fd >= 0;
+}
+
+optional<Channel> TcpTransport::accept()
+{
+	optional<Channel> channel = SocketTransport::accept();
+
+	if(channel.has_value())
+	{
+		int noDelay = 1;
+
+		setsockopt(channel->input, IPPROTO_TCP, TCP_NODELAY,
+			&noDelay, sizeof(noDelay));
+	}
+
+	return channel;
+}
+
+uint16_t TcpTransport::port() const
+{
+	sockaddr_storage address;
+	socklen_t length = sizeof(address);
+
+	int listening = fd;
+
+	if(listening < 0 ||
+		getsockname(listening, (sockaddr*)&address, &length) != 0)
+	{
+		return 0;
+	}
+
+	if(address.ss_family == AF_INET)
+	{
+		return ntohs(((sockaddr_in*)&address)->sin_port);
+	}
+
+	if(address.ss_family == AF_INET6)
+	{
+		return ntohs(((sockaddr_in6*)&address)->sin6_port);
+	}
+
+	return 0;
+}
+
+}
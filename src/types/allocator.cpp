@@ -0,0 +1,48 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <libclsp/types/allocator.hpp>
+
+namespace clsp
+{
+
+using namespace std;
+
+/// The resource of the innermost MemoryScope of the thread
+static thread_local pmr::memory_resource* threadResource = nullptr;
+
+pmr::memory_resource* currentResource() noexcept
+{
+	if(threadResource == nullptr)
+	{
+		return pmr::new_delete_resource();
+	}
+
+	return threadResource;
+}
+
+MemoryScope::MemoryScope(pmr::memory_resource* resource) noexcept:
+	previous(threadResource)
+{
+	threadResource = resource;
+};
+
+MemoryScope::~MemoryScope()
+{
+	threadResource = previous;
+};
+
+}
@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String ApplyWorkspaceEditParams::labelKey = "label";
-const String ApplyWorkspaceEditParams::editKey  = "edit";
+constexpr string_view ApplyWorkspaceEditParams::labelKey = "label";
+constexpr string_view ApplyWorkspaceEditParams::editKey  = "edit";
 
 ApplyWorkspaceEditParams::ApplyWorkspaceEditParams(optional<String> label,
 	WorkspaceEdit edit):
@@ -48,8 +48,8 @@ void ApplyWorkspaceEditParams::partialWrite(JsonWriter &writer)
 }
 
 
-const String ApplyWorkspaceEditResponse::appliedKey       = "applied";
-const String ApplyWorkspaceEditResponse::failureReasonKey = "failureReason";
+constexpr string_view ApplyWorkspaceEditResponse::appliedKey       = "applied";
+constexpr string_view ApplyWorkspaceEditResponse::failureReasonKey = "failureReason";
 
 ApplyWorkspaceEditResponse::ApplyWorkspaceEditResponse(Boolean applied,
 	optional<String> failureReason):
@@ -60,73 +60,84 @@ ApplyWorkspaceEditResponse::ApplyWorkspaceEditResponse(Boolean applied,
 ApplyWorkspaceEditResponse::ApplyWorkspaceEditResponse(){};
 ApplyWorkspaceEditResponse::~ApplyWorkspaceEditResponse(){};
 
-void ApplyWorkspaceEditResponse::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ApplyWorkspaceEditResponse::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// applied:
-	setterMap.emplace(
+	{
+		// Key
 		appliedKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this, &neededMap](Boolean b)
-			{
-				applied = b;
-				neededMap[appliedKey] = true;
-			},
+			MemberSetter<&ApplyWorkspaceEditResponse::applied>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// failureReason?:
-	setterMap.emplace(
+	{
+		// Key
 		failureReasonKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				failureReason = str;
-			},
+			MemberSetter<&ApplyWorkspaceEditResponse::failureReason>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor ApplyWorkspaceEditResponse::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(appliedKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void ApplyWorkspaceEditResponse::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String CancelParams::idKey = "id";
+constexpr string_view CancelParams::idKey = "id";
 
 CancelParams::CancelParams(variant<Number, String> id):
 	id(id)
@@ -30,50 +30,54 @@ CancelParams::CancelParams(variant<Number, String> id):
 CancelParams::CancelParams(){};
 CancelParams::~CancelParams(){};
 
-void CancelParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CancelParams::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// id:
-	setterMap.emplace(
+	{
+		// Key
 		idKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				id = str;
-				neededMap[idKey] = true;
-			},
+			MemberSetter<&CancelParams::id>::fromString,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				id = n;
-				neededMap[idKey] = true;
-			},
+			MemberSetter<&CancelParams::id>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(idKey, 0);
+constexpr ObjectDescriptor CancelParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CancelParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void CancelParams::partialWrite(JsonWriter &writer)
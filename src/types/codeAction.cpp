@@ -26,23 +26,23 @@ CodeActionKind::CodeActionKind(String kind):
 {};
 
 const CodeActionKind
-	CodeActionKind::Empty                 = ""s,
-	CodeActionKind::QuickFix              = "quickfix"s,
-	CodeActionKind::Refactor              = "refactor"s,
-	CodeActionKind::RefactorExtract       = "refactor.extract"s,
-	CodeActionKind::RefactorInline        = "refactor.inline"s,
-	CodeActionKind::RefactorRewrite       = "refactor.rewrite"s,
-	CodeActionKind::Source                = "source"s,
-	CodeActionKind::SourceOrganizeImports = "source.organizeImports"s;
+	CodeActionKind::Empty                 = String(""),
+	CodeActionKind::QuickFix              = String("quickfix"),
+	CodeActionKind::Refactor              = String("refactor"),
+	CodeActionKind::RefactorExtract       = String("refactor.extract"),
+	CodeActionKind::RefactorInline        = String("refactor.inline"),
+	CodeActionKind::RefactorRewrite       = String("refactor.rewrite"),
+	CodeActionKind::Source                = String("source"),
+	CodeActionKind::SourceOrganizeImports = String("source.organizeImports");
 
 
-const String CodeActionClientCapabilities::
+constexpr string_view CodeActionClientCapabilities::
 	dynamicRegistrationKey      = "dynamicRegistration";
 
-const String CodeActionClientCapabilities::
+constexpr string_view CodeActionClientCapabilities::
 	codeActionLiteralSupportKey = "codeActionLiteralSupport";
 
-const String CodeActionClientCapabilities::
+constexpr string_view CodeActionClientCapabilities::
 	isPreferredSupportKey       = "isPreferredSupport";
 
 CodeActionClientCapabilities::
@@ -57,106 +57,119 @@ CodeActionClientCapabilities::
 CodeActionClientCapabilities:: CodeActionClientCapabilities(){};
 CodeActionClientCapabilities::~CodeActionClientCapabilities(){};
 
-void CodeActionClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CodeActionClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&CodeActionClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// codeActionLiteralSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		codeActionLiteralSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				codeActionLiteralSupport.emplace();
-
-				handler->pushInitializer();
-				codeActionLiteralSupport->
-					fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&CodeActionClientCapabilities::codeActionLiteralSupport>::fromObject
 		}
-	);
+	},
 
 	// isPreferredSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		isPreferredSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				isPreferredSupport = b;
-			},
+			MemberSetter<&CodeActionClientCapabilities::isPreferredSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CodeActionClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CodeActionClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String CodeActionClientCapabilities::CodeActionLiteralSupport::
+constexpr string_view CodeActionClientCapabilities::CodeActionLiteralSupport::
 	codeActionKindKey = "codeActionKind";
 
 CodeActionClientCapabilities::CodeActionLiteralSupport::
@@ -172,61 +185,66 @@ CodeActionClientCapabilities::CodeActionLiteralSupport::
 	~CodeActionLiteralSupport()
 {};
 
-void CodeActionClientCapabilities::CodeActionLiteralSupport::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CodeActionClientCapabilities::CodeActionLiteralSupport::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// codeActionKind:
-	setterMap.emplace(
+	{
+		// Key
 		codeActionKindKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&CodeActionLiteralSupport::codeActionKind>::fromObject
+		}
+	}
+};
 
-				codeActionKind.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor CodeActionClientCapabilities::CodeActionLiteralSupport::
+	descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[codeActionKindKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(codeActionKindKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CodeActionClientCapabilities::CodeActionLiteralSupport::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String CodeActionClientCapabilities::
+constexpr string_view CodeActionClientCapabilities::
 	CodeActionLiteralSupport::
 	CodeActionKind::
 		valueSetKey = "valueSet";
 
 CodeActionClientCapabilities::CodeActionLiteralSupport::CodeActionKind::
-	CodeActionKind(vector<clsp::CodeActionKind> valueSet):
+	CodeActionKind(Vector<clsp::CodeActionKind> valueSet):
 		valueSet(valueSet)
 {};
 
@@ -238,61 +256,69 @@ CodeActionClientCapabilities::CodeActionLiteralSupport::CodeActionKind::
 	~CodeActionKind()
 {};
 
-void CodeActionClientCapabilities::CodeActionLiteralSupport::CodeActionKind::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CodeActionClientCapabilities::CodeActionLiteralSupport::CodeActionKind::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// valueSet:
-	setterMap.emplace(
+	{
+		// Key
 		valueSetKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				handler->pushInitializer();
-
-				auto* maker = new ValueSetMaker(valueSet);
-
-				maker->fillInitializer(handler->objectStack.top());
+				auto& self = *static_cast<CodeActionKind*>(object);
 
-				neededMap[valueSetKey] = true;
+				handler.pushMaker<ValueSetMaker>(self.valueSet);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CodeActionClientCapabilities::CodeActionLiteralSupport::CodeActionKind::
+	descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(valueSetKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CodeActionClientCapabilities::CodeActionLiteralSupport::CodeActionKind::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 CodeActionClientCapabilities::
 	CodeActionLiteralSupport::
 	CodeActionKind::
 	ValueSetMaker::
-		ValueSetMaker(vector<clsp::CodeActionKind> &parentArray):
+		ValueSetMaker(Vector<clsp::CodeActionKind> &parentArray):
 			parentArray(parentArray)
 {};
 
@@ -303,53 +329,57 @@ CodeActionClientCapabilities::
 		~ValueSetMaker()
 {};
 
-void CodeActionClientCapabilities::
-	CodeActionLiteralSupport::
-	CodeActionKind::
-	ValueSetMaker::
-		fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor CodeActionClientCapabilities::CodeActionLiteralSupport::CodeActionKind::ValueSetMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// CodeActionKind[]
-	extraSetter =
 	{
 		// String
-		[this](String str)
+		[](void* object, JsonHandler&, String&& str)
 		{
-			parentArray.emplace_back(str);
+			auto& self = *static_cast<ValueSetMaker*>(object);
+
+			self.parentArray.emplace_back(move(str));
 		},
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CodeActionClientCapabilities::
+	CodeActionLiteralSupport::
+	CodeActionKind::
+	ValueSetMaker::
+		fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String CodeActionOptions::codeActionKindsKey = "codeActionKinds";
+constexpr string_view CodeActionOptions::codeActionKindsKey = "codeActionKinds";
 
 CodeActionOptions::CodeActionOptions(optional<Boolean> workDoneProgress,
-	optional<vector<CodeActionKind>> codeActionKinds):
+	optional<Vector<CodeActionKind>> codeActionKinds):
 		WorkDoneProgressOptions(workDoneProgress),
 		codeActionKinds(codeActionKinds)
 {};
@@ -379,7 +409,7 @@ void CodeActionOptions::partialWrite(JsonWriter &writer)
 CodeActionRegistrationOptions::CodeActionRegistrationOptions(
 	variant<DocumentSelector, Null> documentSelector,
 	optional<Boolean> workDoneProgress,
-	optional<vector<CodeActionKind>> codeActionKinds):
+	optional<Vector<CodeActionKind>> codeActionKinds):
 		TextDocumentRegistrationOptions(documentSelector),
 		CodeActionOptions(workDoneProgress, codeActionKinds)
 {};
@@ -395,11 +425,11 @@ void CodeActionRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String CodeActionContext::diagnosticsKey = "diagnostics";
-const String CodeActionContext::onlyKey = "only";
+constexpr string_view CodeActionContext::diagnosticsKey = "diagnostics";
+constexpr string_view CodeActionContext::onlyKey = "only";
 
-CodeActionContext::CodeActionContext(vector<Diagnostic> diagnostics,
-	optional<vector<CodeActionKind>> only):
+CodeActionContext::CodeActionContext(Vector<Diagnostic> diagnostics,
+	optional<Vector<CodeActionKind>> only):
 		diagnostics(diagnostics),
 		only(only)
 {};
@@ -407,90 +437,100 @@ CodeActionContext::CodeActionContext(vector<Diagnostic> diagnostics,
 CodeActionContext::CodeActionContext(){};
 CodeActionContext::~CodeActionContext(){};
 
-void CodeActionContext::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CodeActionContext::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// diagnostics:
-	setterMap.emplace(
+	{
+		// Key
 		diagnosticsKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				handler->pushInitializer();
-
-				auto* maker = new DiagnosticsMaker(diagnostics);
-
-				maker->fillInitializer(handler->objectStack.top());
+				auto& self = *static_cast<CodeActionContext*>(object);
 
-				neededMap[diagnosticsKey] = true;
+				handler.pushMaker<DiagnosticsMaker>(self.diagnostics);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// only?:
-	setterMap.emplace(
+	{
+		// Key
 		onlyKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				only.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<CodeActionContext*>(object);
 
-				auto* maker = new OnlyMaker(only.value());
+				self.only.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<OnlyMaker>(self.only.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CodeActionContext::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(diagnosticsKey, 0);
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CodeActionContext::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 CodeActionContext::DiagnosticsMaker::
-	DiagnosticsMaker(vector<Diagnostic> &parentArray):
+	DiagnosticsMaker(Vector<Diagnostic> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -498,52 +538,52 @@ CodeActionContext::DiagnosticsMaker::
 	~DiagnosticsMaker()
 {};
 
-void CodeActionContext::DiagnosticsMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor CodeActionContext::DiagnosticsMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// Diagnostic[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto &obj = parentArray.emplace_back();
+			auto& self = *static_cast<DiagnosticsMaker*>(object);
+
+			auto &obj = self.parentArray.emplace_back();
 
-			handler->pushInitializer();
-			obj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(obj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CodeActionContext::DiagnosticsMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-CodeActionContext::OnlyMaker::OnlyMaker(vector<CodeActionKind> &parentArray):
+CodeActionContext::OnlyMaker::OnlyMaker(Vector<CodeActionKind> &parentArray):
 	parentArray(parentArray)
 {};
 
@@ -551,49 +591,52 @@ CodeActionContext::OnlyMaker::
 	~OnlyMaker()
 {};
 
-void CodeActionContext::OnlyMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor CodeActionContext::OnlyMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// CodeActionKind[]
-	extraSetter =
 	{
 		// String
-		[this](String str)
+		[](void* object, JsonHandler&, String&& str)
 		{
-			parentArray.emplace_back(str);
+			auto& self = *static_cast<OnlyMaker*>(object);
+
+			self.parentArray.emplace_back(move(str));
 		},
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CodeActionContext::OnlyMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String CodeActionParams::textDocumentKey = "textDocument";
-const String CodeActionParams::rangeKey        = "range";
-const String CodeActionParams::contextKey      = "context";
+constexpr string_view CodeActionParams::textDocumentKey = "textDocument";
+constexpr string_view CodeActionParams::rangeKey        = "range";
+constexpr string_view CodeActionParams::contextKey      = "context";
 
 CodeActionParams::CodeActionParams(optional<ProgressToken> workDoneToken,
 	optional<ProgressToken> partialResultToken,
@@ -610,132 +653,137 @@ CodeActionParams::CodeActionParams(optional<ProgressToken> workDoneToken,
 CodeActionParams::CodeActionParams(){};
 CodeActionParams::~CodeActionParams(){};
 
-void CodeActionParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CodeActionParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&CodeActionParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// range:
-	setterMap.emplace(
+	{
+		// Key
 		rangeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				range.fillInitializer(handler->objectStack.top());
-
-				neededMap[rangeKey] = true;
-			}
+			MemberSetter<&CodeActionParams::range>::fromObject
 		}
-	);
+	},
 
 	// context:
-	setterMap.emplace(
+	{
+		// Key
 		contextKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&CodeActionParams::context>::fromObject
+		}
+	}
+};
 
-				context.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor CodeActionParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[contextKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(rangeKey, 0);
-	neededMap.emplace(contextKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<CodeActionParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<CodeActionParams, PartialResultParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void CodeActionParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String CodeAction::titleKey       = "title";
-const String CodeAction::kindKey        = "kind";
-const String CodeAction::diagnosticsKey = "diagnostics";
-const String CodeAction::isPreferredKey = "isPreferred";
-const String CodeAction::editKey        = "edit";
-const String CodeAction::commandKey     = "command";
+constexpr string_view CodeAction::titleKey       = "title";
+constexpr string_view CodeAction::kindKey        = "kind";
+constexpr string_view CodeAction::diagnosticsKey = "diagnostics";
+constexpr string_view CodeAction::isPreferredKey = "isPreferred";
+constexpr string_view CodeAction::editKey        = "edit";
+constexpr string_view CodeAction::commandKey     = "command";
 
 CodeAction::CodeAction(String title,
 	optional<CodeActionKind> kind,
-	optional<vector<Diagnostic>> diagnostics,
+	optional<Vector<Diagnostic>> diagnostics,
 	optional<Boolean> isPreferred,
 	optional<WorkspaceEdit> edit,
 	optional<Command> command):
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String CodeLensClientCapabilities::
+constexpr string_view CodeLensClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 
@@ -33,44 +33,57 @@ CodeLensClientCapabilities::
 CodeLensClientCapabilities:: CodeLensClientCapabilities(){};
 CodeLensClientCapabilities::~CodeLensClientCapabilities(){};
 
-void CodeLensClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CodeLensClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&CodeLensClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CodeLensClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void CodeLensClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String CodeLensOptions::resolveProviderKey = "resolveProvider";
+constexpr string_view CodeLensOptions::resolveProviderKey = "resolveProvider";
 
 CodeLensOptions::CodeLensOptions(optional<Boolean> workDoneProgress,
 	optional<Boolean> resolveProvider):
@@ -115,7 +128,7 @@ void CodeLensRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String CodeLensParams::textDocumentKey = "textDocument";
+constexpr string_view CodeLensParams::textDocumentKey = "textDocument";
 
 CodeLensParams::CodeLensParams(optional<ProgressToken> workDoneToken,
 	optional<ProgressToken> partialResultToken,
@@ -128,60 +141,69 @@ CodeLensParams::CodeLensParams(optional<ProgressToken> workDoneToken,
 CodeLensParams::CodeLensParams(){};
 CodeLensParams::~CodeLensParams(){};
 
-void CodeLensParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CodeLensParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&CodeLensParams::textDocument>::fromObject
+		}
+	}
+};
 
-				textDocument.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor CodeLensParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[textDocumentKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<CodeLensParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<CodeLensParams, PartialResultParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void CodeLensParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String CodeLens::rangeKey   = "range";
-const String CodeLens::commandKey = "command";
-const String CodeLens::dataKey    = "data";
+constexpr string_view CodeLens::rangeKey   = "range";
+constexpr string_view CodeLens::commandKey = "command";
+constexpr string_view CodeLens::dataKey    = "data";
 
 CodeLens::CodeLens(Range range,
 	optional<Command> command,
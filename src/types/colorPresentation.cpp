@@ -21,9 +21,9 @@ namespace clsp
 
 using namespace std;
 
-const String ColorPresentationParams::textDocumentKey = "textDocument";
-const String ColorPresentationParams::colorKey        = "color";
-const String ColorPresentationParams::rangeKey        = "range";
+constexpr string_view ColorPresentationParams::textDocumentKey = "textDocument";
+constexpr string_view ColorPresentationParams::colorKey        = "color";
+constexpr string_view ColorPresentationParams::rangeKey        = "range";
 
 ColorPresentationParams::ColorPresentationParams(optional<ProgressToken> workDoneToken,
 	optional<ProgressToken> partialResultToken,
@@ -40,129 +40,134 @@ ColorPresentationParams::ColorPresentationParams(optional<ProgressToken> workDon
 ColorPresentationParams::ColorPresentationParams(){};
 ColorPresentationParams::~ColorPresentationParams(){};
 
-void ColorPresentationParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ColorPresentationParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&ColorPresentationParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// color:
-	setterMap.emplace(
+	{
+		// Key
 		colorKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				color.fillInitializer(handler->objectStack.top());
-
-				neededMap[colorKey] = true;
-			}
+			MemberSetter<&ColorPresentationParams::color>::fromObject
 		}
-	);
+	},
 
 	// range:
-	setterMap.emplace(
+	{
+		// Key
 		rangeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&ColorPresentationParams::range>::fromObject
+		}
+	}
+};
 
-				range.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor ColorPresentationParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[rangeKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(colorKey, 0);
-	neededMap.emplace(rangeKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<ColorPresentationParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<ColorPresentationParams, PartialResultParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void ColorPresentationParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String ColorPresentation::labelKey               = "label";
-const String ColorPresentation::textEditKey            = "textEdit";
-const String ColorPresentation::additionalTextEditsKey = "additionalTextEdits";
+constexpr string_view ColorPresentation::labelKey               = "label";
+constexpr string_view ColorPresentation::textEditKey            = "textEdit";
+constexpr string_view ColorPresentation::additionalTextEditsKey = "additionalTextEdits";
 
 ColorPresentation::ColorPresentation(String label,
 	optional<TextEdit> textEdit,
-	optional<vector<TextEdit>> additionalTextEdits):
+	optional<Vector<TextEdit>> additionalTextEdits):
 		label(label),
 		textEdit(textEdit),
 		additionalTextEdits(additionalTextEdits)
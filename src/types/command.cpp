@@ -22,9 +22,9 @@ namespace clsp
 
 using namespace std;
 
-const String Command::titleKey     = "title";
-const String Command::commandKey   = "command";
-const String Command::argumentsKey = "arguments";
+constexpr string_view Command::titleKey     = "title";
+constexpr string_view Command::commandKey   = "command";
+constexpr string_view Command::argumentsKey = "arguments";
 
 Command::Command(String title, String command, optional<Array> arguments):
 	title(title),
@@ -35,110 +35,121 @@ Command::Command(String title, String command, optional<Array> arguments):
 Command::Command(){};
 Command::~Command(){};
 
-void Command::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor Command::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// title:
-	setterMap.emplace(
+	{
+		// Key
 		titleKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				title = str;
-				neededMap[titleKey] = true;
-			},
+			MemberSetter<&Command::title>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// command:
-	setterMap.emplace(
+	{
+		// Key
 		commandKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				command = str;
-				neededMap[commandKey] = true;
-			},
+			MemberSetter<&Command::command>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// arguments?:
-	setterMap.emplace(
+	{
+		// Key
 		argumentsKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				arguments.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<Command*>(object);
 
-				auto* maker = new ArrayMaker(arguments.value());
+				self.arguments.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ArrayMaker>(self.arguments.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor Command::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(titleKey, 0);
-	neededMap.emplace(commandKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void Command::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void Command::partialWrite(JsonWriter &writer)
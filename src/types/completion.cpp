@@ -22,13 +22,13 @@ namespace clsp
 
 using namespace std;
 
-const String CompletionOptions::triggerCharactersKey   = "triggerCharacters";
-const String CompletionOptions::allCommitCharactersKey = "allCommitCharacters";
-const String CompletionOptions::resolveProviderKey     = "resolveProvider";
+constexpr string_view CompletionOptions::triggerCharactersKey   = "triggerCharacters";
+constexpr string_view CompletionOptions::allCommitCharactersKey = "allCommitCharacters";
+constexpr string_view CompletionOptions::resolveProviderKey     = "resolveProvider";
 
 CompletionOptions::CompletionOptions(optional<Boolean> workDoneProgress,
-	optional<vector<String>> triggerCharacters,
-	optional<vector<String>> allCommitCharacters,
+	optional<Vector<String>> triggerCharacters,
+	optional<Vector<String>> allCommitCharacters,
 	optional<Boolean> resolveProvider):
 		WorkDoneProgressOptions(workDoneProgress),
 		triggerCharacters(triggerCharacters),
@@ -81,8 +81,8 @@ CompletionRegistrationOptions::
 	CompletionRegistrationOptions(
 		variant<DocumentSelector, Null> documentSelector,
 		optional<Boolean> workDoneProgress,
-		optional<vector<String>> triggerCharacters,
-		optional<vector<String>> allCommitCharacters,
+		optional<Vector<String>> triggerCharacters,
+		optional<Vector<String>> allCommitCharacters,
 		optional<Boolean> resolveProvider):
 			TextDocumentRegistrationOptions(documentSelector),
 			CompletionOptions(workDoneProgress,
@@ -102,8 +102,8 @@ void CompletionRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String CompletionContext::triggerKindKey      = "triggerKind";
-const String CompletionContext::triggerCharacterKey = "triggerCharacter";
+constexpr string_view CompletionContext::triggerKindKey      = "triggerKind";
+constexpr string_view CompletionContext::triggerCharacterKey = "triggerCharacter";
 
 CompletionContext::CompletionContext(CompletionTriggerKind triggerKind,
 	optional<String> triggerCharacter):
@@ -114,87 +114,101 @@ CompletionContext::CompletionContext(CompletionTriggerKind triggerKind,
 CompletionContext::CompletionContext(){};
 CompletionContext::~CompletionContext(){};
 
-void CompletionContext::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CompletionContext::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// triggerKind:
-	setterMap.emplace(
+	{
+		// Key
 		triggerKindKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
+			[](void* object, JsonHandler&, Number n)
 			{
+				auto& self = *static_cast<CompletionContext*>(object);
+
 				if(holds_alternative<int>(n))
 				{
 					int i = get<int>(n);
 
-					triggerKind = (CompletionTriggerKind)i;
+					self.triggerKind = (CompletionTriggerKind)i;
 
-					neededMap[triggerKindKey] = true;
 				}
 				else
 				{
-					// TODO
-					// Exception or something
 				}
 			},
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// triggerCharacter?:
-	setterMap.emplace(
+	{
+		// Key
 		triggerCharacterKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				triggerCharacter = str;
-			},
+			MemberSetter<&CompletionContext::triggerCharacter>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CompletionContext::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(triggerKindKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CompletionContext::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String CompletionParams::contextKey = "context";
+constexpr string_view CompletionParams::contextKey = "context";
 
 CompletionParams::CompletionParams(TextDocumentIdentifier textDocument,
 	Position position,
@@ -211,76 +225,94 @@ CompletionParams::CompletionParams(){};
 CompletionParams::~CompletionParams(){};
 
 
-void CompletionParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CompletionParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// context?:
-	setterMap.emplace(
+	{
+		// Key
 		contextKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				context.emplace();
+			MemberSetter<&CompletionParams::context>::fromObject
+		}
+	}
+};
 
-				handler->pushInitializer();
-				context->fillInitializer(handler->objectStack.top());
-			}
+constexpr ObjectDescriptor CompletionParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<CompletionParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<CompletionParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<CompletionParams, PartialResultParams>
 		}
-	);
+	}
+};
 
-	// This
-	initializer.object = this;
+void CompletionParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
-const String CompletionItem::labelKey               = "label";
-const String CompletionItem::kindKey                = "kind";
-const String CompletionItem::tagsKey                = "tags";
-const String CompletionItem::detailKey              = "detail";
-const String CompletionItem::documentationKey       = "documentation";
-const String CompletionItem::deprecatedKey          = "deprecated";
-const String CompletionItem::preselectKey           = "preselect";
-const String CompletionItem::sortTextKey            = "sortText";
-const String CompletionItem::filterTextKey          = "filterText";
-const String CompletionItem::insertTextKey          = "insertText";
-const String CompletionItem::insertTextFormatKey    = "insertTextFormat";
-const String CompletionItem::textEditKey            = "textEdit";
-const String CompletionItem::additionalTextEditsKey = "additionalTextEdits";
-const String CompletionItem::commitCharactersKey    = "commitCharacters";
-const String CompletionItem::commandKey             = "command";
-const String CompletionItem::dataKey                = "data";
+constexpr string_view CompletionItem::labelKey               = "label";
+constexpr string_view CompletionItem::kindKey                = "kind";
+constexpr string_view CompletionItem::tagsKey                = "tags";
+constexpr string_view CompletionItem::detailKey              = "detail";
+constexpr string_view CompletionItem::documentationKey       = "documentation";
+constexpr string_view CompletionItem::deprecatedKey          = "deprecated";
+constexpr string_view CompletionItem::preselectKey           = "preselect";
+constexpr string_view CompletionItem::sortTextKey            = "sortText";
+constexpr string_view CompletionItem::filterTextKey          = "filterText";
+constexpr string_view CompletionItem::insertTextKey          = "insertText";
+constexpr string_view CompletionItem::insertTextFormatKey    = "insertTextFormat";
+constexpr string_view CompletionItem::textEditKey            = "textEdit";
+constexpr string_view CompletionItem::additionalTextEditsKey = "additionalTextEdits";
+constexpr string_view CompletionItem::commitCharactersKey    = "commitCharacters";
+constexpr string_view CompletionItem::commandKey             = "command";
+constexpr string_view CompletionItem::dataKey                = "data";
 
 CompletionItem::CompletionItem(String label,
 	optional<CompletionItemKind> kind,
-	optional<vector<CompletionItemTag>> tags,
+	optional<Vector<CompletionItemTag>> tags,
 	optional<String> detail,
 	optional<variant<String,MarkupContent>> documentation,
 	optional<Boolean> preselect,
@@ -289,8 +321,8 @@ CompletionItem::CompletionItem(String label,
 	optional<String> insertText,
 	optional<InsertTextFormat> insertTextFormat,
 	optional<TextEdit> textEdit,
-	optional<vector<TextEdit>> additionalTextEdits,
-	optional<vector<String>> commitCharacters,
+	optional<Vector<TextEdit>> additionalTextEdits,
+	optional<Vector<String>> commitCharacters,
 	optional<Command> command,
 	optional<Any> data):
 		label(label),
@@ -313,522 +345,572 @@ CompletionItem::CompletionItem(String label,
 CompletionItem::CompletionItem(){};
 CompletionItem::~CompletionItem(){};
 
-void CompletionItem::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CompletionItem::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	auto* handler = initializer.handler;
-
-	// Value setters
-
 	// label:
-	setterMap.emplace(
+	{
+		// Key
 		labelKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				label = str;
-				neededMap[labelKey] = true;
-			},
+			MemberSetter<&CompletionItem::label>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// kind?:
-	setterMap.emplace(
+	{
+		// Key
 		kindKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
+			[](void* object, JsonHandler&, Number n)
 			{
+				auto& self = *static_cast<CompletionItem*>(object);
+
 				if(holds_alternative<int>(n))
 				{
 					int i = get<int>(n);
-					kind = (CompletionItemKind)i;
+					self.kind = (CompletionItemKind)i;
 				}
 				else
 				{
-					// An exception or something.
 				}
 			},
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// tags?:
-	setterMap.emplace(
+	{
+		// Key
 		tagsKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				tags.emplace();
+				auto& self = *static_cast<CompletionItem*>(object);
 
-				handler->pushInitializer();
+				self.tags.emplace();
 
-				auto* maker = new TagsMaker(tags.value());
-
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<TagsMaker>(self.tags.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// detail?:
-	setterMap.emplace(
+	{
+		// Key
 		detailKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				detail = str;
-			},
+			MemberSetter<&CompletionItem::detail>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// documentation?:
-	setterMap.emplace(
+	{
+		// Key
 		documentationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				documentation = str;
-			},
+			MemberSetter<&CompletionItem::documentation>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& obj = documentation.emplace().emplace<MarkupContent>();
+				auto& self = *static_cast<CompletionItem*>(object);
 
-				handler->pushInitializer();
-				obj.fillInitializer(handler->objectStack.top());
+				auto& obj = self.documentation.emplace().emplace<MarkupContent>();
+
+				handler.pushObject(obj);
 			}
 		}
-	);
+	},
 
 	// deprecated?:
-	setterMap.emplace(
+	{
+		// Key
 		deprecatedKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				deprecated = b;
-			},
+			MemberSetter<&CompletionItem::deprecated>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// preselect?:
-	setterMap.emplace(
+	{
+		// Key
 		preselectKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				preselect = b;
-			},
+			MemberSetter<&CompletionItem::preselect>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// sortText?:
-	setterMap.emplace(
+	{
+		// Key
 		sortTextKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				sortText = str;
-			},
+			MemberSetter<&CompletionItem::sortText>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// filterText?:
-	setterMap.emplace(
+	{
+		// Key
 		filterTextKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				filterText = str;
-			},
+			MemberSetter<&CompletionItem::filterText>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// insertText?:
-	setterMap.emplace(
+	{
+		// Key
 		insertTextKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				insertText = str;
-			},
+			MemberSetter<&CompletionItem::insertText>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// insertTextFormat?:
-	setterMap.emplace(
+	{
+		// Key
 		insertTextFormatKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
+			[](void* object, JsonHandler&, Number n)
 			{
+				auto& self = *static_cast<CompletionItem*>(object);
+
 				if(holds_alternative<int>(n))
 				{
 					int i = get<int>(n);
-					insertTextFormat = (InsertTextFormat)i;
+					self.insertTextFormat = (InsertTextFormat)i;
 				}
 				else
 				{
-					// An exception or something.
 				}
 			},
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// textEdit?:
-	setterMap.emplace(
+	{
+		// Key
 		textEditKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				textEdit.emplace();
-
-				handler->pushInitializer();
-				textEdit->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&CompletionItem::textEdit>::fromObject
 		}
-	);
+	},
 
 	// additionalTextEdits?:
-	setterMap.emplace(
+	{
+		// Key
 		additionalTextEditsKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				additionalTextEdits.emplace();
+				auto& self = *static_cast<CompletionItem*>(object);
 
-				handler->pushInitializer();
+				self.additionalTextEdits.emplace();
 
-				auto* maker = new ObjectArrayMaker(additionalTextEdits.value());
-
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ObjectArrayMaker<TextEdit>>(
+					self.additionalTextEdits.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// commitCharacters?:
-	setterMap.emplace(
+	{
+		// Key
 		commitCharactersKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				commitCharacters.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<CompletionItem*>(object);
 
-				auto* maker = new CommitCharactersMaker(commitCharacters.value());
+				self.commitCharacters.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<CommitCharactersMaker>(
+					self.commitCharacters.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// command?:
-	setterMap.emplace(
+	{
+		// Key
 		commandKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				command.emplace();
-
-				handler->pushInitializer();
-				command->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&CompletionItem::command>::fromObject
 		}
-	);
+	},
 
 	// data?:
-	setterMap.emplace(
+	{
+		// Key
 		dataKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				data = str;
-			},
+			MemberSetter<&CompletionItem::data>::fromString,
 
 			// Number
-			[this](Number n)
-			{
-				data = n;
-			},
+			MemberSetter<&CompletionItem::data>::fromNumber,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				data = b;
-			},
+			MemberSetter<&CompletionItem::data>::fromBoolean,
 
 			// Null
-			[this]()
-			{
-				data = Null();
-			},
+			MemberSetter<&CompletionItem::data>::fromNull,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& arr = data.emplace().emplace<Array>();
+				auto& self = *static_cast<CompletionItem*>(object);
 
-				auto* maker = new ArrayMaker(arr);
+				auto& arr = self.data.emplace().emplace<Array>();
 
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ArrayMaker>(arr);
 			},
 
 			// Object
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& obj = data.emplace().emplace<Object>();
+				auto& self = *static_cast<CompletionItem*>(object);
+
+				auto& obj = self.data.emplace().emplace<Object>();
 
-				handler->pushInitializer();
-				obj->fillInitializer(handler->objectStack.top());
+				handler.pushObject(*obj);
 			}
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CompletionItem::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(labelKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CompletionItem::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void CompletionItem::partialWrite(JsonWriter &writer)
@@ -969,109 +1051,114 @@ void CompletionItem::partialWrite(JsonWriter &writer)
 
 #pragma GCC diagnostic pop
 
-CompletionItem::TagsMaker::TagsMaker(vector<CompletionItemTag> &parentArray):
+CompletionItem::TagsMaker::TagsMaker(Vector<CompletionItemTag> &parentArray):
 	parentArray(parentArray)
 {};
 
 CompletionItem::TagsMaker::~TagsMaker(){};
 
-void CompletionItem::TagsMaker::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor CompletionItem::TagsMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// CompletionItemTag[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		[this](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
+			auto& self = *static_cast<TagsMaker*>(object);
+
 			if(holds_alternative<int>(n))
 			{
 				int i = get<int>(n);
 
-				parentArray.emplace_back((CompletionItemTag)i);
+				self.parentArray.emplace_back((CompletionItemTag)i);
 			}
 			else
 			{
-				// Something
 			}
 		},
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CompletionItem::TagsMaker::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-CompletionItem::CommitCharactersMaker::CommitCharactersMaker(vector<String> &parentArray):
+CompletionItem::CommitCharactersMaker::CommitCharactersMaker(Vector<String> &parentArray):
 	parentArray(parentArray)
 {};
 
 CompletionItem::CommitCharactersMaker::~CommitCharactersMaker(){};
 
-void CompletionItem::CommitCharactersMaker::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor CompletionItem::CommitCharactersMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// String[]
-	extraSetter =
 	{
 		// String
-		[this](String str)
+		[](void* object, JsonHandler&, String&& str)
 		{
-			parentArray.emplace_back(str);
+			auto& self = *static_cast<CommitCharactersMaker*>(object);
+
+			self.parentArray.emplace_back(move(str));
 		},
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CompletionItem::CommitCharactersMaker::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String CompletionList::isIncompleteKey = "isIncomplete";
-const String CompletionList::itemsKey        = "items";
+constexpr string_view CompletionList::isIncompleteKey = "isIncomplete";
+constexpr string_view CompletionList::itemsKey        = "items";
 
 CompletionList::CompletionList(Boolean isIncomplete,
-	vector<CompletionItem> items):
+	Vector<CompletionItem> items):
 		isIncomplete(isIncomplete),
 		items(items)
 {};
@@ -1095,16 +1182,16 @@ void CompletionList::partialWrite(JsonWriter &writer)
 	writer.EndArray();
 }
 
-const String CompletionClientCapabilities::
+constexpr string_view CompletionClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String CompletionClientCapabilities::
+constexpr string_view CompletionClientCapabilities::
 	completionItemKey      = "completionItem";
 
-const String CompletionClientCapabilities::
+constexpr string_view CompletionClientCapabilities::
 	completionItemKindKey  = "completionItemKind";
 
-const String CompletionClientCapabilities::
+constexpr string_view CompletionClientCapabilities::
 	contextSupportKey      = "contextSupport";
 
 CompletionClientCapabilities::
@@ -1121,155 +1208,169 @@ CompletionClientCapabilities::
 CompletionClientCapabilities::CompletionClientCapabilities(){};
 CompletionClientCapabilities::~CompletionClientCapabilities(){};
 
-void CompletionClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CompletionClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&CompletionClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// completionItem?:
-	setterMap.emplace(
+	{
+		// Key
 		completionItemKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				completionItem.emplace();
-
-				handler->pushInitializer();
-				completionItem->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&CompletionClientCapabilities::completionItem>::fromObject
 		}
-	);
+	},
 
 	// completionItemKind?:
-	setterMap.emplace(
+	{
+		// Key
 		completionItemKindKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				completionItemKind.emplace();
-
-				handler->pushInitializer();
-				completionItemKind->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&CompletionClientCapabilities::completionItemKind>::fromObject
 		}
-	);
+	},
 
 	// contextSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		contextSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				contextSupport = b;
-			},
+			MemberSetter<&CompletionClientCapabilities::contextSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// This
-	initializer.object = this;
+constexpr ObjectDescriptor CompletionClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void CompletionClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String CompletionClientCapabilities::CompletionItem::
+constexpr string_view CompletionClientCapabilities::CompletionItem::
 	snippetSupportKey          = "snippetSupport";
 
-const String CompletionClientCapabilities::CompletionItem::
+constexpr string_view CompletionClientCapabilities::CompletionItem::
 	commitCharactersSupportKey = "commitCharactersSupport";
 
-const String CompletionClientCapabilities::CompletionItem::
+constexpr string_view CompletionClientCapabilities::CompletionItem::
 	documentationFormatKey     = "documentationFormat";
 
-const String CompletionClientCapabilities::CompletionItem::
+constexpr string_view CompletionClientCapabilities::CompletionItem::
 	deprecatedSupportKey       = "deprecatedSupport";
 
-const String CompletionClientCapabilities::CompletionItem::
+constexpr string_view CompletionClientCapabilities::CompletionItem::
 	preselectSupportKey        = "preselectSupport";
 
-const String CompletionClientCapabilities::CompletionItem::
+constexpr string_view CompletionClientCapabilities::CompletionItem::
 	tagSupportKey              = "tagSupport";
 
 CompletionClientCapabilities::CompletionItem::
 	CompletionItem(optional<Boolean> snippetSupport,
 		optional<Boolean> commitCharactersSupport,
-		optional<vector<MarkupKind>> documentationFormat,
+		optional<Vector<MarkupKind>> documentationFormat,
 		optional<Boolean> deprecatedSupport,
 		optional<Boolean> preselectSupport,
 		optional<TagSupport> tagSupport):
@@ -1285,193 +1386,220 @@ CompletionClientCapabilities::CompletionItem::CompletionItem(){};
 CompletionClientCapabilities::CompletionItem::~CompletionItem(){};
 
 
-void CompletionClientCapabilities::CompletionItem::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CompletionClientCapabilities::CompletionItem::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// snippetSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		snippetSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				snippetSupport = b;
-			},
+			MemberSetter<&CompletionItem::snippetSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// commitCharactersSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		commitCharactersSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				commitCharactersSupport = b;
-			},
+			MemberSetter<&CompletionItem::commitCharactersSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// documentationFormat?:
-	setterMap.emplace(
+	{
+		// Key
 		documentationFormatKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				documentationFormat.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<CompletionItem*>(object);
 
-				auto* maker = new DocumentationFormatMaker(documentationFormat.value());
+				self.documentationFormat.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<DocumentationFormatMaker>(
+					self.documentationFormat.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// deprecatedSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		deprecatedSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				deprecatedSupport = b;
-			},
+			MemberSetter<&CompletionItem::deprecatedSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// preselectSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		preselectSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				preselectSupport = b;
-			},
+			MemberSetter<&CompletionItem::preselectSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// tagSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		tagSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				tagSupport.emplace();
-
-				handler->pushInitializer();
-				tagSupport->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&CompletionItem::tagSupport>::fromObject
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CompletionClientCapabilities::CompletionItem::
+	descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CompletionClientCapabilities::CompletionItem::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
 CompletionClientCapabilities::CompletionItem::DocumentationFormatMaker::
-	DocumentationFormatMaker(vector<MarkupKind> &parentArray):
+	DocumentationFormatMaker(Vector<MarkupKind> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -1479,110 +1607,122 @@ CompletionClientCapabilities::CompletionItem::DocumentationFormatMaker::
 	~DocumentationFormatMaker()
 {};
 
-void CompletionClientCapabilities::CompletionItem::DocumentationFormatMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor CompletionClientCapabilities::CompletionItem::DocumentationFormatMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// MarkupKind[]
-	extraSetter =
 	{
 		// String
-		[this](String str)
+		[](void* object, JsonHandler&, String&& str)
 		{
-			parentArray.emplace_back(str);
+			auto& self = *static_cast<DocumentationFormatMaker*>(object);
+
+			self.parentArray.emplace_back(move(str));
 		},
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CompletionClientCapabilities::CompletionItem::DocumentationFormatMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const string CompletionClientCapabilities::CompletionItem::TagSupport::
+constexpr string_view CompletionClientCapabilities::CompletionItem::TagSupport::
 	valueSetKey = "valueSet";
 
 CompletionClientCapabilities::CompletionItem::TagSupport::
-	TagSupport(vector<CompletionItemTag> valueSet):
+	TagSupport(Vector<CompletionItemTag> valueSet):
 		valueSet(valueSet)
 {};
 
 CompletionClientCapabilities::CompletionItem::TagSupport::TagSupport(){};
 CompletionClientCapabilities::CompletionItem::TagSupport::~TagSupport(){};
 
-void CompletionClientCapabilities::CompletionItem::TagSupport::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CompletionClientCapabilities::CompletionItem::TagSupport::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// valueSet:
-	setterMap.emplace(
+	{
+		// Key
 		valueSetKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				handler->pushInitializer();
-
-				auto* maker = new ValueSetMaker(valueSet);
-
-				maker->fillInitializer(handler->objectStack.top());
+				auto& self = *static_cast<TagSupport*>(object);
 
-				neededMap[valueSetKey] = true;
+				handler.pushMaker<ValueSetMaker>(self.valueSet);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CompletionClientCapabilities::CompletionItem::TagSupport::
+	descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(valueSetKey, 0);
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void CompletionClientCapabilities::CompletionItem::TagSupport::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
 CompletionClientCapabilities::CompletionItem::TagSupport::ValueSetMaker::
-	ValueSetMaker(vector<CompletionItemTag> &parentArray):
+	ValueSetMaker(Vector<CompletionItemTag> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -1590,115 +1730,130 @@ CompletionClientCapabilities::CompletionItem::TagSupport::ValueSetMaker::
 	~ValueSetMaker()
 {};
 
-void CompletionClientCapabilities::CompletionItem::TagSupport::ValueSetMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor CompletionClientCapabilities::CompletionItem::TagSupport::ValueSetMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// CompletionItemTag[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		[this](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
+			auto& self = *static_cast<ValueSetMaker*>(object);
+
 			if(holds_alternative<int>(n))
 			{
 				int i = get<int>(n);
 
-				parentArray.emplace_back((CompletionItemTag)i);
+				self.parentArray.emplace_back((CompletionItemTag)i);
 			}
 			else
 			{
-				// TODO
-				// An exception or something
 			}
 		},
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CompletionClientCapabilities::CompletionItem::TagSupport::ValueSetMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String CompletionClientCapabilities::CompletionItemKind::
+constexpr string_view CompletionClientCapabilities::CompletionItemKind::
 	valueSetKey = "valueSet";
 
 CompletionClientCapabilities::CompletionItemKind::
-	CompletionItemKind(optional<vector<clsp::CompletionItemKind>> valueSet):
+	CompletionItemKind(optional<Vector<clsp::CompletionItemKind>> valueSet):
 		valueSet(valueSet)
 {};
 
 CompletionClientCapabilities::CompletionItemKind::CompletionItemKind(){};
 CompletionClientCapabilities::CompletionItemKind::~CompletionItemKind(){};
 
-void CompletionClientCapabilities::CompletionItemKind::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor CompletionClientCapabilities::CompletionItemKind::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// valueSet:
-	setterMap.emplace(
+	{
+		// Key
 		valueSetKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				valueSet.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<CompletionItemKind*>(object);
 
-				auto* maker = new ValueSetMaker(valueSet.value());
+				self.valueSet.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ValueSetMaker>(self.valueSet.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor CompletionClientCapabilities::CompletionItemKind::
+	descriptor =
+{
+	// Fields
+	fields,
 
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CompletionClientCapabilities::CompletionItemKind::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 CompletionClientCapabilities::CompletionItemKind::ValueSetMaker::
-	ValueSetMaker(vector<clsp::CompletionItemKind> &parentArray):
+	ValueSetMaker(Vector<clsp::CompletionItemKind> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -1706,53 +1861,55 @@ CompletionClientCapabilities::CompletionItemKind::ValueSetMaker::
 	~ValueSetMaker()
 {};
 
-void CompletionClientCapabilities::CompletionItemKind::ValueSetMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor CompletionClientCapabilities::CompletionItemKind::ValueSetMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// CompletionItemKind[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		[this](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
+			auto& self = *static_cast<ValueSetMaker*>(object);
+
 			if(holds_alternative<int>(n))
 			{
 				int i = get<int>(n);
 
-				parentArray.emplace_back((clsp::CompletionItemKind)i);
+				self.parentArray.emplace_back((clsp::CompletionItemKind)i);
 			}
 			else
 			{
-				// TODO
-				// An exception or something
 			}
 		},
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void CompletionClientCapabilities::CompletionItemKind::ValueSetMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
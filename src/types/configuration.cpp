@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String ConfigurationItem::scopeUriKey = "scopeUri";
-const String ConfigurationItem::sectionKey  = "section";
+constexpr string_view ConfigurationItem::scopeUriKey = "scopeUri";
+constexpr string_view ConfigurationItem::sectionKey  = "section";
 
 ConfigurationItem::ConfigurationItem(optional<DocumentUri> scopeUri,
 	optional<String> section):
@@ -51,9 +51,9 @@ void ConfigurationItem::partialWrite(JsonWriter &writer)
 }
 
 
-const String ConfigurationParams::itemsKey = "items";
+constexpr string_view ConfigurationParams::itemsKey = "items";
 
-ConfigurationParams::ConfigurationParams(vector<ConfigurationItem> items):
+ConfigurationParams::ConfigurationParams(Vector<ConfigurationItem> items):
 	items(items)
 {};
 
@@ -21,10 +21,10 @@ namespace clsp
 
 using namespace std;
 
-const String DeclarationClientCapabilities::
+constexpr string_view DeclarationClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String DeclarationClientCapabilities::
+constexpr string_view DeclarationClientCapabilities::
 	linkSupportKey         = "linkSupport";
 
 DeclarationClientCapabilities::
@@ -38,69 +38,85 @@ DeclarationClientCapabilities::DeclarationClientCapabilities(){};
 DeclarationClientCapabilities::~DeclarationClientCapabilities(){};
 
 
-void DeclarationClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DeclarationClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DeclarationClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// linkSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		linkSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				linkSupport = b;
-			},
+			MemberSetter<&DeclarationClientCapabilities::linkSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DeclarationClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DeclarationClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 DeclarationRegistrationOptions::
@@ -136,12 +152,36 @@ DeclarationParams::DeclarationParams(TextDocumentIdentifier textDocument,
 DeclarationParams::DeclarationParams(){};
 DeclarationParams::~DeclarationParams(){};
 
-void DeclarationParams::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor DeclarationParams::descriptor =
 {
+	// Fields
+	nullptr,
+
+	// Extra setter
+	{},
+
 	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<DeclarationParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<DeclarationParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<DeclarationParams, PartialResultParams>
+		}
+	}
+};
+
+void DeclarationParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
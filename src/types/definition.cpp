@@ -21,10 +21,10 @@ namespace clsp
 
 using namespace std;
 
-const String DefinitionClientCapabilities::
+constexpr string_view DefinitionClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String DefinitionClientCapabilities::
+constexpr string_view DefinitionClientCapabilities::
 	linkSupportKey         = "linkSupport";
 
 DefinitionClientCapabilities::
@@ -37,69 +37,85 @@ DefinitionClientCapabilities::
 DefinitionClientCapabilities::DefinitionClientCapabilities(){};
 DefinitionClientCapabilities::~DefinitionClientCapabilities(){};
 
-void DefinitionClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DefinitionClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DefinitionClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// linkSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		linkSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				linkSupport = b;
-			},
+			MemberSetter<&DefinitionClientCapabilities::linkSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DefinitionClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DefinitionClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 DefinitionRegistrationOptions::DefinitionRegistrationOptions(
@@ -132,12 +148,36 @@ DefinitionParams::DefinitionParams(TextDocumentIdentifier textDocument,
 DefinitionParams::DefinitionParams(){};
 DefinitionParams::~DefinitionParams(){};
 
-void DefinitionParams::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor DefinitionParams::descriptor =
 {
+	// Fields
+	nullptr,
+
+	// Extra setter
+	{},
+
 	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<DefinitionParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<DefinitionParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<DefinitionParams, PartialResultParams>
+		}
+	}
+};
+
+void DefinitionParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
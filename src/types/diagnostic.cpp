@@ -21,21 +21,21 @@ namespace clsp
 
 using namespace std;
 
-const String Diagnostic::rangeKey              = "range";
-const String Diagnostic::severityKey           = "severity";
-const String Diagnostic::codeKey               = "code";
-const String Diagnostic::sourceKey             = "source";
-const String Diagnostic::messageKey            = "message";
-const String Diagnostic::tagsKey               = "tags";
-const String Diagnostic::relatedInformationKey = "relatedInformation";
+constexpr string_view Diagnostic::rangeKey              = "range";
+constexpr string_view Diagnostic::severityKey           = "severity";
+constexpr string_view Diagnostic::codeKey               = "code";
+constexpr string_view Diagnostic::sourceKey             = "source";
+constexpr string_view Diagnostic::messageKey            = "message";
+constexpr string_view Diagnostic::tagsKey               = "tags";
+constexpr string_view Diagnostic::relatedInformationKey = "relatedInformation";
 
 Diagnostic::Diagnostic(Range range,
 	optional<DiagnosticSeverity> severity,
 	optional<variant<Number, String>> code,
 	optional<String> source,
 	String message,
-	optional<vector<DiagnosticTag>> tags,
-	optional<vector<DiagnosticRelatedInformation>> relatedInformation):
+	optional<Vector<DiagnosticTag>> tags,
+	optional<Vector<DiagnosticRelatedInformation>> relatedInformation):
 		range(range),
 		severity(severity),
 		code(code),
@@ -48,244 +48,264 @@ Diagnostic::Diagnostic(Range range,
 Diagnostic::Diagnostic(){};
 Diagnostic::~Diagnostic(){};
 
-void Diagnostic::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor Diagnostic::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// range:
-	setterMap.emplace(
+	{
+		// Key
 		rangeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				range.fillInitializer(handler->objectStack.top());
-
-				neededMap[rangeKey] = true;
-			}
+			MemberSetter<&Diagnostic::range>::fromObject
 		}
-	);
+	},
 
 	// severity?:
-	setterMap.emplace(
+	{
+		// Key
 		severityKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
+			[](void* object, JsonHandler&, Number n)
 			{
+				auto& self = *static_cast<Diagnostic*>(object);
+
 				if(holds_alternative<int>(n))
 				{
 					int i = get<int>(n);
 
 					if(i > 0 && i <= 4) // Enum bounds
 					{
-						severity = (DiagnosticSeverity)i;
+						self.severity = (DiagnosticSeverity)i;
 						return;
 					}
 				}
-
-				// Nothing by default
 			},
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// code?:
-	setterMap.emplace(
+	{
+		// Key
 		codeKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				code = str;
-			},
+			MemberSetter<&Diagnostic::code>::fromString,
 
 			// Number
-			[this](Number n)
-			{
-				code = n;
-			},
+			MemberSetter<&Diagnostic::code>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// source?:
-	setterMap.emplace(
+	{
+		// Key
 		sourceKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				source = str;
-			},
+			MemberSetter<&Diagnostic::source>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// message?:
-	setterMap.emplace(
+	{
+		// Key
 		messageKey,
-		ValueSetter{
-			// String
-			[this, &neededMap](String str)
-			{
-				message = str;
 
-				neededMap[messageKey] = true;
-			},
+		// Required
+		true,
+
+		// Setter
+		{
+			// String
+			MemberSetter<&Diagnostic::message>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// tags?:
-	setterMap.emplace(
+	{
+		// Key
 		tagsKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
+				auto& self = *static_cast<Diagnostic*>(object);
 
-				tags = vector<DiagnosticTag>();
-
-				auto* maker = new TagsMaker;
-				maker->parent = this;
+				self.tags = Vector<DiagnosticTag>();
 
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
+				auto& maker = handler.pushMaker<TagsMaker>();
+				maker.parent = &self;
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// relatedInformation?:
-	setterMap.emplace(
+	{
+		// Key
 		relatedInformationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
+				auto& self = *static_cast<Diagnostic*>(object);
 
-				relatedInformation = vector<DiagnosticRelatedInformation>();
+				self.relatedInformation = Vector<DiagnosticRelatedInformation>();
 
-				auto* maker = new RelatedInformationMaker;
-				maker->parent = this;
-
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
+				auto& maker = handler.pushMaker<RelatedInformationMaker>();
+				maker.parent = &self;
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor Diagnostic::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(rangeKey, 0);
-	neededMap.emplace(messageKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void Diagnostic::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void Diagnostic::partialWrite(JsonWriter &writer)
@@ -353,32 +373,29 @@ void Diagnostic::partialWrite(JsonWriter &writer)
 	}
 }
 
-void Diagnostic::TagsMaker::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor Diagnostic::TagsMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-	auto& Vector = parent->tags.value();
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// DiagnosticTag[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		[&Vector](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
+			auto& self = *static_cast<TagsMaker*>(object);
+
 			if(holds_alternative<int>(n))
 			{
 				int i = get<int>(n);
 
 				if(i > 0 && i <= 2) // Enum bounds
 				{
-					Vector.emplace_back((DiagnosticTag)i);
+					self.parent->tags->emplace_back((DiagnosticTag)i);
 					return;
 				}
 			}
@@ -388,71 +405,74 @@ void Diagnostic::TagsMaker::fillInitializer(ObjectInitializer& initializer)
 		},
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
-}
+	// Parents
+	{}
+};
 
-void Diagnostic::RelatedInformationMaker::
-	fillInitializer(ObjectInitializer& initializer)
+void Diagnostic::TagsMaker::fillInitializer(ObjectInitializer& initializer)
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-	auto& Vector = parent->relatedInformation.value();
+	initializer.bind(this, descriptor);
+}
 
-	// Value setters
+constexpr ObjectDescriptor Diagnostic::RelatedInformationMaker::descriptor =
+{
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// DiagnosticRelatedInformation[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[&Vector, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& obj = Vector.emplace_back();
+			auto& self = *static_cast<RelatedInformationMaker*>(object);
 
-			handler->pushInitializer();
+			auto& obj = self.parent->relatedInformation->emplace_back();
 
-			obj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(obj);
 		}
-	};
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void Diagnostic::RelatedInformationMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String DiagnosticRelatedInformation::locationKey = "location";
-const String DiagnosticRelatedInformation::messageKey  = "message";
+constexpr string_view DiagnosticRelatedInformation::locationKey = "location";
+constexpr string_view DiagnosticRelatedInformation::messageKey  = "message";
 
 DiagnosticRelatedInformation::DiagnosticRelatedInformation(Location location,
 	String message):
@@ -463,81 +483,84 @@ DiagnosticRelatedInformation::DiagnosticRelatedInformation(Location location,
 DiagnosticRelatedInformation::DiagnosticRelatedInformation(){};
 DiagnosticRelatedInformation::~DiagnosticRelatedInformation(){};
 
-void DiagnosticRelatedInformation::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DiagnosticRelatedInformation::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// location:
-	setterMap.emplace(
+	{
+		// Key
 		locationKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				location.fillInitializer(handler->objectStack.top());
-
-				neededMap[locationKey] = true;
-			}
+			MemberSetter<&DiagnosticRelatedInformation::location>::fromObject
 		}
-	);
+	},
 
 	// message:
-	setterMap.emplace(
+	{
+		// Key
 		messageKey,
-		ValueSetter{
-			// String
-			[this, &neededMap](String str)
-			{
-				message = str;
 
-				neededMap[messageKey] = true;
-			},
+		// Required
+		true,
+
+		// Setter
+		{
+			// String
+			MemberSetter<&DiagnosticRelatedInformation::message>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DiagnosticRelatedInformation::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(locationKey, 0);
-	neededMap.emplace(messageKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DiagnosticRelatedInformation::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void DiagnosticRelatedInformation::partialWrite(JsonWriter &writer)
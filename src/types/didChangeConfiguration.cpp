@@ -22,7 +22,7 @@ namespace clsp
 
 using namespace std;
 
-const String DidChangeConfigurationClientCapabilities::
+constexpr string_view DidChangeConfigurationClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 DidChangeConfigurationClientCapabilities::
@@ -38,46 +38,60 @@ DidChangeConfigurationClientCapabilities::
 	~DidChangeConfigurationClientCapabilities()
 {};
 
-void DidChangeConfigurationClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidChangeConfigurationClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DidChangeConfigurationClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DidChangeConfigurationClientCapabilities::
+	descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DidChangeConfigurationClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String DidChangeConfigurationParams::settingsKey = "settings";
+constexpr string_view DidChangeConfigurationParams::settingsKey = "settings";
 
 DidChangeConfigurationParams::DidChangeConfigurationParams(Any settings):
 	settings(settings)
@@ -86,78 +100,68 @@ DidChangeConfigurationParams::DidChangeConfigurationParams(Any settings):
 DidChangeConfigurationParams::DidChangeConfigurationParams(){};
 DidChangeConfigurationParams::~DidChangeConfigurationParams(){};
 
-void DidChangeConfigurationParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidChangeConfigurationParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// settings
-	setterMap.emplace(
+	{
+		// Key
 		settingsKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				settings = str;
-				neededMap[settingsKey] = true;
-			},
+			MemberSetter<&DidChangeConfigurationParams::settings>::fromString,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				settings = n;
-				neededMap[settingsKey] = true;
-			},
+			MemberSetter<&DidChangeConfigurationParams::settings>::fromNumber,
 
 			// Boolean
-			[this, &neededMap](Boolean b)
-			{
-				settings = b;
-				neededMap[settingsKey] = true;
-			},
+			MemberSetter<&DidChangeConfigurationParams::settings>::fromBoolean,
 
 			// Null
-			[this, &neededMap]()
-			{
-				settings = Null();
-				neededMap[settingsKey] = true;
-			},
+			MemberSetter<&DidChangeConfigurationParams::settings>::fromNull,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				settings = Array();
+				auto& self = *static_cast<DidChangeConfigurationParams*>(object);
 
-				auto* maker = new ArrayMaker(get<Array>(settings));
+				self.settings = Array();
 
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
-
-				neededMap[settingsKey] = true;
+				handler.pushMaker<ArrayMaker>(get<Array>(self.settings));
 			},
 
 			// Object
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				settings = Object(new GenericObject());
+				auto& self = *static_cast<DidChangeConfigurationParams*>(object);
 
-				handler->pushInitializer();
-				get<Object>(settings)->fillInitializer(handler->objectStack.top());
+				self.settings = Object(new GenericObject());
 
-				neededMap[settingsKey] = true;
+				handler.pushObject(*get<Object>(self.settings));
 			}
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DidChangeConfigurationParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(settingsKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DidChangeConfigurationParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String TextDocumentChangeRegistrationOptions::syncKindKey = "syncKind";
+constexpr string_view TextDocumentChangeRegistrationOptions::syncKindKey = "syncKind";
 
 TextDocumentChangeRegistrationOptions::TextDocumentChangeRegistrationOptions(
 	variant<DocumentSelector, Null> documentSelector,
@@ -48,9 +48,9 @@ void TextDocumentChangeRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String TextDocumentContentChangeEvent::rangeKey       = "range";
-const String TextDocumentContentChangeEvent::rangeLengthKey = "rangeLength";
-const String TextDocumentContentChangeEvent::textKey        = "text";
+constexpr string_view TextDocumentContentChangeEvent::rangeKey       = "range";
+constexpr string_view TextDocumentContentChangeEvent::rangeLengthKey = "rangeLength";
+constexpr string_view TextDocumentContentChangeEvent::textKey        = "text";
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -70,117 +70,125 @@ TextDocumentContentChangeEvent::
 TextDocumentContentChangeEvent::TextDocumentContentChangeEvent(){};
 TextDocumentContentChangeEvent::~TextDocumentContentChangeEvent(){};
 
-void TextDocumentContentChangeEvent::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TextDocumentContentChangeEvent::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// range?:
-	setterMap.emplace(
+	{
+		// Key
 		rangeKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				range.emplace();
-
-				handler->pushInitializer();
-				range->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentContentChangeEvent::range>::fromObject
 		}
-	);
+	},
 
 	// rangeLength?:
-	setterMap.emplace(
+	{
+		// Key
 		rangeLengthKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
-			{
-				rangeLength = n;
-			},
+			MemberSetter<&TextDocumentContentChangeEvent::rangeLength>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// text:
-	setterMap.emplace(
+	{
+		// Key
 		textKey,
-		ValueSetter{
-			// String
-			[this, &neededMap](String str)
-			{
-				text = str;
 
-				neededMap[textKey] = true;
-			},
+		// Required
+		true,
+
+		// Setter
+		{
+			// String
+			MemberSetter<&TextDocumentContentChangeEvent::text>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor TextDocumentContentChangeEvent::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void TextDocumentContentChangeEvent::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 #pragma GCC diagnostic pop
 
-const String DidChangeTextDocumentParams::textDocumentKey   = "textDocument";
-const String DidChangeTextDocumentParams::contentChangesKey = "contentChanges";
+constexpr string_view DidChangeTextDocumentParams::textDocumentKey   = "textDocument";
+constexpr string_view DidChangeTextDocumentParams::contentChangesKey = "contentChanges";
 
 DidChangeTextDocumentParams::
 	DidChangeTextDocumentParams(VersionedTextDocumentIdentifier textDocument,
-		vector<TextDocumentContentChangeEvent> contentChanges):
+		Vector<TextDocumentContentChangeEvent> contentChanges):
 			textDocument(textDocument),
 			contentChanges(contentChanges)
 {};
@@ -188,88 +196,94 @@ DidChangeTextDocumentParams::
 DidChangeTextDocumentParams::DidChangeTextDocumentParams(){};
 DidChangeTextDocumentParams::~DidChangeTextDocumentParams(){};
 
-void DidChangeTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidChangeTextDocumentParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&DidChangeTextDocumentParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// contentChanges:
-	setterMap.emplace(
+	{
+		// Key
 		contentChangesKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto* maker = new ContentChangesMaker(contentChanges);
-
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
+				auto& self = *static_cast<DidChangeTextDocumentParams*>(object);
 
-				neededMap[contentChangesKey] = true;
+				handler.pushMaker<ContentChangesMaker>(self.contentChanges);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(contentChangesKey, 0);
+constexpr ObjectDescriptor DidChangeTextDocumentParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DidChangeTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
 DidChangeTextDocumentParams::ContentChangesMaker::
-	ContentChangesMaker(vector<TextDocumentContentChangeEvent> &parentArray):
+	ContentChangesMaker(Vector<TextDocumentContentChangeEvent> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -277,48 +291,49 @@ DidChangeTextDocumentParams::ContentChangesMaker::
 	~ContentChangesMaker()
 {};
 
-void DidChangeTextDocumentParams::ContentChangesMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor DidChangeTextDocumentParams::ContentChangesMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// TextDocumentContentChangeEvent[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& newObject = parentArray.emplace_back();
+			auto& self = *static_cast<ContentChangesMaker*>(object);
 
-			handler->pushInitializer();
-			newObject.fillInitializer(handler->objectStack.top());
+			auto& newObject = self.parentArray.emplace_back();
+
+			handler.pushObject(newObject);
 		}
-	};
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DidChangeTextDocumentParams::ContentChangesMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String DidChangeWatchedFilesClientCapabilities::
+constexpr string_view DidChangeWatchedFilesClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 DidChangeWatchedFilesClientCapabilities::
@@ -37,47 +37,60 @@ DidChangeWatchedFilesClientCapabilities::
 	~DidChangeWatchedFilesClientCapabilities()
 {};
 
-void DidChangeWatchedFilesClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidChangeWatchedFilesClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DidChangeWatchedFilesClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DidChangeWatchedFilesClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DidChangeWatchedFilesClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String FileSystemWatcher::globPatternKey = "globPattern";
-const String FileSystemWatcher::kindKey        = "kind";
+constexpr string_view FileSystemWatcher::globPatternKey = "globPattern";
+constexpr string_view FileSystemWatcher::kindKey        = "kind";
 
 FileSystemWatcher::FileSystemWatcher(String globPattern, optional<WatchKind> kind):
 	globPattern(globPattern),
@@ -102,10 +115,10 @@ void FileSystemWatcher::partialWrite(JsonWriter &writer)
 }
 
 
-const String DidChangeWatchedFilesRegistrationOptions::watchersKey = "watchers";
+constexpr string_view DidChangeWatchedFilesRegistrationOptions::watchersKey = "watchers";
 
 DidChangeWatchedFilesRegistrationOptions::
-	DidChangeWatchedFilesRegistrationOptions(vector<FileSystemWatcher> watchers):
+	DidChangeWatchedFilesRegistrationOptions(Vector<FileSystemWatcher> watchers):
 		watchers(watchers)
 {};
 
@@ -130,8 +143,8 @@ void DidChangeWatchedFilesRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String FileEvent::uriKey  = "uri";
-const String FileEvent::typeKey = "type";
+constexpr string_view FileEvent::uriKey  = "uri";
+constexpr string_view FileEvent::typeKey = "type";
 
 FileEvent::FileEvent(DocumentUri uri, FileChangeType type):
 	uri(uri),
@@ -141,196 +154,216 @@ FileEvent::FileEvent(DocumentUri uri, FileChangeType type):
 FileEvent::FileEvent(){};
 FileEvent::~FileEvent(){};
 
-void FileEvent::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor FileEvent::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// uri:
-	setterMap.emplace(
+	{
+		// Key
 		uriKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				uri = str;
-				neededMap[uriKey] = true;
-			},
+			MemberSetter<&FileEvent::uri>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// type:
-	setterMap.emplace(
+	{
+		// Key
 		typeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
+			[](void* object, JsonHandler&, Number n)
 			{
+				auto& self = *static_cast<FileEvent*>(object);
+
 				if(holds_alternative<int>(n))
 				{
 					int i = get<int>(n);
 
-					type = (FileChangeType)i;
-					neededMap[typeKey] = true;
+					self.type = (FileChangeType)i;
 				}
 				else
 				{
-					// TODO: An exception or something
 				}
 			},
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor FileEvent::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(uriKey, 0);
-	neededMap.emplace(typeKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void FileEvent::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String DidChangeWatchedFilesParams::changesKey = "changes";
+constexpr string_view DidChangeWatchedFilesParams::changesKey = "changes";
 
-DidChangeWatchedFilesParams::DidChangeWatchedFilesParams(vector<FileEvent> changes):
+DidChangeWatchedFilesParams::DidChangeWatchedFilesParams(Vector<FileEvent> changes):
 	changes(changes)
 {};
 
 DidChangeWatchedFilesParams::DidChangeWatchedFilesParams(){};
 DidChangeWatchedFilesParams::~DidChangeWatchedFilesParams(){};
 
-void DidChangeWatchedFilesParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidChangeWatchedFilesParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// changes:
-	setterMap.emplace(
+	{
+		// Key
 		changesKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				handler->pushInitializer();
-
-				auto *maker = new ChangesMaker(changes);
-
-				maker->fillInitializer(handler->objectStack.top());
+				auto& self = *static_cast<DidChangeWatchedFilesParams*>(object);
 
-				neededMap[changesKey] = true;
+				handler.pushMaker<ChangesMaker>(self.changes);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DidChangeWatchedFilesParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(changesKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DidChangeWatchedFilesParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
 DidChangeWatchedFilesParams::ChangesMaker::
-	ChangesMaker(vector<FileEvent> &parentArray):
+	ChangesMaker(Vector<FileEvent> &parentArray):
 		parentArray(parentArray)
 {};
 
 DidChangeWatchedFilesParams::ChangesMaker::~ChangesMaker(){};
 
 
-void DidChangeWatchedFilesParams::ChangesMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor DidChangeWatchedFilesParams::ChangesMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// FileEvent[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& obj = parentArray.emplace_back();
+			auto& self = *static_cast<ChangesMaker*>(object);
+
+			auto& obj = self.parentArray.emplace_back();
 
-			handler->pushInitializer();
-			obj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(obj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DidChangeWatchedFilesParams::ChangesMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
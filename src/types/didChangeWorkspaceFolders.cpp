@@ -21,12 +21,12 @@ namespace clsp
 
 using namespace std;
 
-const String WorkspaceFoldersChangeEvent::addedKey   = "added";
-const String WorkspaceFoldersChangeEvent::removedKey = "removed";
+constexpr string_view WorkspaceFoldersChangeEvent::addedKey   = "added";
+constexpr string_view WorkspaceFoldersChangeEvent::removedKey = "removed";
 
 WorkspaceFoldersChangeEvent::WorkspaceFoldersChangeEvent(
-	vector<WorkspaceFolder> added,
-	vector<WorkspaceFolder> removed):
+	Vector<WorkspaceFolder> added,
+	Vector<WorkspaceFolder> removed):
 		added(added),
 		removed(removed)
 {};
@@ -34,142 +34,151 @@ WorkspaceFoldersChangeEvent::WorkspaceFoldersChangeEvent(
 WorkspaceFoldersChangeEvent::WorkspaceFoldersChangeEvent(){};
 WorkspaceFoldersChangeEvent::~WorkspaceFoldersChangeEvent(){};
 
-void WorkspaceFoldersChangeEvent::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkspaceFoldersChangeEvent::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// added:
-	setterMap.emplace(
+	{
+		// Key
 		addedKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto* maker = new AddedRemovedMaker(added);
-
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
+				auto& self = *static_cast<WorkspaceFoldersChangeEvent*>(object);
 
-				neededMap[addedKey] = true;
+				handler.pushMaker<AddedRemovedMaker>(self.added);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// removed:
-	setterMap.emplace(
+	{
+		// Key
 		removedKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto* maker = new AddedRemovedMaker(removed);
-
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
+				auto& self = *static_cast<WorkspaceFoldersChangeEvent*>(object);
 
-				neededMap[removedKey] = true;
+				handler.pushMaker<AddedRemovedMaker>(self.removed);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkspaceFoldersChangeEvent::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(addedKey, 0);
-	neededMap.emplace(removedKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void WorkspaceFoldersChangeEvent::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
 WorkspaceFoldersChangeEvent::AddedRemovedMaker::
-	AddedRemovedMaker(vector<WorkspaceFolder>& parentArray):
+	AddedRemovedMaker(Vector<WorkspaceFolder>& parentArray):
 		parentArray(parentArray)
 {};
 
 WorkspaceFoldersChangeEvent::AddedRemovedMaker::~AddedRemovedMaker(){};
 
-void WorkspaceFoldersChangeEvent::AddedRemovedMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor WorkspaceFoldersChangeEvent::AddedRemovedMaker::
+	descriptor =
 {
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// WorkspaceFolder[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& newObj = parentArray.emplace_back();
+			auto& self = *static_cast<AddedRemovedMaker*>(object);
 
-			handler->pushInitializer();
+			auto& newObj = self.parentArray.emplace_back();
 
-			newObj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(newObj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
 
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
+void WorkspaceFoldersChangeEvent::AddedRemovedMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String DidChangeWorkspaceFoldersParams::eventKey = "event";
+constexpr string_view DidChangeWorkspaceFoldersParams::eventKey = "event";
 
 DidChangeWorkspaceFoldersParams::
 	DidChangeWorkspaceFoldersParams(WorkspaceFoldersChangeEvent event):
@@ -179,50 +188,54 @@ DidChangeWorkspaceFoldersParams::
 DidChangeWorkspaceFoldersParams::DidChangeWorkspaceFoldersParams(){};
 DidChangeWorkspaceFoldersParams::~DidChangeWorkspaceFoldersParams(){};
 
-void DidChangeWorkspaceFoldersParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidChangeWorkspaceFoldersParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// event:
-	setterMap.emplace(
+	{
+		// Key
 		eventKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				event.fillInitializer(handler->objectStack.top());
-
-				neededMap[eventKey] = true;
-			}
+			MemberSetter<&DidChangeWorkspaceFoldersParams::event>::fromObject
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(eventKey, 0);
+constexpr ObjectDescriptor DidChangeWorkspaceFoldersParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DidChangeWorkspaceFoldersParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String DidCloseTextDocumentParams::textDocumentKey = "textDocument";
+constexpr string_view DidCloseTextDocumentParams::textDocumentKey = "textDocument";
 
 DidCloseTextDocumentParams::
 	DidCloseTextDocumentParams(TextDocumentIdentifier textDocument):
@@ -31,50 +31,54 @@ DidCloseTextDocumentParams::
 DidCloseTextDocumentParams::DidCloseTextDocumentParams(){};
 DidCloseTextDocumentParams::~DidCloseTextDocumentParams(){};
 
-void DidCloseTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidCloseTextDocumentParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&DidCloseTextDocumentParams::textDocument>::fromObject
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DidCloseTextDocumentParams::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DidCloseTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
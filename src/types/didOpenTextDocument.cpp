@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String DidOpenTextDocumentParams::textDocumentKey = "textDocument";
+constexpr string_view DidOpenTextDocumentParams::textDocumentKey = "textDocument";
 
 DidOpenTextDocumentParams::DidOpenTextDocumentParams(TextDocumentItem textDocument):
 	textDocument(textDocument)
@@ -30,50 +30,54 @@ DidOpenTextDocumentParams::DidOpenTextDocumentParams(TextDocumentItem textDocume
 DidOpenTextDocumentParams::DidOpenTextDocumentParams(){};
 DidOpenTextDocumentParams::~DidOpenTextDocumentParams(){};
 
-void DidOpenTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidOpenTextDocumentParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&DidOpenTextDocumentParams::textDocument>::fromObject
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DidOpenTextDocumentParams::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DidOpenTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String SaveOptions::includeTextKey = "includeText";
+constexpr string_view SaveOptions::includeTextKey = "includeText";
 
 SaveOptions::SaveOptions(optional<Boolean> includeText):
 	includeText(includeText)
@@ -41,7 +41,7 @@ void SaveOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String TextDocumentSaveRegistrationOptions::includeTextKey = "includeText";
+constexpr string_view TextDocumentSaveRegistrationOptions::includeTextKey = "includeText";
 
 TextDocumentSaveRegistrationOptions::TextDocumentSaveRegistrationOptions(
 	variant<DocumentSelector, Null> documentSelector,
@@ -67,8 +67,8 @@ void TextDocumentSaveRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String DidSaveTextDocumentParams::textDocumentKey = "textDocument";
-const String DidSaveTextDocumentParams::textKey         = "text";
+constexpr string_view DidSaveTextDocumentParams::textDocumentKey = "textDocument";
+constexpr string_view DidSaveTextDocumentParams::textKey         = "text";
 
 DidSaveTextDocumentParams::
 	DidSaveTextDocumentParams(TextDocumentIdentifier textDocument,
@@ -80,77 +80,84 @@ DidSaveTextDocumentParams::
 DidSaveTextDocumentParams::DidSaveTextDocumentParams(){};
 DidSaveTextDocumentParams::~DidSaveTextDocumentParams(){};
 
-void DidSaveTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DidSaveTextDocumentParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&DidSaveTextDocumentParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// text?:
-	setterMap.emplace(
+	{
+		// Key
 		textKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				text = str;
-			},
+			MemberSetter<&DidSaveTextDocumentParams::text>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DidSaveTextDocumentParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DidSaveTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
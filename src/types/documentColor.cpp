@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String DocumentColorClientCapabilities::
+constexpr string_view DocumentColorClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 DocumentColorClientCapabilities::
@@ -32,42 +32,55 @@ DocumentColorClientCapabilities::
 DocumentColorClientCapabilities::DocumentColorClientCapabilities(){};
 DocumentColorClientCapabilities::~DocumentColorClientCapabilities(){};
 
-void DocumentColorClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentColorClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DocumentColorClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// This
-	initializer.object = this;
+constexpr ObjectDescriptor DocumentColorClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void DocumentColorClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 DocumentColorRegistrationOptions::DocumentColorRegistrationOptions(
@@ -92,7 +105,7 @@ void DocumentColorRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String DocumentColorParams::textDocumentKey = "textDocument";
+constexpr string_view DocumentColorParams::textDocumentKey = "textDocument";
 
 DocumentColorParams::DocumentColorParams(optional<ProgressToken> workDoneToken,
 	optional<ProgressToken> partialResultToken,
@@ -105,62 +118,71 @@ DocumentColorParams::DocumentColorParams(optional<ProgressToken> workDoneToken,
 DocumentColorParams::DocumentColorParams(){};
 DocumentColorParams::~DocumentColorParams(){};
 
-void DocumentColorParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentColorParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&DocumentColorParams::textDocument>::fromObject
+		}
+	}
+};
 
-				textDocument.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor DocumentColorParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[textDocumentKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<DocumentColorParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<DocumentColorParams, PartialResultParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void DocumentColorParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String Color::redKey   = "red";
-const String Color::greenKey = "green";
-const String Color::blueKey  = "blue";
-const String Color::alphaKey = "alpha";
+constexpr string_view Color::redKey   = "red";
+constexpr string_view Color::greenKey = "green";
+constexpr string_view Color::blueKey  = "blue";
+constexpr string_view Color::alphaKey = "alpha";
 
 Color::Color(Number red, Number green, Number blue, Number alpha):
 	red(red),
@@ -172,133 +194,144 @@ Color::Color(Number red, Number green, Number blue, Number alpha):
 Color::Color(){};
 Color::~Color(){};
 
-void Color::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor Color::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// red:
-	setterMap.emplace(
+	{
+		// Key
 		redKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				red = n;
-				neededMap[redKey] = true;
-			},
+			MemberSetter<&Color::red>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// green:
-	setterMap.emplace(
+	{
+		// Key
 		greenKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				green = n;
-				neededMap[greenKey] = true;
-			},
+			MemberSetter<&Color::green>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// blue:
-	setterMap.emplace(
+	{
+		// Key
 		blueKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				blue = n;
-				neededMap[blueKey] = true;
-			},
+			MemberSetter<&Color::blue>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// alpha:
-	setterMap.emplace(
+	{
+		// Key
 		alphaKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				alpha = n;
-				neededMap[alphaKey] = true;
-			},
+			MemberSetter<&Color::alpha>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(redKey, 0);
-	neededMap.emplace(greenKey, 0);
-	neededMap.emplace(blueKey, 0);
-	neededMap.emplace(alphaKey, 0);
+constexpr ObjectDescriptor Color::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void Color::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void Color::partialWrite(JsonWriter &writer)
@@ -321,8 +354,8 @@ void Color::partialWrite(JsonWriter &writer)
 }
 
 
-const String ColorInformation::rangeKey = "range";
-const String ColorInformation::colorKey = "color";
+constexpr string_view ColorInformation::rangeKey = "range";
+constexpr string_view ColorInformation::colorKey = "color";
 
 ColorInformation::ColorInformation(Range range, Color color):
 	range(range),
@@ -21,9 +21,9 @@ namespace clsp
 
 using namespace std;
 
-const String DocumentFilter::languageKey = "language";
-const String DocumentFilter::schemeKey   = "scheme";
-const String DocumentFilter::patternKey  = "pattern";
+constexpr string_view DocumentFilter::languageKey = "language";
+constexpr string_view DocumentFilter::schemeKey   = "scheme";
+constexpr string_view DocumentFilter::patternKey  = "pattern";
 
 DocumentFilter::DocumentFilter(optional<String> language,
 	optional<String> scheme,
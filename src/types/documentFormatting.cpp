@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String DocumentFormattingClientCapabilities::
+constexpr string_view DocumentFormattingClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 DocumentFormattingClientCapabilities::
@@ -32,42 +32,55 @@ DocumentFormattingClientCapabilities::
 DocumentFormattingClientCapabilities::DocumentFormattingClientCapabilities(){};
 DocumentFormattingClientCapabilities::~DocumentFormattingClientCapabilities(){};
 
-void DocumentFormattingClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentFormattingClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DocumentFormattingClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DocumentFormattingClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DocumentFormattingClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
@@ -89,19 +102,19 @@ void DocumentFormattingRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String FormattingOptions::
+constexpr string_view FormattingOptions::
 	tabSizeKey                = "tabSize";
 
-const String FormattingOptions::
+constexpr string_view FormattingOptions::
 	insertSpacesKey           = "insertSpaces";
 
-const String FormattingOptions::
+constexpr string_view FormattingOptions::
 	trimTrailingWhitespaceKey = "trimTrailingWhitespace";
 
-const String FormattingOptions::
+constexpr string_view FormattingOptions::
 	insertFinalNewlineKey     = "insertFinalNewline";
 
-const String FormattingOptions::
+constexpr string_view FormattingOptions::
 	trimFinalNewlinesKey      = "trimFinalNewlines";
 
 FormattingOptions::FormattingOptions(Number tabSize,
@@ -109,7 +122,7 @@ FormattingOptions::FormattingOptions(Number tabSize,
 	optional<Boolean> trimTrailingWhitespace,
 	optional<Boolean> insertFinalNewline,
 	optional<Boolean> trimFinalNewlines,
-	map<String, variant<Boolean, Number, String>> extras):
+	Map<String, variant<Boolean, Number, String>> extras):
 		tabSize(tabSize),
 		insertSpaces(insertSpaces),
 		trimTrailingWhitespace(trimTrailingWhitespace),
@@ -121,195 +134,213 @@ FormattingOptions::FormattingOptions(Number tabSize,
 FormattingOptions::FormattingOptions(){};
 FormattingOptions::~FormattingOptions(){};
 
-void FormattingOptions::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor FormattingOptions::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
-
 	// tabSize:
-	setterMap.emplace(
+	{
+		// Key
 		tabSizeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				tabSize = n;
-				neededMap[tabSizeKey] = true;
-			},
+			MemberSetter<&FormattingOptions::tabSize>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// insertSpaces:
-	setterMap.emplace(
+	{
+		// Key
 		insertSpacesKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this, &neededMap](Boolean b)
-			{
-				insertSpaces = b;
-				neededMap[insertSpacesKey] = true;
-			},
+			MemberSetter<&FormattingOptions::insertSpaces>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// trimTrailingWhitespace?:
-	setterMap.emplace(
+	{
+		// Key
 		trimTrailingWhitespaceKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				trimTrailingWhitespace = b;
-			},
+			MemberSetter<&FormattingOptions::trimTrailingWhitespace>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// insertFinalNewline?:
-	setterMap.emplace(
+	{
+		// Key
 		insertFinalNewlineKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				insertFinalNewline = b;
-			},
+			MemberSetter<&FormattingOptions::insertFinalNewline>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// trimFinalNewlines?:
-	setterMap.emplace(
+	{
+		// Key
 		trimFinalNewlinesKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				trimFinalNewlines = b;
-			},
+			MemberSetter<&FormattingOptions::trimFinalNewlines>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
+constexpr ObjectDescriptor FormattingOptions::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
 	// Extra members
-	extraSetter =
 	{
 		// String
-		[this, handler](String str)
+		[](void* object, JsonHandler& handler, String&& str)
 		{
-			extras.emplace(handler->lastKey, str);
+			auto& self = *static_cast<FormattingOptions*>(object);
+
+			self.extras.emplace(handler.lastKey, move(str));
 		},
 
 		// Number
-		[this, handler](Number n)
+		[](void* object, JsonHandler& handler, Number n)
 		{
-			extras.emplace(handler->lastKey, n);
+			auto& self = *static_cast<FormattingOptions*>(object);
+
+			self.extras.emplace(handler.lastKey, n);
 		},
 
 		// Boolean
-		[this, handler](Boolean b)
+		[](void* object, JsonHandler& handler, Boolean b)
 		{
-			extras.emplace(handler->lastKey, b);
+			auto& self = *static_cast<FormattingOptions*>(object);
+
+			self.extras.emplace(handler.lastKey, b);
 		},
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// Needed members
-	neededMap.emplace(tabSizeKey, 0);
-	neededMap.emplace(insertSpacesKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void FormattingOptions::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String DocumentFormattingParams::textDocumentKey = "textDocument";
-const String DocumentFormattingParams::optionsKey      = "options";
+constexpr string_view DocumentFormattingParams::textDocumentKey = "textDocument";
+constexpr string_view DocumentFormattingParams::optionsKey      = "options";
 
 DocumentFormattingParams::DocumentFormattingParams(
 	optional<ProgressToken> workDoneToken,
@@ -323,86 +354,89 @@ DocumentFormattingParams::DocumentFormattingParams(
 DocumentFormattingParams::DocumentFormattingParams(){};
 DocumentFormattingParams::~DocumentFormattingParams(){};
 
-void DocumentFormattingParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentFormattingParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parent
-	WorkDoneProgressParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&DocumentFormattingParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// options:
-	setterMap.emplace(
+	{
+		// Key
 		optionsKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&DocumentFormattingParams::options>::fromObject
+		}
+	}
+};
 
-				options.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor DocumentFormattingParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[optionsKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(optionsKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<DocumentFormattingParams, WorkDoneProgressParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void DocumentFormattingParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
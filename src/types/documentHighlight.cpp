@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String DocumentHighlightClientCapabilities::
+constexpr string_view DocumentHighlightClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 DocumentHighlightClientCapabilities::
@@ -32,42 +32,55 @@ DocumentHighlightClientCapabilities::
 DocumentHighlightClientCapabilities::DocumentHighlightClientCapabilities(){};
 DocumentHighlightClientCapabilities::~DocumentHighlightClientCapabilities(){};
 
-void DocumentHighlightClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentHighlightClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DocumentHighlightClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DocumentHighlightClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DocumentHighlightClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 DocumentHighlightRegistrationOptions::DocumentHighlightRegistrationOptions(
@@ -100,17 +113,41 @@ DocumentHighlightParams::DocumentHighlightParams(TextDocumentIdentifier textDocu
 DocumentHighlightParams::DocumentHighlightParams(){};
 DocumentHighlightParams::~DocumentHighlightParams(){};
 
-void DocumentHighlightParams::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor DocumentHighlightParams::descriptor =
 {
+	// Fields
+	nullptr,
+
+	// Extra setter
+	{},
+
 	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<DocumentHighlightParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<DocumentHighlightParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<DocumentHighlightParams, PartialResultParams>
+		}
+	}
+};
+
+void DocumentHighlightParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String DocumentHighlight::rangeKey = "range";
-const String DocumentHighlight::kindKey  = "kind";
+constexpr string_view DocumentHighlight::rangeKey = "range";
+constexpr string_view DocumentHighlight::kindKey  = "kind";
 
 DocumentHighlight::DocumentHighlight(Range range,
 	optional<DocumentHighlightKind> kind):
@@ -21,10 +21,10 @@ namespace clsp
 
 using namespace std;
 
-const String DocumentLinkClientCapabilities::
+constexpr string_view DocumentLinkClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String DocumentLinkClientCapabilities::
+constexpr string_view DocumentLinkClientCapabilities::
 	tooltipSupportKey      = "tooltipSupport";
 
 DocumentLinkClientCapabilities::
@@ -38,73 +38,89 @@ DocumentLinkClientCapabilities::
 DocumentLinkClientCapabilities:: DocumentLinkClientCapabilities(){};
 DocumentLinkClientCapabilities::~DocumentLinkClientCapabilities(){};
 
-void DocumentLinkClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentLinkClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DocumentLinkClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// tooltipSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		tooltipSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				tooltipSupport = b;
-			},
+			MemberSetter<&DocumentLinkClientCapabilities::tooltipSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DocumentLinkClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void DocumentLinkClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String DocumentLinkOptions::resolveProviderKey = "resolveProvider";
+constexpr string_view DocumentLinkOptions::resolveProviderKey = "resolveProvider";
 
 DocumentLinkOptions::DocumentLinkOptions(optional<Boolean> workDoneProgress,
 	optional<Boolean> resolveProvider):
@@ -149,7 +165,7 @@ void DocumentLinkRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String DocumentLinkParams::textDocumentKey = "textDocument";
+constexpr string_view DocumentLinkParams::textDocumentKey = "textDocument";
 
 DocumentLinkParams::DocumentLinkParams(optional<ProgressToken> workDoneToken,
 	optional<ProgressToken> partialResultToken,
@@ -162,61 +178,70 @@ DocumentLinkParams::DocumentLinkParams(optional<ProgressToken> workDoneToken,
 DocumentLinkParams::DocumentLinkParams(){};
 DocumentLinkParams::~DocumentLinkParams(){};
 
-void DocumentLinkParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentLinkParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&DocumentLinkParams::textDocument>::fromObject
+		}
+	}
+};
 
-				textDocument.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor DocumentLinkParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[textDocumentKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<DocumentLinkParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<DocumentLinkParams, PartialResultParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void DocumentLinkParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String DocumentLink::rangeKey   = "range";
-const String DocumentLink::targetKey  = "target";
-const String DocumentLink::tooltipKey = "tooltip";
-const String DocumentLink::dataKey    = "data";
+constexpr string_view DocumentLink::rangeKey   = "range";
+constexpr string_view DocumentLink::targetKey  = "target";
+constexpr string_view DocumentLink::tooltipKey = "tooltip";
+constexpr string_view DocumentLink::dataKey    = "data";
 
 DocumentLink::DocumentLink(Range range,
 	optional<DocumentUri> target,
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String DocumentOnTypeFormattingClientCapabilities::
+constexpr string_view DocumentOnTypeFormattingClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 DocumentOnTypeFormattingClientCapabilities::
@@ -37,54 +37,68 @@ DocumentOnTypeFormattingClientCapabilities::
 	~DocumentOnTypeFormattingClientCapabilities()
 {};
 
-void DocumentOnTypeFormattingClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentOnTypeFormattingClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DocumentOnTypeFormattingClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DocumentOnTypeFormattingClientCapabilities::
+	descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void DocumentOnTypeFormattingClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String DocumentOnTypeFormattingOptions::
+constexpr string_view DocumentOnTypeFormattingOptions::
 	firstTriggerCharacterKey = "firstTriggerCharacter";
 
-const String DocumentOnTypeFormattingOptions::
+constexpr string_view DocumentOnTypeFormattingOptions::
 	moreTriggerCharacterKey  = "moreTriggerCharacter";
 
 DocumentOnTypeFormattingOptions::
 	DocumentOnTypeFormattingOptions(String firstTriggerCharacter,
-		optional<vector<String>> moreTriggerCharacter):
+		optional<Vector<String>> moreTriggerCharacter):
 			firstTriggerCharacter(firstTriggerCharacter),
 			moreTriggerCharacter(moreTriggerCharacter)
 {};
@@ -116,7 +130,7 @@ DocumentOnTypeFormattingRegistrationOptions::
 	DocumentOnTypeFormattingRegistrationOptions(
 		variant<DocumentSelector, Null> documentSelector,
 		String firstTriggerCharacter,
-		optional<vector<String>> moreTriggerCharacter):
+		optional<Vector<String>> moreTriggerCharacter):
 			TextDocumentRegistrationOptions(documentSelector),
 			DocumentOnTypeFormattingOptions(firstTriggerCharacter,
 				moreTriggerCharacter)
@@ -139,8 +153,8 @@ void DocumentOnTypeFormattingRegistrationOptions::
 }
 
 
-const String DocumentOnTypeFormattingParams::chKey           = "ch";
-const String DocumentOnTypeFormattingParams::optionsKey      = "options";
+constexpr string_view DocumentOnTypeFormattingParams::chKey           = "ch";
+constexpr string_view DocumentOnTypeFormattingParams::optionsKey      = "options";
 
 DocumentOnTypeFormattingParams::DocumentOnTypeFormattingParams(
 	TextDocumentIdentifier textDocument,
@@ -155,84 +169,90 @@ DocumentOnTypeFormattingParams::DocumentOnTypeFormattingParams(
 DocumentOnTypeFormattingParams::DocumentOnTypeFormattingParams(){};
 DocumentOnTypeFormattingParams::~DocumentOnTypeFormattingParams(){};
 
-void DocumentOnTypeFormattingParams::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentOnTypeFormattingParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parent
-	TextDocumentPositionParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// ch:
-	setterMap.emplace(
+	{
+		// Key
 		chKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				ch = str;
-				neededMap[chKey] = true;
-			},
+			MemberSetter<&DocumentOnTypeFormattingParams::ch>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// options:
-	setterMap.emplace(
+	{
+		// Key
 		optionsKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&DocumentOnTypeFormattingParams::options>::fromObject
+		}
+	}
+};
 
-				options.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor DocumentOnTypeFormattingParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[optionsKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(chKey, 0);
-	neededMap.emplace(optionsKey, 0);
+	// Parents
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<DocumentOnTypeFormattingParams, TextDocumentPositionParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void DocumentOnTypeFormattingParams::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
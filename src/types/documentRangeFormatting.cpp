@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String DocumentRangeFormattingClientCapabilities::
+constexpr string_view DocumentRangeFormattingClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 DocumentRangeFormattingClientCapabilities::
@@ -37,42 +37,56 @@ DocumentRangeFormattingClientCapabilities::
 	~DocumentRangeFormattingClientCapabilities()
 {};
 
-void DocumentRangeFormattingClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentRangeFormattingClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DocumentRangeFormattingClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DocumentRangeFormattingClientCapabilities::
+	descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void DocumentRangeFormattingClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
@@ -99,9 +113,9 @@ void DocumentRangeFormattingRegistrationOptions::partialWrite(JsonWriter &writer
 }
 
 
-const String DocumentRangeFormattingParams::textDocumentKey = "textDocument";
-const String DocumentRangeFormattingParams::rangeKey        = "range";
-const String DocumentRangeFormattingParams::optionsKey      = "options";
+constexpr string_view DocumentRangeFormattingParams::textDocumentKey = "textDocument";
+constexpr string_view DocumentRangeFormattingParams::rangeKey        = "range";
+constexpr string_view DocumentRangeFormattingParams::optionsKey      = "options";
 
 DocumentRangeFormattingParams::DocumentRangeFormattingParams(
 	optional<ProgressToken> workDoneToken,
@@ -117,119 +131,120 @@ DocumentRangeFormattingParams::DocumentRangeFormattingParams(
 DocumentRangeFormattingParams::DocumentRangeFormattingParams(){};
 DocumentRangeFormattingParams::~DocumentRangeFormattingParams(){};
 
-void DocumentRangeFormattingParams::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentRangeFormattingParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parent
-	WorkDoneProgressParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&DocumentRangeFormattingParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// range:
-	setterMap.emplace(
+	{
+		// Key
 		rangeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				range.fillInitializer(handler->objectStack.top());
-
-				neededMap[rangeKey] = true;
-			}
+			MemberSetter<&DocumentRangeFormattingParams::range>::fromObject
 		}
-	);
+	},
 
 	// options:
-	setterMap.emplace(
+	{
+		// Key
 		optionsKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&DocumentRangeFormattingParams::options>::fromObject
+		}
+	}
+};
 
-				options.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor DocumentRangeFormattingParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[optionsKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(rangeKey, 0);
-	neededMap.emplace(optionsKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<DocumentRangeFormattingParams, WorkDoneProgressParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void DocumentRangeFormattingParams::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
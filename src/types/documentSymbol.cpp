@@ -21,13 +21,13 @@ namespace clsp
 
 using namespace std;
 
-const String DocumentSymbolClientCapabilities::
+constexpr string_view DocumentSymbolClientCapabilities::
 	dynamicRegistrationKey               = "dynamicRegistration";
 
-const String DocumentSymbolClientCapabilities::
+constexpr string_view DocumentSymbolClientCapabilities::
 	symbolKindKey                        = "symbolKind";
 
-const String DocumentSymbolClientCapabilities::
+constexpr string_view DocumentSymbolClientCapabilities::
 	hierarchicalDocumentSymbolSupportKey = "hierarchicalDocumentSymbolSupport";
 
 DocumentSymbolClientCapabilities::
@@ -42,163 +42,191 @@ DocumentSymbolClientCapabilities::
 DocumentSymbolClientCapabilities::DocumentSymbolClientCapabilities(){};
 DocumentSymbolClientCapabilities::~DocumentSymbolClientCapabilities(){};
 
-void DocumentSymbolClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentSymbolClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&DocumentSymbolClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// symbolKind?:
-	setterMap.emplace(
+	{
+		// Key
 		symbolKindKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				symbolKind.emplace();
-
-				handler->pushInitializer();
-				symbolKind->fillInitializer(handler->objectStack.top());
-			},
+			MemberSetter<&DocumentSymbolClientCapabilities::symbolKind>::fromObject
 		}
-	);
+	},
 
 	// hierarchicalDocumentSymbolSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		hierarchicalDocumentSymbolSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				hierarchicalDocumentSymbolSupport = b;
-			},
+			MemberSetter<&DocumentSymbolClientCapabilities::hierarchicalDocumentSymbolSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DocumentSymbolClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void DocumentSymbolClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String DocumentSymbolClientCapabilities::SymbolKind::
+constexpr string_view DocumentSymbolClientCapabilities::SymbolKind::
 	valueSetKey = "valueSet";
 
 DocumentSymbolClientCapabilities::SymbolKind::
-	SymbolKind(optional<vector<clsp::SymbolKind>> valueSet):
+	SymbolKind(optional<Vector<clsp::SymbolKind>> valueSet):
 		valueSet(valueSet)
 {};
 
 DocumentSymbolClientCapabilities::SymbolKind::SymbolKind(){};
 DocumentSymbolClientCapabilities::SymbolKind::~SymbolKind(){};
 
-void DocumentSymbolClientCapabilities::SymbolKind::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentSymbolClientCapabilities::SymbolKind::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// valueSet?:
-	setterMap.emplace(
+	{
+		// Key
 		valueSetKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				valueSet.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<SymbolKind*>(object);
 
-				auto* maker = new ValueSetMaker(valueSet.value());
+				self.valueSet.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ValueSetMaker>(self.valueSet.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor DocumentSymbolClientCapabilities::SymbolKind::
+	descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DocumentSymbolClientCapabilities::SymbolKind::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
 DocumentSymbolClientCapabilities::SymbolKind::ValueSetMaker::
-	ValueSetMaker(vector<clsp::SymbolKind> &parentArray):
+	ValueSetMaker(Vector<clsp::SymbolKind> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -206,51 +234,52 @@ DocumentSymbolClientCapabilities::SymbolKind::ValueSetMaker::
 	~ValueSetMaker()
 {};
 
-void DocumentSymbolClientCapabilities::SymbolKind::ValueSetMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor DocumentSymbolClientCapabilities::SymbolKind::ValueSetMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// SymbolKind[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		[this](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
+			auto& self = *static_cast<ValueSetMaker*>(object);
+
 			if(holds_alternative<int>(n))
 			{
 				int i = get<int>(n);
 
-				parentArray.emplace_back((clsp::SymbolKind)i);
+				self.parentArray.emplace_back((clsp::SymbolKind)i);
 			}
-
-			// Nothing is added by default
-
 		},
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void DocumentSymbolClientCapabilities::SymbolKind::ValueSetMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 DocumentSymbolRegistrationOptions::DocumentSymbolRegistrationOptions(
@@ -271,7 +300,7 @@ void DocumentSymbolRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String DocumentSymbolParams::textDocumentKey = "textDocument";
+constexpr string_view DocumentSymbolParams::textDocumentKey = "textDocument";
 
 DocumentSymbolParams::DocumentSymbolParams(optional<ProgressToken> workDoneToken,
 	optional<ProgressToken> partialResultToken,
@@ -284,66 +313,73 @@ DocumentSymbolParams::DocumentSymbolParams(optional<ProgressToken> workDoneToken
 DocumentSymbolParams::DocumentSymbolParams(){};
 DocumentSymbolParams::~DocumentSymbolParams(){};
 
-void DocumentSymbolParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor DocumentSymbolParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&DocumentSymbolParams::textDocument>::fromObject
+		}
+	}
+};
 
-				textDocument.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor DocumentSymbolParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[textDocumentKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<DocumentSymbolParams, WorkDoneProgressParams>
+		},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
+		{
+			&PartialResultParams::descriptor,
+			upcast<DocumentSymbolParams, PartialResultParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void DocumentSymbolParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String DocumentSymbol::nameKey           = "name";
-const String DocumentSymbol::detailKey         = "detail";
-const String DocumentSymbol::kindKey           = "kind";
-const String DocumentSymbol::deprecatedKey     = "deprecated";
-const String DocumentSymbol::rangeKey          = "range";
-const String DocumentSymbol::selectionRangeKey = "selectionRange";
-const String DocumentSymbol::childrenKey       = "children";
+constexpr string_view DocumentSymbol::nameKey           = "name";
+constexpr string_view DocumentSymbol::detailKey         = "detail";
+constexpr string_view DocumentSymbol::kindKey           = "kind";
+constexpr string_view DocumentSymbol::deprecatedKey     = "deprecated";
+constexpr string_view DocumentSymbol::rangeKey          = "range";
+constexpr string_view DocumentSymbol::selectionRangeKey = "selectionRange";
+constexpr string_view DocumentSymbol::childrenKey       = "children";
 
 DocumentSymbol::DocumentSymbol(String name,
 	optional<String> detail,
@@ -351,7 +387,7 @@ DocumentSymbol::DocumentSymbol(String name,
 	optional<Boolean> deprecated,
 	Range range,
 	Range selectionRange,
-	optional<vector<DocumentSymbol>> children):
+	optional<Vector<DocumentSymbol>> children):
 		name(name),
 		detail(detail),
 		kind(kind),
@@ -410,11 +446,11 @@ void DocumentSymbol::partialWrite(JsonWriter &writer)
 }
 
 
-const String SymbolInformation::nameKey          = "name";
-const String SymbolInformation::kindKey          = "kind";
-const String SymbolInformation::deprecatedKey    = "deprecated";
-const String SymbolInformation::locationKey      = "location";
-const String SymbolInformation::containerNameKey = "containerName";
+constexpr string_view SymbolInformation::nameKey          = "name";
+constexpr string_view SymbolInformation::kindKey          = "kind";
+constexpr string_view SymbolInformation::deprecatedKey    = "deprecated";
+constexpr string_view SymbolInformation::locationKey      = "location";
+constexpr string_view SymbolInformation::containerNameKey = "containerName";
 
 SymbolInformation::SymbolInformation(String name,
 	SymbolKind kind,
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String ExecuteCommandClientCapabilities::
+constexpr string_view ExecuteCommandClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 ExecuteCommandClientCapabilities::
@@ -32,49 +32,62 @@ ExecuteCommandClientCapabilities::
 ExecuteCommandClientCapabilities::ExecuteCommandClientCapabilities(){};
 ExecuteCommandClientCapabilities::~ExecuteCommandClientCapabilities(){};
 
-void ExecuteCommandClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ExecuteCommandClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&ExecuteCommandClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// This
-	initializer.object = this;
+constexpr ObjectDescriptor ExecuteCommandClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void ExecuteCommandClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String ExecuteCommandOptions::commandsKey = "commands";
+constexpr string_view ExecuteCommandOptions::commandsKey = "commands";
 
 ExecuteCommandOptions::ExecuteCommandOptions(optional<Boolean> workDoneProgress,
-	vector<String> commands):
+	Vector<String> commands):
 		WorkDoneProgressOptions(workDoneProgress),
 		commands(commands)
 {};
@@ -98,8 +111,8 @@ void ExecuteCommandOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String ExecuteCommandParams::commandKey   = "command";
-const String ExecuteCommandParams::argumentsKey = "arguments";
+constexpr string_view ExecuteCommandParams::commandKey   = "command";
+constexpr string_view ExecuteCommandParams::argumentsKey = "arguments";
 
 ExecuteCommandParams::ExecuteCommandParams(optional<ProgressToken> workDoneToken,
 	String command,
@@ -112,84 +125,96 @@ ExecuteCommandParams::ExecuteCommandParams(optional<ProgressToken> workDoneToken
 ExecuteCommandParams::ExecuteCommandParams(){};
 ExecuteCommandParams::~ExecuteCommandParams(){};
 
-void ExecuteCommandParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ExecuteCommandParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parent
-	WorkDoneProgressParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// command:
-	setterMap.emplace(
+	{
+		// Key
 		commandKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				command = str;
-				neededMap[commandKey] = true;
-			},
+			MemberSetter<&ExecuteCommandParams::command>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// arguments?:
-	setterMap.emplace(
+	{
+		// Key
 		argumentsKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				arguments.emplace();
+				auto& self = *static_cast<ExecuteCommandParams*>(object);
 
-				handler->pushInitializer();
+				self.arguments.emplace();
 
-				auto* maker = new ArrayMaker(arguments.value());
-
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ArrayMaker>(self.arguments.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor ExecuteCommandParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(commandKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<ExecuteCommandParams, WorkDoneProgressParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void ExecuteCommandParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
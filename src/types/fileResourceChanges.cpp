@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String CreateFileOptions::overwriteKey      = "overwrite";
-const String CreateFileOptions::ignoreIfExistsKey = "ignoreIfExists";
+constexpr string_view CreateFileOptions::overwriteKey      = "overwrite";
+constexpr string_view CreateFileOptions::ignoreIfExistsKey = "ignoreIfExists";
 
 CreateFileOptions::CreateFileOptions(optional<Boolean> overwrite,
 	optional<Boolean> ignoreIfExists):
@@ -53,8 +53,8 @@ void CreateFileOptions::partialWrite(JsonWriter &writer)
 
 const pair<String, String> CreateFile::kind = {"kind", "create"};
 
-const String CreateFile::uriKey     = "uri";
-const String CreateFile::optionsKey = "options";
+constexpr string_view CreateFile::uriKey     = "uri";
+constexpr string_view CreateFile::optionsKey = "options";
 
 CreateFile::CreateFile(DocumentUri uri, optional<CreateFileOptions> options):
 	uri(uri),
@@ -83,8 +83,8 @@ void CreateFile::partialWrite(JsonWriter &writer)
 }
 
 
-const String RenameFileOptions::overwriteKey      = "overwrite";
-const String RenameFileOptions::ignoreIfExistsKey = "ignoreIfExists";
+constexpr string_view RenameFileOptions::overwriteKey      = "overwrite";
+constexpr string_view RenameFileOptions::ignoreIfExistsKey = "ignoreIfExists";
 
 RenameFileOptions::RenameFileOptions(optional<Boolean> overwrite,
 	optional<Boolean> ignoreIfExists):
@@ -115,9 +115,9 @@ void RenameFileOptions::partialWrite(JsonWriter &writer)
 
 const pair<String, String> RenameFile::kind = {"kind", "rename"};
 
-const String RenameFile::oldUriKey  = "oldUri";
-const String RenameFile::newUriKey  = "newUri";
-const String RenameFile::optionsKey = "options";
+constexpr string_view RenameFile::oldUriKey  = "oldUri";
+constexpr string_view RenameFile::newUriKey  = "newUri";
+constexpr string_view RenameFile::optionsKey = "options";
 
 RenameFile::RenameFile(DocumentUri oldUri,
 	DocumentUri newUri,
@@ -153,8 +153,8 @@ void RenameFile::partialWrite(JsonWriter &writer)
 }
 
 
-const String DeleteFileOptions::recursiveKey         = "recursive";
-const String DeleteFileOptions::ignoreIfNotExistsKey = "ignoreIfNotExists";
+constexpr string_view DeleteFileOptions::recursiveKey         = "recursive";
+constexpr string_view DeleteFileOptions::ignoreIfNotExistsKey = "ignoreIfNotExists";
 
 DeleteFileOptions::DeleteFileOptions(optional<Boolean> recursive,
 	optional<Boolean> ignoreIfNotExists):
@@ -185,8 +185,8 @@ void DeleteFileOptions::partialWrite(JsonWriter &writer)
 
 const pair<String, String> DeleteFile::kind = {"kind", "delete"};
 
-const String DeleteFile::uriKey     = "uri";
-const String DeleteFile::optionsKey = "options";
+constexpr string_view DeleteFile::uriKey     = "uri";
+constexpr string_view DeleteFile::optionsKey = "options";
 
 DeleteFile::DeleteFile(DocumentUri uri, optional<DeleteFileOptions> options):
 	uri(uri),
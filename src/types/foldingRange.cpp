@@ -21,13 +21,13 @@ namespace clsp
 
 using namespace std;
 
-const String FoldingRangeClientCapabilities::
+constexpr string_view FoldingRangeClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String FoldingRangeClientCapabilities::
+constexpr string_view FoldingRangeClientCapabilities::
 	rangeLimitKey          = "rangeLimit";
 
-const String FoldingRangeClientCapabilities::
+constexpr string_view FoldingRangeClientCapabilities::
 	lineFoldingOnlyKey     = "lineFoldingOnly";
 
 FoldingRangeClientCapabilities::
@@ -43,96 +43,115 @@ FoldingRangeClientCapabilities::
 FoldingRangeClientCapabilities::FoldingRangeClientCapabilities(){};
 FoldingRangeClientCapabilities::~FoldingRangeClientCapabilities(){};
 
-void FoldingRangeClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor FoldingRangeClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&FoldingRangeClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// rangeLimit?:
-	setterMap.emplace(
+	{
+		// Key
 		rangeLimitKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
-			{
-				rangeLimit = n;
-			},
+			MemberSetter<&FoldingRangeClientCapabilities::rangeLimit>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// lineFoldingOnly?:
-	setterMap.emplace(
+	{
+		// Key
 		lineFoldingOnlyKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				lineFoldingOnly = b;
-			},
+			MemberSetter<&FoldingRangeClientCapabilities::lineFoldingOnly>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor FoldingRangeClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void FoldingRangeClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
@@ -158,7 +177,7 @@ void FoldingRangeRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String FoldingRangeParams::textDocumentKey = "textDocument";
+constexpr string_view FoldingRangeParams::textDocumentKey = "textDocument";
 
 FoldingRangeParams::FoldingRangeParams(optional<ProgressToken> workDoneToken,
 	optional<ProgressToken> partialResultToken,
@@ -171,55 +190,64 @@ FoldingRangeParams::FoldingRangeParams(optional<ProgressToken> workDoneToken,
 FoldingRangeParams::FoldingRangeParams(){};
 FoldingRangeParams::~FoldingRangeParams(){};
 
-void FoldingRangeParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor FoldingRangeParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&FoldingRangeParams::textDocument>::fromObject
+		}
+	}
+};
 
-				textDocument.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor FoldingRangeParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[textDocumentKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<FoldingRangeParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<FoldingRangeParams, PartialResultParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void FoldingRangeParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
@@ -230,16 +258,16 @@ FoldingRangeKind::FoldingRangeKind(String kind):
 FoldingRangeKind::~FoldingRangeKind(){};
 
 
-const FoldingRangeKind FoldingRangeKind::Comment = "comment"s;
-const FoldingRangeKind FoldingRangeKind::Imports = "imports"s;
-const FoldingRangeKind FoldingRangeKind::Region  = "region"s;
+const FoldingRangeKind FoldingRangeKind::Comment = String("comment");
+const FoldingRangeKind FoldingRangeKind::Imports = String("imports");
+const FoldingRangeKind FoldingRangeKind::Region  = String("region");
 
 
-const String FoldingRange::startLineKey      = "startLine";
-const String FoldingRange::startCharacterKey = "startCharacter";
-const String FoldingRange::endLineKey        = "endLine";
-const String FoldingRange::endCharacterKey   = "endCharacter";
-const String FoldingRange::kindKey           = "kind";
+constexpr string_view FoldingRange::startLineKey      = "startLine";
+constexpr string_view FoldingRange::startCharacterKey = "startCharacter";
+constexpr string_view FoldingRange::endLineKey        = "endLine";
+constexpr string_view FoldingRange::endCharacterKey   = "endCharacter";
+constexpr string_view FoldingRange::kindKey           = "kind";
 
 FoldingRange::FoldingRange(Number startLine,
 	optional<Number> startCharacter,
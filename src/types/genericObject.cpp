@@ -23,74 +23,83 @@ using namespace std;
 
 
 
-GenericObject::GenericObject(map<String, Any> children):
+GenericObject::GenericObject(Map<String, Any> children):
 	children(children)
 {};
 
 GenericObject::GenericObject(){};
 GenericObject::~GenericObject(){};
 
-void GenericObject::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor GenericObject::descriptor =
 {
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// Anything
-	extraSetter =
 	{
 		// String
-		[this, handler](String str)
+		[](void* object, JsonHandler& handler, String&& str)
 		{
-			children[handler->lastKey] = str;
+			auto& self = *static_cast<GenericObject*>(object);
+
+			self.children[handler.lastKey] = move(str);
 		},
 
 		// Number
-		[this, handler](Number n)
+		[](void* object, JsonHandler& handler, Number n)
 		{
-			children[handler->lastKey] = n;
+			auto& self = *static_cast<GenericObject*>(object);
+
+			self.children[handler.lastKey] = n;
 		},
 
 		// Boolean
-		[this, handler](Boolean b)
+		[](void* object, JsonHandler& handler, Boolean b)
 		{
-			children[handler->lastKey] = b;
+			auto& self = *static_cast<GenericObject*>(object);
+
+			self.children[handler.lastKey] = b;
 		},
 
 		// Null
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			children[handler->lastKey] = Null();
+			auto& self = *static_cast<GenericObject*>(object);
+
+			self.children[handler.lastKey] = Null();
 		},
 
 		// Array
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& newArray = children.emplace(handler->lastKey, Array()).first->second;
+			auto& self = *static_cast<GenericObject*>(object);
 
-			auto* maker = new ArrayMaker(get<Array>(newArray));
-
-			handler->pushInitializer();
-			maker->fillInitializer(handler->objectStack.top());
+			auto& newArray = self.children.emplace(handler.lastKey, Array()).first->second;
 
+			handler.pushMaker<ArrayMaker>(get<Array>(newArray));
 		},
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto obj = make_shared<GenericObject>();
+			auto& self = *static_cast<GenericObject*>(object);
+
+			auto obj = makeObject<GenericObject>();
 
-			children[handler->lastKey] = obj;
+			self.children[handler.lastKey] = obj;
 
-			handler->pushInitializer();
-			obj->fillInitializer(handler->objectStack.top());
+			handler.pushObject(*obj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void GenericObject::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 ArrayMaker::ArrayMaker(Array& parentArray):
@@ -99,62 +108,69 @@ ArrayMaker::ArrayMaker(Array& parentArray):
 
 ArrayMaker::~ArrayMaker(){};
 
-void ArrayMaker::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor ArrayMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// Almost anything
-	extraSetter =
 	{
 		// String
-		[this](String str)
+		[](void* object, JsonHandler&, String&& str)
 		{
-			parentArray.emplace_back(str);
+			auto& self = *static_cast<ArrayMaker*>(object);
+
+			self.parentArray.emplace_back(move(str));
 		},
 
 		// Number
-		[this](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
-			parentArray.emplace_back(n);
+			auto& self = *static_cast<ArrayMaker*>(object);
+
+			self.parentArray.emplace_back(n);
 		},
 
 		// Boolean
-		[this](Boolean b)
+		[](void* object, JsonHandler&, Boolean b)
 		{
-			parentArray.emplace_back(b);
+			auto& self = *static_cast<ArrayMaker*>(object);
+
+			self.parentArray.emplace_back(b);
 		},
 
 		// Null
-		[this]()
+		[](void* object, JsonHandler&)
 		{
-			parentArray.emplace_back(Null());
+			auto& self = *static_cast<ArrayMaker*>(object);
+
+			self.parentArray.emplace_back(Null());
 		},
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto obj = make_shared<GenericObject>();
+			auto& self = *static_cast<ArrayMaker*>(object);
 
-			parentArray.emplace_back(obj);
+			auto obj = makeObject<GenericObject>();
 
-			handler->pushInitializer();
+			self.parentArray.emplace_back(obj);
 
-			obj->fillInitializer(handler->objectStack.top());
+			handler.pushObject(*obj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void ArrayMaker::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void GenericObject::partialWrite(JsonWriter &writer)
@@ -21,15 +21,15 @@ namespace clsp
 
 using namespace std;
 
-const String HoverClientCapabilities::
+constexpr string_view HoverClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String HoverClientCapabilities::
+constexpr string_view HoverClientCapabilities::
 	contentFormatKey       = "contentFormat";
 
 HoverClientCapabilities::
 	HoverClientCapabilities(optional<Boolean> dynamicRegistration,
-		optional<vector<MarkupKind>> contentFormat):
+		optional<Vector<MarkupKind>> contentFormat):
 			dynamicRegistration(dynamicRegistration),
 			contentFormat(contentFormat)
 {};
@@ -38,81 +38,97 @@ HoverClientCapabilities::HoverClientCapabilities(){};
 HoverClientCapabilities::~HoverClientCapabilities(){};
 
 
-void HoverClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor HoverClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&HoverClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// contentFormat?:
-	setterMap.emplace(
+	{
+		// Key
 		contentFormatKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				contentFormat.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<HoverClientCapabilities*>(object);
 
-				auto* maker = new ContentFormatMaker(contentFormat.value());
+				self.contentFormat.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ContentFormatMaker>(
+					self.contentFormat.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor HoverClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void HoverClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
 HoverClientCapabilities::ContentFormatMaker::
-	ContentFormatMaker(vector<MarkupKind> &parentArray):
+	ContentFormatMaker(Vector<MarkupKind> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -121,43 +137,47 @@ HoverClientCapabilities::ContentFormatMaker::
 {};
 
 
-void HoverClientCapabilities::ContentFormatMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor HoverClientCapabilities::ContentFormatMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// MarkupKind[]
-	extraSetter =
 	{
 		// String
-		[this](String str)
+		[](void* object, JsonHandler&, String&& str)
 		{
-			parentArray.emplace_back(str);
+			auto& self = *static_cast<ContentFormatMaker*>(object);
+
+			self.parentArray.emplace_back(move(str));
 		},
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void HoverClientCapabilities::ContentFormatMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 HoverRegistrationOptions::
@@ -188,19 +208,36 @@ HoverParams::HoverParams(TextDocumentIdentifier textDocument,
 HoverParams::HoverParams(){};
 HoverParams::~HoverParams(){};
 
-void HoverParams::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor HoverParams::descriptor =
 {
+	// Fields
+	nullptr,
+
+	// Extra setter
+	{},
+
 	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<HoverParams, TextDocumentPositionParams>
+		},
 
-	// This
-	initializer.object = this;
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<HoverParams, WorkDoneProgressParams>
+		}
+	}
+};
+
+void HoverParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String _MarkedString::languageKey = "language";
-const String _MarkedString::valueKey    = "value";
+constexpr string_view _MarkedString::languageKey = "language";
+constexpr string_view _MarkedString::valueKey    = "value";
 
 _MarkedString::_MarkedString(String language, String value):
 	language(language),
@@ -225,11 +262,11 @@ void _MarkedString::partialWrite(JsonWriter &writer)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
-const String Hover::contentsKey = "contents";
-const String Hover::rangeKey    = "range";
+constexpr string_view Hover::contentsKey = "contents";
+constexpr string_view Hover::rangeKey    = "range";
 
 Hover::
-	Hover(variant<MarkedString, vector<MarkedString>, MarkupContent> contents,
+	Hover(variant<MarkedString, Vector<MarkedString>, MarkupContent> contents,
 	optional<Range> range):
 		contents(contents),
 		range(range)
@@ -267,7 +304,7 @@ void Hover::partialWrite(JsonWriter &writer)
 		{
 			MarkedStringWriter(writer, obj);
 		},
-		[&writer](vector<MarkedString> &arr)
+		[&writer](Vector<MarkedString> &arr)
 		{
 			writer.StartArray();
 			for(auto& i: arr)
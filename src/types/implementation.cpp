@@ -21,10 +21,10 @@ namespace clsp
 
 using namespace std;
 
-const String ImplementationClientCapabilities::
+constexpr string_view ImplementationClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String ImplementationClientCapabilities::
+constexpr string_view ImplementationClientCapabilities::
 	linkSupportKey         = "linkSupport";
 
 ImplementationClientCapabilities::
@@ -37,69 +37,85 @@ ImplementationClientCapabilities::
 ImplementationClientCapabilities::ImplementationClientCapabilities(){};
 ImplementationClientCapabilities::~ImplementationClientCapabilities(){};
 
-void ImplementationClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ImplementationClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&ImplementationClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// linkSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		linkSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				linkSupport = b;
-			},
+			MemberSetter<&ImplementationClientCapabilities::linkSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor ImplementationClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void ImplementationClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 ImplementationRegistrationOptions::
@@ -136,12 +152,36 @@ ImplementationParams::ImplementationParams(TextDocumentIdentifier textDocument,
 ImplementationParams::ImplementationParams(){};
 ImplementationParams::~ImplementationParams(){};
 
-void ImplementationParams::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor ImplementationParams::descriptor =
 {
+	// Fields
+	nullptr,
+
+	// Extra setter
+	{},
+
 	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<ImplementationParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<ImplementationParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<ImplementationParams, PartialResultParams>
+		}
+	}
+};
+
+void ImplementationParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
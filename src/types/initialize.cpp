@@ -21,70 +21,70 @@ namespace clsp
 
 using namespace std;
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	synchronizationKey    = "synchronization";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	completionKey         = "completion";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	hoverKey              = "hover";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	signatureHelpKey      = "signatureHelp";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	declarationKey        = "declaration";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	definitionKey         = "definition";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	typeDefinitionKey     = "typeDefinition";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	implementationKey     = "implementation";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	referencesKey         = "references";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	documentHighlightKey  = "documentHighlight";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	documentSymbolKey     = "documentSymbol";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	codeActionKey         = "codeAction";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	codeLensKey           = "codeLens";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	documentLinkKey       = "documentLink";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	colorProviderKey      = "colorProvider";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	formattingKey         = "formatting";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	rangeFormattingKey    = "rangeFormatting";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	onTypeFormattingKey   = "onTypeFormatting";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	renameKey             = "rename";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	publishDiagnosticsKey = "publishDiagnostics";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	foldingRangeKey       = "foldingRange";
 
-const String TextDocumentClientCapabilities::
+constexpr string_view TextDocumentClientCapabilities::
 	selectionRangeKey     = "selectionRange";
 
 TextDocumentClientCapabilities::TextDocumentClientCapabilities(
@@ -137,688 +137,696 @@ TextDocumentClientCapabilities::TextDocumentClientCapabilities(
 TextDocumentClientCapabilities::TextDocumentClientCapabilities(){};
 TextDocumentClientCapabilities::~TextDocumentClientCapabilities(){};
 
-void TextDocumentClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TextDocumentClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// synchronization?:
-	setterMap.emplace(
+	{
+		// Key
 		synchronizationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				synchronization.emplace();
-
-				handler->pushInitializer();
-				synchronization->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::synchronization>::fromObject
 		}
-	);
+	},
 
 	// completion?:
-	setterMap.emplace(
+	{
+		// Key
 		completionKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				completion.emplace();
-
-				handler->pushInitializer();
-				completion->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::completion>::fromObject
 		}
-	);
+	},
 
 	// hover?:
-	setterMap.emplace(
+	{
+		// Key
 		hoverKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				hover.emplace();
-
-				handler->pushInitializer();
-				hover->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::hover>::fromObject
 		}
-	);
+	},
 
 	// signatureHelp?:
-	setterMap.emplace(
+	{
+		// Key
 		signatureHelpKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				signatureHelp.emplace();
-
-				handler->pushInitializer();
-				signatureHelp->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::signatureHelp>::fromObject
 		}
-	);
+	},
 
 	// declaration?:
-	setterMap.emplace(
+	{
+		// Key
 		declarationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				declaration.emplace();
-
-				handler->pushInitializer();
-				declaration->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::declaration>::fromObject
 		}
-	);
+	},
 
 	// definition?:
-	setterMap.emplace(
+	{
+		// Key
 		definitionKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				definition.emplace();
-
-				handler->pushInitializer();
-				definition->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::definition>::fromObject
 		}
-	);
+	},
 
 	// typeDefinition?:
-	setterMap.emplace(
+	{
+		// Key
 		typeDefinitionKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				typeDefinition.emplace();
-
-				handler->pushInitializer();
-				typeDefinition->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::typeDefinition>::fromObject
 		}
-	);
+	},
 
 	// implementation?:
-	setterMap.emplace(
+	{
+		// Key
 		implementationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				implementation.emplace();
-
-				handler->pushInitializer();
-				implementation->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::implementation>::fromObject
 		}
-	);
+	},
 
 	// references?:
-	setterMap.emplace(
+	{
+		// Key
 		referencesKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				references.emplace();
-
-				handler->pushInitializer();
-				references->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::references>::fromObject
 		}
-	);
+	},
 
 	// documentHighlight?:
-	setterMap.emplace(
+	{
+		// Key
 		documentHighlightKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				documentHighlight.emplace();
-
-				handler->pushInitializer();
-				documentHighlight->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::documentHighlight>::fromObject
 		}
-	);
+	},
 
 	// documentSymbol?:
-	setterMap.emplace(
+	{
+		// Key
 		documentSymbolKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				documentSymbol.emplace();
-
-				handler->pushInitializer();
-				documentSymbol->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::documentSymbol>::fromObject
 		}
-	);
+	},
 
 	// codeAction?:
-	setterMap.emplace(
+	{
+		// Key
 		codeActionKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				codeAction.emplace();
-
-				handler->pushInitializer();
-				codeAction->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::codeAction>::fromObject
 		}
-	);
+	},
 
 	// codeLens?:
-	setterMap.emplace(
+	{
+		// Key
 		codeLensKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				codeLens.emplace();
-
-				handler->pushInitializer();
-				codeLens->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::codeLens>::fromObject
 		}
-	);
+	},
 
 	// documentLink?:
-	setterMap.emplace(
+	{
+		// Key
 		documentLinkKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				documentLink.emplace();
-
-				handler->pushInitializer();
-				documentLink->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::documentLink>::fromObject
 		}
-	);
+	},
 
 	// colorProvider?:
-	setterMap.emplace(
+	{
+		// Key
 		colorProviderKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				colorProvider.emplace();
-
-				handler->pushInitializer();
-				colorProvider->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::colorProvider>::fromObject
 		}
-	);
+	},
 
 	// formatting?:
-	setterMap.emplace(
+	{
+		// Key
 		formattingKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				formatting.emplace();
-
-				handler->pushInitializer();
-				formatting->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::formatting>::fromObject
 		}
-	);
+	},
 
 	// rangeFormatting?:
-	setterMap.emplace(
+	{
+		// Key
 		rangeFormattingKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				rangeFormatting.emplace();
-
-				handler->pushInitializer();
-				rangeFormatting->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::rangeFormatting>::fromObject
 		}
-	);
+	},
 
 	// onTypeFormatting?:
-	setterMap.emplace(
+	{
+		// Key
 		onTypeFormattingKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				onTypeFormatting.emplace();
-
-				handler->pushInitializer();
-				onTypeFormatting->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::onTypeFormatting>::fromObject
 		}
-	);
+	},
 
 	// rename?:
-	setterMap.emplace(
+	{
+		// Key
 		renameKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				rename.emplace();
-
-				handler->pushInitializer();
-				rename->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::rename>::fromObject
 		}
-	);
+	},
 
 	// publishDiagnostics?:
-	setterMap.emplace(
+	{
+		// Key
 		publishDiagnosticsKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				publishDiagnostics.emplace();
-
-				handler->pushInitializer();
-				publishDiagnostics->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::publishDiagnostics>::fromObject
 		}
-	);
+	},
 
 	// foldingRange?:
-	setterMap.emplace(
+	{
+		// Key
 		foldingRangeKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				foldingRange.emplace();
-
-				handler->pushInitializer();
-				foldingRange->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::foldingRange>::fromObject
 		}
-	);
+	},
 
 	// selectionRange?:
-	setterMap.emplace(
+	{
+		// Key
 		selectionRangeKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				selectionRange.emplace();
-
-				handler->pushInitializer();
-				selectionRange->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&TextDocumentClientCapabilities::selectionRange>::fromObject
 		}
-	);
+	}
+};
 
-	// This
-	initializer.object = this;
+constexpr ObjectDescriptor TextDocumentClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void TextDocumentClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String ClientCapabilities::workspaceKey    = "workspace";
-const String ClientCapabilities::textDocumentKey = "textDocument";
-const String ClientCapabilities::experimentalKey = "experimental";
+constexpr string_view ClientCapabilities::workspaceKey    = "workspace";
+constexpr string_view ClientCapabilities::textDocumentKey = "textDocument";
+constexpr string_view ClientCapabilities::experimentalKey = "experimental";
 
 ClientCapabilities::ClientCapabilities(optional<Workspace> workspace,
 	optional<TextDocumentClientCapabilities> textDocument,
 	optional<Any> experimental,
-	map<Key, Any> extra):
+	Map<Key, Any> extra):
 		workspace(workspace),
 		textDocument(textDocument),
 		experimental(experimental),
@@ -828,204 +836,208 @@ ClientCapabilities::ClientCapabilities(optional<Workspace> workspace,
 ClientCapabilities::ClientCapabilities(){};
 ClientCapabilities::~ClientCapabilities(){};
 
-void ClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// workspace?:
-	setterMap.emplace(
+	{
+		// Key
 		workspaceKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				workspace.emplace();
-
-				handler->pushInitializer();
-				workspace->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&ClientCapabilities::workspace>::fromObject
 		}
-	);
+	},
 
 	// textDocument?:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				textDocument.emplace();
-
-				handler->pushInitializer();
-				textDocument->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&ClientCapabilities::textDocument>::fromObject
 		}
-	);
+	},
 
 	// experimental?:
-	setterMap.emplace(
+	{
+		// Key
 		experimentalKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				experimental = str;
-			},
+			MemberSetter<&ClientCapabilities::experimental>::fromString,
 
 			// Number
-			[this](Number n)
-			{
-				experimental = n;
-			},
+			MemberSetter<&ClientCapabilities::experimental>::fromNumber,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				experimental = b;
-			},
+			MemberSetter<&ClientCapabilities::experimental>::fromBoolean,
 
 			// Null
-			[this]()
-			{
-				experimental = Null();
-			},
+			MemberSetter<&ClientCapabilities::experimental>::fromNull,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& arr = experimental.emplace().emplace<Array>();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<ClientCapabilities*>(object);
 
-				auto* maker = new ArrayMaker(arr);
+				auto& arr = self.experimental.emplace().emplace<Array>();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ArrayMaker>(arr);
 			},
 
 			// Object
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& obj = experimental.emplace().
-					emplace<Object>(make_shared<GenericObject>());
+				auto& self = *static_cast<ClientCapabilities*>(object);
 
-				handler->pushInitializer();
-				obj->fillInitializer(handler->objectStack.top());
+				auto& obj = self.experimental.emplace().
+					emplace<Object>(makeObject<GenericObject>());
+
+				handler.pushObject(*obj);
 			}
 		}
-	);
+	}
+};
 
+constexpr ObjectDescriptor ClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
 	// Extra
-	extraSetter =
 	{
 		// String
-		[this, handler](String str)
+		[](void* object, JsonHandler& handler, String&& str)
 		{
-			extra.emplace(handler->lastKey, str);
+			auto& self = *static_cast<ClientCapabilities*>(object);
+
+			self.extra.emplace(handler.lastKey, move(str));
 		},
 
 		// Number
-		[this, handler](Number n)
+		[](void* object, JsonHandler& handler, Number n)
 		{
-			extra.emplace(handler->lastKey, n);
+			auto& self = *static_cast<ClientCapabilities*>(object);
+
+			self.extra.emplace(handler.lastKey, n);
 		},
 
 		// Boolean
-		[this, handler](Boolean b)
+		[](void* object, JsonHandler& handler, Boolean b)
 		{
-			extra.emplace(handler->lastKey, b);
+			auto& self = *static_cast<ClientCapabilities*>(object);
+
+			self.extra.emplace(handler.lastKey, b);
 		},
 
 		// Null
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			extra.emplace(handler->lastKey, Null());
+			auto& self = *static_cast<ClientCapabilities*>(object);
+
+			self.extra.emplace(handler.lastKey, Null());
 		},
 
 		// Array
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& arr = get<Array>(
-				extra.emplace(handler->lastKey, Array()).first->second);
-
-			handler->pushInitializer();
+			auto& self = *static_cast<ClientCapabilities*>(object);
 
-			auto* maker = new ArrayMaker(arr);
+			auto& arr = get<Array>(
+				self.extra.emplace(handler.lastKey, Array()).first->second);
 
-			maker->fillInitializer(handler->objectStack.top());
+			handler.pushMaker<ArrayMaker>(arr);
 		},
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& obj = get<Object>(extra.emplace(
-				handler->lastKey, make_shared<GenericObject>()).first->second);
+			auto& self = *static_cast<ClientCapabilities*>(object);
 
-			handler->pushInitializer();
-			obj->fillInitializer(handler->objectStack.top());
+			auto& obj = get<Object>(self.extra.emplace(
+				handler.lastKey, makeObject<GenericObject>()).first->second);
+
+			handler.pushObject(*obj);
 		}
-	};
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void ClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String ClientCapabilities::Workspace::
+constexpr string_view ClientCapabilities::Workspace::
 	applyEditKey              = "applyEdit";
 
-const String ClientCapabilities::Workspace::
+constexpr string_view ClientCapabilities::Workspace::
 	workspaceEditKey          = "workspaceEdit";
 
-const String ClientCapabilities::Workspace::
+constexpr string_view ClientCapabilities::Workspace::
 	didChangeConfigurationKey = "didChangeConfiguration";
 
-const String ClientCapabilities::Workspace::
+constexpr string_view ClientCapabilities::Workspace::
 	didChangeWatchedFilesKey  = "didChangeWatchedFiles";
 
-const String ClientCapabilities::Workspace::
+constexpr string_view ClientCapabilities::Workspace::
 	symbolKey                 = "symbol";
 
-const String ClientCapabilities::Workspace::
+constexpr string_view ClientCapabilities::Workspace::
 	executeCommandKey         = "executeCommand";
 
-const String ClientCapabilities::Workspace::
+constexpr string_view ClientCapabilities::Workspace::
 	workspaceFoldersKey       = "workspaceFolders";
 
-const String ClientCapabilities::Workspace::
+constexpr string_view ClientCapabilities::Workspace::
 	configurationKey          = "configuration";
 
 ClientCapabilities::Workspace::Workspace(optional<Boolean> applyEdit,
@@ -1049,248 +1061,265 @@ ClientCapabilities::Workspace::Workspace(optional<Boolean> applyEdit,
 ClientCapabilities::Workspace::Workspace(){};
 ClientCapabilities::Workspace::~Workspace(){};
 
-void ClientCapabilities::Workspace::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ClientCapabilities::Workspace::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// applyEdit?:
-	setterMap.emplace(
+	{
+		// Key
 		applyEditKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				applyEdit = b;
-			},
+			MemberSetter<&Workspace::applyEdit>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// workspaceEdit?:
-	setterMap.emplace(
+	{
+		// Key
 		workspaceEditKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				workspaceEdit.emplace();
-
-				handler->pushInitializer();
-				workspaceEdit->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&Workspace::workspaceEdit>::fromObject
 		}
-	);
+	},
 
 	// didChangeConfiguration?:
-	setterMap.emplace(
+	{
+		// Key
 		didChangeConfigurationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				didChangeConfiguration.emplace();
-
-				handler->pushInitializer();
-				didChangeConfiguration->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&Workspace::didChangeConfiguration>::fromObject
 		}
-	);
+	},
 
 	// didChangeWatchedFiles?:
-	setterMap.emplace(
+	{
+		// Key
 		didChangeWatchedFilesKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				didChangeWatchedFiles.emplace();
-
-				handler->pushInitializer();
-				didChangeWatchedFiles->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&Workspace::didChangeWatchedFiles>::fromObject
 		}
-	);
+	},
 
 	// symbol?:
-	setterMap.emplace(
+	{
+		// Key
 		symbolKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				symbol.emplace();
-
-				handler->pushInitializer();
-				symbol->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&Workspace::symbol>::fromObject
 		}
-	);
+	},
 
 	// executeCommand?:
-	setterMap.emplace(
+	{
+		// Key
 		executeCommandKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				executeCommand.emplace();
-
-				handler->pushInitializer();
-				executeCommand->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&Workspace::executeCommand>::fromObject
 		}
-	);
+	},
 
 	// workspaceFolders?:
-	setterMap.emplace(
+	{
+		// Key
 		workspaceFoldersKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				workspaceFolders = b;
-			},
+			MemberSetter<&Workspace::workspaceFolders>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// configuration?:
-	setterMap.emplace(
+	{
+		// Key
 		configurationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				configuration = b;
-			},
+			MemberSetter<&Workspace::configuration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor ClientCapabilities::Workspace::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void ClientCapabilities::Workspace::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
@@ -1328,14 +1357,14 @@ const TraceKind TraceKind::Messages = _TraceKind::Messages;
 const TraceKind TraceKind::Verbose  = _TraceKind::Verbose;
 
 
-const String InitializeParams::processIdKey             = "processId";
-const String InitializeParams::clientInfoKey            = "clientInfo";
-const String InitializeParams::rootPathKey              = "rootPath";
-const String InitializeParams::rootUriKey               = "rootUri";
-const String InitializeParams::initializationOptionsKey = "initializationOptions";
-const String InitializeParams::capabilitiesKey          = "capabilities";
-const String InitializeParams::traceKey                 = "trace";
-const String InitializeParams::workspaceFoldersKey      = "workspaceFolders";
+constexpr string_view InitializeParams::processIdKey             = "processId";
+constexpr string_view InitializeParams::clientInfoKey            = "clientInfo";
+constexpr string_view InitializeParams::rootPathKey              = "rootPath";
+constexpr string_view InitializeParams::rootUriKey               = "rootUri";
+constexpr string_view InitializeParams::initializationOptionsKey = "initializationOptions";
+constexpr string_view InitializeParams::capabilitiesKey          = "capabilities";
+constexpr string_view InitializeParams::traceKey                 = "trace";
+constexpr string_view InitializeParams::workspaceFoldersKey      = "workspaceFolders";
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -1348,7 +1377,7 @@ InitializeParams::InitializeParams(optional<ProgressToken> workDoneToken,
 	optional<Any> initializationOptions,
 	ClientCapabilities capabilities,
 	optional<TraceKind> trace,
-	optional<variant<vector<WorkspaceFolder>, Null>> workspaceFolders):
+	optional<variant<Vector<WorkspaceFolder>, Null>> workspaceFolders):
 		WorkDoneProgressParams(workDoneToken),
 		processId(processId),
 		clientInfo(clientInfo),
@@ -1367,7 +1396,7 @@ InitializeParams::InitializeParams(optional<ProgressToken> workDoneToken,
 	optional<Any> initializationOptions,
 	ClientCapabilities capabilities,
 	optional<TraceKind> trace,
-	optional<variant<vector<WorkspaceFolder>, Null>> workspaceFolders):
+	optional<variant<Vector<WorkspaceFolder>, Null>> workspaceFolders):
 		WorkDoneProgressParams(workDoneToken),
 		processId(processId),
 		clientInfo(clientInfo),
@@ -1381,300 +1410,302 @@ InitializeParams::InitializeParams(optional<ProgressToken> workDoneToken,
 InitializeParams::InitializeParams(){};
 InitializeParams::~InitializeParams(){};
 
-void InitializeParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor InitializeParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parent
-	WorkDoneProgressParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// processId:
-	setterMap.emplace(
+	{
+		// Key
 		processIdKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				processId = n;
-				neededMap[processIdKey] = true;
-			},
+			MemberSetter<&InitializeParams::processId>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			[this, &neededMap]()
-			{
-				processId = Null();
-				neededMap[processIdKey] = true;
-			},
+			MemberSetter<&InitializeParams::processId>::fromNull,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// clientInfo?:
-	setterMap.emplace(
+	{
+		// Key
 		clientInfoKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				clientInfo.emplace();
-
-				handler->pushInitializer();
-				clientInfo->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&InitializeParams::clientInfo>::fromObject
 		}
-	);
+	},
 
 	// rootPath?:
-	setterMap.emplace(
+	{
+		// Key
 		rootPathKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				rootPath = str;
-			},
+			MemberSetter<&InitializeParams::rootPath>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			[this]()
-			{
-				rootPath = Null();
-			},
+			MemberSetter<&InitializeParams::rootPath>::fromNull,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// rootUri:
-	setterMap.emplace(
+	{
+		// Key
 		rootUriKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				rootUri = str;
-				neededMap[rootUriKey] = true;
-			},
+			MemberSetter<&InitializeParams::rootUri>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			[this, &neededMap]()
-			{
-				rootUri = Null();
-				neededMap[rootUriKey] = true;
-			},
+			MemberSetter<&InitializeParams::rootUri>::fromNull,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// initializationOptions?:
-	setterMap.emplace(
+	{
+		// Key
 		initializationOptionsKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				initializationOptions = str;
-			},
+			MemberSetter<&InitializeParams::initializationOptions>::fromString,
 
 			// Number
-			[this](Number n)
-			{
-				initializationOptions = n;
-			},
+			MemberSetter<&InitializeParams::initializationOptions>::fromNumber,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				initializationOptions = b;
-			},
+			MemberSetter<&InitializeParams::initializationOptions>::fromBoolean,
 
 			// Null
-			[this]()
-			{
-				initializationOptions = Null();
-			},
+			MemberSetter<&InitializeParams::initializationOptions>::fromNull,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& arr = initializationOptions.emplace().emplace<Array>();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<InitializeParams*>(object);
 
-				auto* maker = new ArrayMaker(arr);
+				auto& arr = self.initializationOptions.emplace().emplace<Array>();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ArrayMaker>(arr);
 			},
 
 			// Object
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& obj = initializationOptions.emplace().
-					emplace<Object>(make_shared<GenericObject>());
+				auto& self = *static_cast<InitializeParams*>(object);
 
-				handler->pushInitializer();
-				obj->fillInitializer(handler->objectStack.top());
+				auto& obj = self.initializationOptions.emplace().
+					emplace<Object>(makeObject<GenericObject>());
+
+				handler.pushObject(*obj);
 			}
 		}
-	);
+	},
 
 	// capabilities:
-	setterMap.emplace(
+	{
+		// Key
 		capabilitiesKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				capabilities.fillInitializer(handler->objectStack.top());
-
-				neededMap[capabilitiesKey] = true;
-			}
+			MemberSetter<&InitializeParams::capabilities>::fromObject
 		}
-	);
+	},
 
 	// trace?:
-	setterMap.emplace(
+	{
+		// Key
 		traceKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
+			[](void* object, JsonHandler&, String&& str)
 			{
-				trace = TraceKind(str);
+				auto& self = *static_cast<InitializeParams*>(object);
+
+				self.trace = TraceKind(str);
 			},
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// workspaceFolders?:
-	setterMap.emplace(
+	{
+		// Key
 		workspaceFoldersKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			[this]()
-			{
-				workspaceFolders = Null();
-			},
+			MemberSetter<&InitializeParams::workspaceFolders>::fromNull,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& arr = workspaceFolders.emplace().emplace<vector<WorkspaceFolder>>();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<InitializeParams*>(object);
 
-				auto* maker = new WorkspaceFoldersMaker(arr);
+				auto& arr = self.workspaceFolders.emplace().emplace<Vector<WorkspaceFolder>>();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<WorkspaceFoldersMaker>(arr);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(processIdKey, 0);
-	neededMap.emplace(rootUriKey, 0);
-	neededMap.emplace(capabilitiesKey, 0);
+constexpr ObjectDescriptor InitializeParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<InitializeParams, WorkDoneProgressParams>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void InitializeParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 #pragma GCC diagnostic pop
 
 InitializeParams::WorkspaceFoldersMaker::
-	WorkspaceFoldersMaker(vector<WorkspaceFolder> &parentArray):
+	WorkspaceFoldersMaker(Vector<WorkspaceFolder> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -1682,53 +1713,53 @@ InitializeParams::WorkspaceFoldersMaker::
 	~WorkspaceFoldersMaker()
 {};
 
-void InitializeParams::WorkspaceFoldersMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor InitializeParams::WorkspaceFoldersMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// WorkspaceFolder[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& obj = parentArray.emplace_back();
+			auto& self = *static_cast<WorkspaceFoldersMaker*>(object);
+
+			auto& obj = self.parentArray.emplace_back();
 
-			handler->pushInitializer();
-			obj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(obj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void InitializeParams::WorkspaceFoldersMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String InitializeParams::ClientInfo::nameKey    = "name";
-const String InitializeParams::ClientInfo::versionKey = "version";
+constexpr string_view InitializeParams::ClientInfo::nameKey    = "name";
+constexpr string_view InitializeParams::ClientInfo::versionKey = "version";
 
 InitializeParams::ClientInfo::ClientInfo(String name, optional<String> version):
 	name(name),
@@ -1738,149 +1769,160 @@ InitializeParams::ClientInfo::ClientInfo(String name, optional<String> version):
 InitializeParams::ClientInfo::ClientInfo(){};
 InitializeParams::ClientInfo::~ClientInfo(){};
 
-void InitializeParams::ClientInfo::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor InitializeParams::ClientInfo::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// name:
-	setterMap.emplace(
+	{
+		// Key
 		nameKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				name = str;
-				neededMap[nameKey] = true;
-			},
+			MemberSetter<&ClientInfo::name>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// version?:
-	setterMap.emplace(
+	{
+		// Key
 		versionKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				version = str;
-			},
+			MemberSetter<&ClientInfo::version>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(nameKey, 0);
+constexpr ObjectDescriptor InitializeParams::ClientInfo::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void InitializeParams::ClientInfo::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	textDocumentSyncKey                 = "textDocumentSync";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	completionProviderKey               = "completionProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	hoverProviderKey                    = "hoverProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	signatureHelpProviderKey            = "signatureHelpProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	declarationProviderKey              = "declarationProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	definitionProviderKey               = "definitionProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	typeDefinitionProviderKey           = "typeDefinitionProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	implementationProviderKey           = "implementationProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	referencesProviderKey               = "referencesProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	documentHighlightProviderKey        = "documentHighlightProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	documentSymbolProviderKey           = "documentSymbolProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	codeActionProviderKey               = "codeActionProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	codeLensProviderKey                 = "codeLensProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	documentLinkProviderKey             = "documentLinkProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	colorProviderKey                    = "colorProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	documentFormattingProviderKey       = "documentFormattingProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	documentRangeFormattingProviderKey  = "documentRangeFormattingProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	documentOnTypeFormattingProviderKey = "documentOnTypeFormattingProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	renameProviderKey                   = "renameProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	foldingRangeProviderKey             = "foldingRangeProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	executeCommandProviderKey           = "executeCommandProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	selectionRangeProviderKey           = "selectionRangeProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	workspaceSymbolProviderKey          = "workspaceSymbolProvider";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	workspaceKey                        = "workspace";
 
-const String ServerCapabilities::
+constexpr string_view ServerCapabilities::
 	experimentalKey                     = "experimental";
 
 ServerCapabilities::ServerCapabilities(
@@ -2301,7 +2343,7 @@ void ServerCapabilities::partialWrite(JsonWriter &writer)
 }
 
 
-const String ServerCapabilities::Workspace::
+constexpr string_view ServerCapabilities::Workspace::
 	workspaceFoldersKey = "workspaceFolders";
 
 ServerCapabilities::Workspace::
@@ -2327,8 +2369,8 @@ InitializedParams::InitializedParams(){};
 InitializedParams::~InitializedParams(){};
 
 
-const String InitializeResult::capabilitiesKey = "capabilities";
-const String InitializeResult::serverInfoKey   = "serverInfo";
+constexpr string_view InitializeResult::capabilitiesKey = "capabilities";
+constexpr string_view InitializeResult::serverInfoKey   = "serverInfo";
 
 InitializeResult::InitializeResult(ServerCapabilities capabilities,
 	optional<ServerInfo> serverInfo):
@@ -2354,8 +2396,8 @@ void InitializeResult::partialWrite(JsonWriter &writer)
 }
 
 
-const String InitializeResult::ServerInfo::nameKey    = "name";
-const String InitializeResult::ServerInfo::versionKey = "version";
+constexpr string_view InitializeResult::ServerInfo::nameKey    = "name";
+constexpr string_view InitializeResult::ServerInfo::versionKey = "version";
 
 InitializeResult::ServerInfo::
 	ServerInfo(String name, optional<String> version):
@@ -2381,7 +2423,7 @@ void InitializeResult::ServerInfo::partialWrite(JsonWriter &writer)
 }
 
 
-const String InitializeError::retryKey = "retry";
+constexpr string_view InitializeError::retryKey = "retry";
 
 InitializeError::InitializeError(Boolean retry):
 	retry(retry)
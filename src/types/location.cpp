@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String Location::uriKey   = "uri";
-const String Location::rangeKey = "range";
+constexpr string_view Location::uriKey   = "uri";
+constexpr string_view Location::rangeKey = "range";
 
 Location::Location(DocumentUri uri, Range range):
 	uri(uri),
@@ -32,81 +32,84 @@ Location::Location(DocumentUri uri, Range range):
 Location::Location(){};
 Location::~Location(){};
 
-void Location::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor Location::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// uri:
-	setterMap.emplace(
+	{
+		// Key
 		uriKey,
-		ValueSetter{
-			// String
-			[this, &neededMap](String str)
-			{
-				uri = str;
 
-				neededMap[uriKey] = true;
-			},
+		// Required
+		true,
+
+		// Setter
+		{
+			// String
+			MemberSetter<&Location::uri>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// range:
-	setterMap.emplace(
+	{
+		// Key
 		rangeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&Location::range>::fromObject
+		}
+	}
+};
 
-				range.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor Location::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[rangeKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(uriKey, 0);
-	neededMap.emplace(rangeKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void Location::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void Location::partialWrite(JsonWriter &writer)
@@ -19,10 +19,10 @@
 namespace clsp
 {
 
-const String LocationLink::originSelectionRangeKey = "originSelectionRange";
-const String LocationLink::targetUriKey            = "targetUri";
-const String LocationLink::targetRangeKey          = "targetRange";
-const String LocationLink::targetSelectionRangeKey = "targetSelectionRange";
+constexpr string_view LocationLink::originSelectionRangeKey = "originSelectionRange";
+constexpr string_view LocationLink::targetUriKey            = "targetUri";
+constexpr string_view LocationLink::targetRangeKey          = "targetRange";
+constexpr string_view LocationLink::targetSelectionRangeKey = "targetSelectionRange";
 
 LocationLink::LocationLink(optional<Range> originSelectionRange,
 	DocumentUri targetUri,
@@ -38,145 +38,144 @@ LocationLink::LocationLink(){};
 LocationLink::~LocationLink(){};
 
 
-void LocationLink::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor LocationLink::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// originSelectionRange?:
-	setterMap.emplace(
+	{
+		// Key
 		originSelectionRangeKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				handler->pushInitializer();
-
-				originSelectionRange.emplace();
-				originSelectionRange.value().
-					fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&LocationLink::originSelectionRange>::fromObject
 		}
-	);
+	},
 
 	// targetUri:
-	setterMap.emplace(
+	{
+		// Key
 		targetUriKey,
-		ValueSetter{
-			// String
-			[this, &neededMap](String str)
-			{
-				targetUri = str;
 
-				neededMap[targetUriKey] = true;
-			},
+		// Required
+		true,
+
+		// Setter
+		{
+			// String
+			MemberSetter<&LocationLink::targetUri>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// targetRange:
-	setterMap.emplace(
+	{
+		// Key
 		targetRangeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				targetRange.fillInitializer(handler->objectStack.top());
-
-				neededMap[targetRangeKey] = true;
-			}
+			MemberSetter<&LocationLink::targetRange>::fromObject
 		}
-	);
+	},
 
 	// targetSelectionRange:
-	setterMap.emplace(
+	{
+		// Key
 		targetSelectionRangeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&LocationLink::targetSelectionRange>::fromObject
+		}
+	}
+};
 
-				targetSelectionRange.
-					fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor LocationLink::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[targetSelectionRangeKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(targetUriKey, 0);
-	neededMap.emplace(targetRangeKey, 0);
-	neededMap.emplace(targetSelectionRangeKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void LocationLink::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void LocationLink::partialWrite(JsonWriter &writer)
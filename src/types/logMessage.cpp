@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String LogMessageParams::typeKey    = "type";
-const String LogMessageParams::messageKey = "message";
+constexpr string_view LogMessageParams::typeKey    = "type";
+constexpr string_view LogMessageParams::messageKey = "message";
 
 LogMessageParams::LogMessageParams(MessageType type, String message):
 	type(type),
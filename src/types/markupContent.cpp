@@ -55,8 +55,8 @@ const MarkupKind MarkupKind::PlainText = _MarkupKind::PlainText;
 const MarkupKind MarkupKind::Markdown  = _MarkupKind::Markdown;
 
 
-const String MarkupContent::kindKey  = "kind";
-const String MarkupContent::valueKey = "value";
+constexpr string_view MarkupContent::kindKey  = "kind";
+constexpr string_view MarkupContent::valueKey = "value";
 
 
 MarkupContent::MarkupContent(MarkupKind kind, String value):
@@ -67,75 +67,84 @@ MarkupContent::MarkupContent(MarkupKind kind, String value):
 MarkupContent::MarkupContent(){};
 MarkupContent::~MarkupContent(){};
 
-void MarkupContent::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor MarkupContent::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// kind:
-	setterMap.emplace(
+	{
+		// Key
 		kindKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				kind = str;
-				neededMap[kindKey] = true;
-			},
+			MemberSetter<&MarkupContent::kind>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// value:
-	setterMap.emplace(
+	{
+		// Key
 		valueKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				value = str;
-				neededMap[valueKey] = true;
-			},
+			MemberSetter<&MarkupContent::value>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor MarkupContent::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(kindKey, 0);
-	neededMap.emplace(valueKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void MarkupContent::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void MarkupContent::partialWrite(JsonWriter &writer)
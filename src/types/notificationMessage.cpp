@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String NotificationMessage::methodKey = "method";
-const String NotificationMessage::paramsKey = "params";
+constexpr string_view NotificationMessage::methodKey = "method";
+constexpr string_view NotificationMessage::paramsKey = "params";
 
 NotificationMessage::NotificationMessage(Server& server,
 	String method,
@@ -50,8 +50,8 @@ void NotificationMessage::partialWrite(JsonWriter &writer)
 	// params?
 	if(params.has_value())
 	{
-		optional<Capability> capability = server.getCapability(method);
-		if(capability.has_value())
+		const Capability* capability = server.getCapability(method);
+		if(capability != nullptr)
 		{
 			writer.Key(paramsKey);
 			capability->params.writer.value()(writer, *params);
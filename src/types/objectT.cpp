@@ -36,18 +36,8 @@ void ObjectT::write(JsonWriter& writer)
 
 bool ObjectT::isValid(JsonHandler& handler)
 {
-	auto& neededMap = handler.objectStack.top().neededMap;
-
-	for(const auto &initializedPair: neededMap)
-	{
-		// If a needed value is left uninitialized
-		if(!initializedPair.second)
-		{
-			return false;
-		}
-	}
-
-	return true;
+	// No needed value is left uninitialized
+	return handler.objectStack.top().neededMask == 0;
 }
 
 ObjectT::ObjectT(){};
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String PartialResultParams::partialResultTokenKey = "partialResultToken";
+constexpr string_view PartialResultParams::partialResultTokenKey = "partialResultToken";
 
 PartialResultParams::
 	PartialResultParams(optional<ProgressToken> partialResultToken):
@@ -31,44 +31,54 @@ PartialResultParams::
 PartialResultParams::PartialResultParams(){};
 PartialResultParams::~PartialResultParams(){};
 
-void PartialResultParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor PartialResultParams::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// partialResultToken?:
-	setterMap.emplace(
+	{
+		// Key
 		partialResultTokenKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				partialResultToken = str;
-			},
+			MemberSetter<&PartialResultParams::partialResultToken>::fromString,
 
 			// Number
-			[this](Number n)
-			{
-				partialResultToken = n;
-			},
+			MemberSetter<&PartialResultParams::partialResultToken>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor PartialResultParams::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void PartialResultParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void PartialResultParams::partialWrite(JsonWriter &writer)
@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String Position::lineKey      = "line";
-const String Position::characterKey = "character";
+constexpr string_view Position::lineKey      = "line";
+constexpr string_view Position::characterKey = "character";
 
 
 Position::Position(Number line, Number character):
@@ -33,75 +33,84 @@ Position::Position(Number line, Number character):
 Position::Position(){};
 Position::~Position(){};
 
-void Position::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor Position::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// line:
-	setterMap.emplace(
+	{
+		// Key
 		lineKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				line = n;
-				neededMap[lineKey] = true;
-			},
+			MemberSetter<&Position::line>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// character:
-	setterMap.emplace(
+	{
+		// Key
 		characterKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				character = n;
-				neededMap[characterKey] = true;
-			},
+			MemberSetter<&Position::character>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor Position::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(lineKey, 0);
-	neededMap.emplace(characterKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void Position::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void Position::partialWrite(JsonWriter &writer)
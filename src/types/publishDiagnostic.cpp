@@ -21,13 +21,13 @@ namespace clsp
 
 using namespace std;
 
-const String PublishDiagnosticsClientCapabilities::
+constexpr string_view PublishDiagnosticsClientCapabilities::
 	relatedInformationKey = "relatedInformation";
 
-const String PublishDiagnosticsClientCapabilities::
+constexpr string_view PublishDiagnosticsClientCapabilities::
 	tagSupportKey         = "tagSupport";
 
-const String PublishDiagnosticsClientCapabilities::
+constexpr string_view PublishDiagnosticsClientCapabilities::
 	versionSupportKey     = "versionSupport";
 
 PublishDiagnosticsClientCapabilities::
@@ -45,165 +45,188 @@ PublishDiagnosticsClientCapabilities::
 	~PublishDiagnosticsClientCapabilities()
 {};
 
-void PublishDiagnosticsClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor PublishDiagnosticsClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// relatedInformation?:
-	setterMap.emplace(
+	{
+		// Key
 		relatedInformationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				relatedInformation = b;
-			},
+			MemberSetter<&PublishDiagnosticsClientCapabilities::relatedInformation>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// tagSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		tagSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				tagSupport.emplace();
-
-				handler->pushInitializer();
-				tagSupport->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&PublishDiagnosticsClientCapabilities::tagSupport>::fromObject
 		}
-	);
+	},
 
 	// versionSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		versionSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				versionSupport = b;
-			},
+			MemberSetter<&PublishDiagnosticsClientCapabilities::versionSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor PublishDiagnosticsClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void PublishDiagnosticsClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String PublishDiagnosticsClientCapabilities::TagSupport::
+constexpr string_view PublishDiagnosticsClientCapabilities::TagSupport::
 	valueSetKey = "valueSet";
 
 PublishDiagnosticsClientCapabilities::TagSupport::
-	TagSupport(vector<DiagnosticTag> valueSet):
+	TagSupport(Vector<DiagnosticTag> valueSet):
 		valueSet(valueSet)
 {};
 
 PublishDiagnosticsClientCapabilities::TagSupport::TagSupport(){};
 PublishDiagnosticsClientCapabilities::TagSupport::~TagSupport(){};
 
-void PublishDiagnosticsClientCapabilities::TagSupport::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor PublishDiagnosticsClientCapabilities::TagSupport::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// valueSet:
-	setterMap.emplace(
+	{
+		// Key
 		valueSetKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto* maker = new ValueSetMaker(valueSet);
+				auto& self = *static_cast<TagSupport*>(object);
 
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
-
-				neededMap[valueSetKey] = true;
+				handler.pushMaker<ValueSetMaker>(self.valueSet);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor PublishDiagnosticsClientCapabilities::TagSupport::
+	descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(valueSetKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void PublishDiagnosticsClientCapabilities::TagSupport::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 PublishDiagnosticsClientCapabilities::TagSupport::ValueSetMaker::
-	ValueSetMaker(vector<DiagnosticTag>& parentArray):
+	ValueSetMaker(Vector<DiagnosticTag>& parentArray):
 		parentArray(parentArray)
 {};
 
@@ -211,61 +234,62 @@ PublishDiagnosticsClientCapabilities::TagSupport::ValueSetMaker::
 	~ValueSetMaker()
 {};
 
-void PublishDiagnosticsClientCapabilities::TagSupport::ValueSetMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor PublishDiagnosticsClientCapabilities::TagSupport::ValueSetMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// DiagnosticTag[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		[this](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
+			auto& self = *static_cast<ValueSetMaker*>(object);
+
 			if(holds_alternative<int>(n))
 			{
 				int i = get<int>(n);
 
-				parentArray.emplace_back((DiagnosticTag)i);
+				self.parentArray.emplace_back((DiagnosticTag)i);
 			}
-
-			// Nothing is added by default
-
 		},
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void PublishDiagnosticsClientCapabilities::TagSupport::ValueSetMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String PublishDiagnosticsParams::uriKey         = "uri";
-const String PublishDiagnosticsParams::versionKey     = "version";
-const String PublishDiagnosticsParams::diagnosticsKey = "diagnostics";
+constexpr string_view PublishDiagnosticsParams::uriKey         = "uri";
+constexpr string_view PublishDiagnosticsParams::versionKey     = "version";
+constexpr string_view PublishDiagnosticsParams::diagnosticsKey = "diagnostics";
 
 PublishDiagnosticsParams::PublishDiagnosticsParams(DocumentUri uri,
 	optional<Number> version,
-	vector<Diagnostic> diagnostics):
+	Vector<Diagnostic> diagnostics):
 		uri(uri),
 		version(version),
 		diagnostics(diagnostics)
@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String Range::startKey = "start";
-const String Range::endKey   = "end";
+constexpr string_view Range::startKey = "start";
+constexpr string_view Range::endKey   = "end";
 
 
 Range::Range(Position start, Position end):
@@ -33,81 +33,84 @@ Range::Range(Position start, Position end):
 Range::Range(){};
 Range::~Range(){};
 
-void Range::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor Range::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// start:
-	setterMap.emplace(
+	{
+		// Key
 		startKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				start.fillInitializer(handler->objectStack.top());
-
-				neededMap[startKey] = true;
-			}
+			MemberSetter<&Range::start>::fromObject
 		}
-	);
+	},
 
 	// end:
-	setterMap.emplace(
+	{
+		// Key
 		endKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				end.fillInitializer(handler->objectStack.top());
-
-				neededMap[endKey] = true;
-			}
+			MemberSetter<&Range::end>::fromObject
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor Range::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(startKey, 0);
-	neededMap.emplace(endKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void Range::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void Range::partialWrite(JsonWriter &writer)
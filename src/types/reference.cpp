@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String ReferenceClientCapabilities::
+constexpr string_view ReferenceClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 ReferenceClientCapabilities::
@@ -32,41 +32,54 @@ ReferenceClientCapabilities::
 ReferenceClientCapabilities::ReferenceClientCapabilities(){};
 ReferenceClientCapabilities::~ReferenceClientCapabilities(){};
 
-void ReferenceClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ReferenceClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?::
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&ReferenceClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor ReferenceClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void ReferenceClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 ReferenceRegistrationOptions::ReferenceRegistrationOptions(
@@ -87,7 +100,7 @@ void ReferenceRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String ReferenceContext::includeDeclarationKey = "includeDeclaration";
+constexpr string_view ReferenceContext::includeDeclarationKey = "includeDeclaration";
 
 ReferenceContext::ReferenceContext(Boolean includeDeclaration):
 	includeDeclaration(includeDeclaration)
@@ -96,49 +109,57 @@ ReferenceContext::ReferenceContext(Boolean includeDeclaration):
 ReferenceContext::ReferenceContext(){};
 ReferenceContext::~ReferenceContext(){};
 
-void ReferenceContext::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ReferenceContext::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// includeDeclaration:
-	setterMap.emplace(
+	{
+		// Key
 		includeDeclarationKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this, &neededMap](Boolean b)
-			{
-				includeDeclaration = b;
-				neededMap[includeDeclarationKey] = true;
-			},
+			MemberSetter<&ReferenceContext::includeDeclaration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor ReferenceContext::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(includeDeclarationKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void ReferenceContext::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String ReferenceParams::contextKey = "context";
+constexpr string_view ReferenceParams::contextKey = "context";
 
 ReferenceParams::ReferenceParams(TextDocumentIdentifier textDocument,
 	Position position,
@@ -154,54 +175,69 @@ ReferenceParams::ReferenceParams(TextDocumentIdentifier textDocument,
 ReferenceParams::ReferenceParams(){};
 ReferenceParams::~ReferenceParams(){};
 
-void ReferenceParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ReferenceParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// context:
-	setterMap.emplace(
+	{
+		// Key
 		contextKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				context.fillInitializer(handler->objectStack.top());
-				neededMap[contextKey] = true;
-			}
+			MemberSetter<&ReferenceParams::context>::fromObject
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(contextKey, 0);
+constexpr ObjectDescriptor ReferenceParams::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<ReferenceParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<ReferenceParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<ReferenceParams, PartialResultParams>
+		}
+	}
+};
+
+void ReferenceParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
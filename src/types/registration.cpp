@@ -21,9 +21,9 @@ namespace clsp
 
 using namespace std;
 
-const String Registration::idKey              = "id";
-const String Registration::methodKey          = "method";
-const String Registration::registerOptionsKey = "registerOptions";
+constexpr string_view Registration::idKey              = "id";
+constexpr string_view Registration::methodKey          = "method";
+constexpr string_view Registration::registerOptionsKey = "registerOptions";
 
 Registration::Registration(String id, String method, optional<Any> registerOptions):
 	id(id),
@@ -53,9 +53,9 @@ void Registration::partialWrite(JsonWriter &writer)
 }
 
 
-const String RegistrationParams::registrationsKey = "registrations";
+constexpr string_view RegistrationParams::registrationsKey = "registrations";
 
-RegistrationParams::RegistrationParams(vector<Registration> registrations):
+RegistrationParams::RegistrationParams(Vector<Registration> registrations):
 	registrations(registrations)
 {};
 
@@ -75,8 +75,8 @@ void RegistrationParams::partialWrite(JsonWriter &writer)
 }
 
 
-const String Unregistration::idKey              = "id";
-const String Unregistration::methodKey          = "method";
+constexpr string_view Unregistration::idKey              = "id";
+constexpr string_view Unregistration::methodKey          = "method";
 
 Unregistration::Unregistration(String id, String method):
 	id(id),
@@ -98,9 +98,9 @@ void Unregistration::partialWrite(JsonWriter &writer)
 }
 
 
-const String UnregistrationParams::unregisterationsKey = "unregisterations";
+constexpr string_view UnregistrationParams::unregisterationsKey = "unregisterations";
 
-UnregistrationParams::UnregistrationParams(vector<Unregistration> unregisterations):
+UnregistrationParams::UnregistrationParams(Vector<Unregistration> unregisterations):
 	unregisterations(unregisterations)
 {};
 
@@ -21,10 +21,10 @@ namespace clsp
 
 using namespace std;
 
-const String RenameClientCapabilities::
+constexpr string_view RenameClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String RenameClientCapabilities::
+constexpr string_view RenameClientCapabilities::
 	prepareSupportKey      = "prepareSupport";
 
 RenameClientCapabilities::
@@ -37,73 +37,89 @@ RenameClientCapabilities::
 RenameClientCapabilities::RenameClientCapabilities(){};
 RenameClientCapabilities::~RenameClientCapabilities(){};
 
-void RenameClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor RenameClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&RenameClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// prepareSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		prepareSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				prepareSupport = b;
-			},
+			MemberSetter<&RenameClientCapabilities::prepareSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor RenameClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void RenameClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String RenameOptions::prepareProviderKey = "prepareProvider";
+constexpr string_view RenameOptions::prepareProviderKey = "prepareProvider";
 
 RenameOptions::RenameOptions(optional<Boolean> workDoneProgress,
 	optional<Boolean> prepareProvider):
@@ -147,7 +163,7 @@ void RenameRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String RenameParams::newNameKey      = "newName";
+constexpr string_view RenameParams::newNameKey      = "newName";
 
 RenameParams::RenameParams( TextDocumentIdentifier textDocument,
 	Position position,
@@ -161,51 +177,65 @@ RenameParams::RenameParams( TextDocumentIdentifier textDocument,
 RenameParams::RenameParams(){};
 RenameParams::~RenameParams(){};
 
-void RenameParams::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor RenameParams::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// newName:
-	setterMap.emplace(
+	{
+		// Key
 		newNameKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				newName = str;
-				neededMap[newNameKey] = true;
-			},
+			MemberSetter<&RenameParams::newName>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(newNameKey, 0);
+constexpr ObjectDescriptor RenameParams::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<RenameParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<RenameParams, WorkDoneProgressParams>
+		}
+	}
+};
+
+void RenameParams::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
@@ -21,9 +21,9 @@ namespace clsp
 
 using namespace std;
 
-const String RequestMessage::idKey     = "id";
-const String RequestMessage::methodKey = "method";
-const String RequestMessage::paramsKey = "params";
+constexpr string_view RequestMessage::idKey     = "id";
+constexpr string_view RequestMessage::methodKey = "method";
+constexpr string_view RequestMessage::paramsKey = "params";
 
 RequestMessage::RequestMessage(Server& server,
 	variant<Number, String> id,
@@ -21,9 +21,9 @@ namespace clsp
 
 using namespace std;
 
-const String ResponseMessage::idKey     = "id";
-const String ResponseMessage::resultKey = "result";
-const String ResponseMessage::errorKey  = "error";
+constexpr string_view ResponseMessage::idKey     = "id";
+constexpr string_view ResponseMessage::resultKey = "result";
+constexpr string_view ResponseMessage::errorKey  = "error";
 
 
 ResponseMessage::ResponseMessage(Server& server,
@@ -82,10 +82,11 @@ void ResponseMessage::partialWrite(JsonWriter &writer)
 	if(result.has_value() && !holds_alternative<Null>(id))
 	{
 		// Completes the request send from the client.
-		String method = server.completeRequest(methodId, RequestKind::fromClient);
+		string_view method =
+			server.completeRequest(methodId, RequestKind::fromClient);
 
-		optional<Capability> capability = server.getCapability(method);
-		if(capability.has_value())
+		const Capability* capability = server.getCapability(method);
+		if(capability != nullptr)
 		{
 			writer.Key(resultKey);
 			capability->result->writer.value()(writer, *result);
@@ -100,9 +101,9 @@ void ResponseMessage::partialWrite(JsonWriter &writer)
 	}
 }
 
-const String ResponseError::codeKey    = "code";
-const String ResponseError::messageKey = "message";
-const String ResponseError::dataKey    = "data";
+constexpr string_view ResponseError::codeKey    = "code";
+constexpr string_view ResponseError::messageKey = "message";
+constexpr string_view ResponseError::dataKey    = "data";
 
 ResponseError::ResponseError(ErrorCodes code, String message,
 	optional<variant<String, Number, Boolean, Array, Object, Null>> data):
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String SelectionRangeClientCapabilities::
+constexpr string_view SelectionRangeClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
 SelectionRangeClientCapabilities::
@@ -32,42 +32,55 @@ SelectionRangeClientCapabilities::
 SelectionRangeClientCapabilities::SelectionRangeClientCapabilities(){};
 SelectionRangeClientCapabilities::~SelectionRangeClientCapabilities(){};
 
-void SelectionRangeClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SelectionRangeClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&SelectionRangeClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor SelectionRangeClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void SelectionRangeClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 SelectionRangeRegistrationOptions::
@@ -91,14 +104,14 @@ void SelectionRangeRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String SelectionRangeParams::textDocumentKey = "textDocument";
-const String SelectionRangeParams::positionsKey    = "positions";
+constexpr string_view SelectionRangeParams::textDocumentKey = "textDocument";
+constexpr string_view SelectionRangeParams::positionsKey    = "positions";
 
 SelectionRangeParams::SelectionRangeParams(
 	optional<ProgressToken> workDoneToken,
 	optional<ProgressToken> partialResultToken,
 	TextDocumentIdentifier textDocument,
-	vector<Position> positions):
+	Vector<Position> positions):
 		WorkDoneProgressParams(workDoneToken),
 		PartialResultParams(partialResultToken),
 		textDocument(textDocument),
@@ -108,93 +121,103 @@ SelectionRangeParams::SelectionRangeParams(
 SelectionRangeParams::SelectionRangeParams(){};
 SelectionRangeParams::~SelectionRangeParams(){};
 
-void SelectionRangeParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SelectionRangeParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&SelectionRangeParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// positions:
-	setterMap.emplace(
+	{
+		// Key
 		positionsKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				handler->pushInitializer();
-
-				auto* maker = new PositionsMaker(positions);
+				auto& self = *static_cast<SelectionRangeParams*>(object);
 
-				maker->fillInitializer(handler->objectStack.top());
-
-				neededMap[positionsKey] = true;
+				handler.pushMaker<PositionsMaker>(self.positions);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(positionsKey, 0);
+constexpr ObjectDescriptor SelectionRangeParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<SelectionRangeParams, WorkDoneProgressParams>
+		},
 
-	// This
-	initializer.object = this;
+		{
+			&PartialResultParams::descriptor,
+			upcast<SelectionRangeParams, PartialResultParams>
+		}
+	}
+};
+
+void SelectionRangeParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 SelectionRangeParams::PositionsMaker::
-	PositionsMaker(vector<Position> &parentArray):
+	PositionsMaker(Vector<Position> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -202,53 +225,53 @@ SelectionRangeParams::PositionsMaker::
 	~PositionsMaker()
 {};
 
-void SelectionRangeParams::PositionsMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor SelectionRangeParams::PositionsMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// Position[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto &obj = parentArray.emplace_back();
+			auto& self = *static_cast<PositionsMaker*>(object);
+
+			auto &obj = self.parentArray.emplace_back();
 
-			handler->pushInitializer();
-			obj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(obj);
 		}
-	};
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void SelectionRangeParams::PositionsMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String SelectionRange::rangeKey  = "range";
-const String SelectionRange::parentKey = "parent";
+constexpr string_view SelectionRange::rangeKey  = "range";
+constexpr string_view SelectionRange::parentKey = "parent";
 
 SelectionRange::SelectionRange(Range range,
 	optional<shared_ptr<SelectionRange>> parent):
@@ -258,7 +281,7 @@ SelectionRange::SelectionRange(Range range,
 
 SelectionRange::SelectionRange(Range range, SelectionRange parent):
 	range(range),
-	parent(make_shared<SelectionRange>(parent))
+	parent(makeObject<SelectionRange>(parent))
 {};
 
 SelectionRange::SelectionRange(){};
@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String ShowMessageParams::typeKey    = "type";
-const String ShowMessageParams::messageKey = "message";
+constexpr string_view ShowMessageParams::typeKey    = "type";
+constexpr string_view ShowMessageParams::messageKey = "message";
 
 ShowMessageParams::ShowMessageParams(MessageType type, String message):
 	type(type),
@@ -44,7 +44,7 @@ void ShowMessageParams::partialWrite(JsonWriter &writer)
 }
 
 
-const String MessageActionItem::titleKey = "title";
+constexpr string_view MessageActionItem::titleKey = "title";
 
 MessageActionItem::MessageActionItem(String title):
 	title(title)
@@ -53,46 +53,54 @@ MessageActionItem::MessageActionItem(String title):
 MessageActionItem::MessageActionItem(){};
 MessageActionItem::~MessageActionItem(){};
 
-void MessageActionItem::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor MessageActionItem::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// title:
-	setterMap.emplace(
+	{
+		// Key
 		titleKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				title = str;
-				neededMap[titleKey] = true;
-			},
+			MemberSetter<&MessageActionItem::title>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor MessageActionItem::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(titleKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void MessageActionItem::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void MessageActionItem::partialWrite(JsonWriter &writer)
@@ -102,13 +110,13 @@ void MessageActionItem::partialWrite(JsonWriter &writer)
 	writer.String(title);
 }
 
-const String ShowMessageRequestParams::typeKey    = "type";
-const String ShowMessageRequestParams::messageKey = "message";
-const String ShowMessageRequestParams::actionsKey = "actions";
+constexpr string_view ShowMessageRequestParams::typeKey    = "type";
+constexpr string_view ShowMessageRequestParams::messageKey = "message";
+constexpr string_view ShowMessageRequestParams::actionsKey = "actions";
 
 ShowMessageRequestParams::ShowMessageRequestParams(MessageType type,
 	String message,
-	optional<vector<MessageActionItem>> actions):
+	optional<Vector<MessageActionItem>> actions):
 		type(type),
 		message(message),
 		actions(actions)
@@ -21,13 +21,13 @@ namespace clsp
 
 using namespace std;
 
-const String SignatureHelpClientCapabilities::
+constexpr string_view SignatureHelpClientCapabilities::
 	dynamicRegistrationKey  = "dynamicRegistration";
 
-const String SignatureHelpClientCapabilities::
+constexpr string_view SignatureHelpClientCapabilities::
 	signatureInformationKey = "signatureInformation";
 
-const String SignatureHelpClientCapabilities::
+constexpr string_view SignatureHelpClientCapabilities::
 	contextSupportKey       = "contextSupport";
 
 SignatureHelpClientCapabilities::
@@ -43,111 +43,125 @@ SignatureHelpClientCapabilities::SignatureHelpClientCapabilities(){};
 SignatureHelpClientCapabilities::~SignatureHelpClientCapabilities(){};
 
 
-void SignatureHelpClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SignatureHelpClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&SignatureHelpClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// signatureInformation?:
-	setterMap.emplace(
+	{
+		// Key
 		signatureInformationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				signatureInformation.emplace();
-
-				handler->pushInitializer();
-				signatureInformation->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&SignatureHelpClientCapabilities::signatureInformation>::fromObject
 		}
-	);
+	},
 
 	// contextSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		contextSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				contextSupport = b;
-			},
+			MemberSetter<&SignatureHelpClientCapabilities::contextSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// This
-	initializer.object = this;
+constexpr ObjectDescriptor SignatureHelpClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void SignatureHelpClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String SignatureHelpClientCapabilities::SignatureInformation::
+constexpr string_view SignatureHelpClientCapabilities::SignatureInformation::
 	documentationFormatKey  = "documentationFormat";
 
-const String SignatureHelpClientCapabilities::SignatureInformation::
+constexpr string_view SignatureHelpClientCapabilities::SignatureInformation::
 	parameterInformationKey = "parameterInformation";
 
 SignatureHelpClientCapabilities::SignatureInformation::
-	SignatureInformation(optional<vector<MarkupKind>> documentationFormat,
+	SignatureInformation(optional<Vector<MarkupKind>> documentationFormat,
 			optional<ParameterInformation> parameterInformation):
 				documentationFormat(documentationFormat),
 				parameterInformation(parameterInformation)
@@ -158,87 +172,102 @@ SignatureHelpClientCapabilities::SignatureInformation::
 	~SignatureInformation()
 {};
 
-void SignatureHelpClientCapabilities::SignatureInformation::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SignatureHelpClientCapabilities::SignatureInformation::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// documentationFormat?:
-	setterMap.emplace(
+	{
+		// Key
 		documentationFormatKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				documentationFormat.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<SignatureInformation*>(object);
 
-				auto* maker = new DocumentationFormatMaker(*documentationFormat);
+				self.documentationFormat.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<DocumentationFormatMaker>(
+					*self.documentationFormat);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// parameterInformation?:
-	setterMap.emplace(
+	{
+		// Key
 		parameterInformationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				parameterInformation.emplace();
-
-				handler->pushInitializer();
-				parameterInformation->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&SignatureInformation::parameterInformation>::fromObject
 		}
-	);
+	}
+};
 
-	// This
-	initializer.object = this;
+constexpr ObjectDescriptor SignatureHelpClientCapabilities::SignatureInformation::
+	descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void SignatureHelpClientCapabilities::SignatureInformation::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
 SignatureHelpClientCapabilities::
 	SignatureInformation::
 	DocumentationFormatMaker::
-		DocumentationFormatMaker(vector<MarkupKind> &parentArray):
+		DocumentationFormatMaker(Vector<MarkupKind> &parentArray):
 			parentArray(parentArray)
 {};
 
@@ -248,48 +277,52 @@ SignatureHelpClientCapabilities::
 		~DocumentationFormatMaker()
 {};
 
-void SignatureHelpClientCapabilities::
-	SignatureInformation::
-	DocumentationFormatMaker::
-		fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor SignatureHelpClientCapabilities::SignatureInformation::DocumentationFormatMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// MarkupKind[]
-	extraSetter =
 	{
 		// String
-		[this](String str)
+		[](void* object, JsonHandler&, String&& str)
 		{
-			parentArray.emplace_back(str);
+			auto& self = *static_cast<DocumentationFormatMaker*>(object);
+
+			self.parentArray.emplace_back(move(str));
 		},
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void SignatureHelpClientCapabilities::
+	SignatureInformation::
+	DocumentationFormatMaker::
+		fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String SignatureHelpClientCapabilities::
+constexpr string_view SignatureHelpClientCapabilities::
 	SignatureInformation::
 	ParameterInformation::
 		labelOffsetSupportKey = "labelOffsetSupport";
@@ -307,57 +340,72 @@ SignatureHelpClientCapabilities::SignatureInformation::ParameterInformation::
 	~ParameterInformation()
 {};
 
-void SignatureHelpClientCapabilities::
-	SignatureInformation::
-	ParameterInformation::
-		fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SignatureHelpClientCapabilities::SignatureInformation::ParameterInformation::
+	fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// labelOffsetSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		labelOffsetSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				labelOffsetSupport = b;
-			},
+			MemberSetter<&ParameterInformation::labelOffsetSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor SignatureHelpClientCapabilities::SignatureInformation::ParameterInformation::
+	descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void SignatureHelpClientCapabilities::
+	SignatureInformation::
+	ParameterInformation::
+		fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String SignatureHelpOptions::
+constexpr string_view SignatureHelpOptions::
 	triggerCharactersKey   = "triggerCharacters";
 
-const String SignatureHelpOptions::
+constexpr string_view SignatureHelpOptions::
 	retriggerCharactersKey = "retriggerCharacters";
 
 SignatureHelpOptions::
 	SignatureHelpOptions(optional<Boolean> workDoneProgress,
-		optional<vector<String>> triggerCharacters,
-		optional<vector<String>> retriggerCharacters):
+		optional<Vector<String>> triggerCharacters,
+		optional<Vector<String>> retriggerCharacters):
 			WorkDoneProgressOptions(workDoneProgress),
 			triggerCharacters(triggerCharacters),
 			retriggerCharacters(retriggerCharacters)
@@ -400,8 +448,8 @@ void SignatureHelpOptions::partialWrite(JsonWriter &writer)
 SignatureHelpRegistrationOptions::SignatureHelpRegistrationOptions(
 	variant<DocumentSelector, Null> documentSelector,
 	optional<Boolean> workDoneProgress,
-	optional<vector<String>> triggerCharacters,
-	optional<vector<String>> retriggerCharacters):
+	optional<Vector<String>> triggerCharacters,
+	optional<Vector<String>> retriggerCharacters):
 		TextDocumentRegistrationOptions(documentSelector),
 		SignatureHelpOptions(workDoneProgress,
 			triggerCharacters,
@@ -419,8 +467,8 @@ void SignatureHelpRegistrationOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String ParameterInformation::labelKey         = "label";
-const String ParameterInformation::documentationKey = "documentation";
+constexpr string_view ParameterInformation::labelKey         = "label";
+constexpr string_view ParameterInformation::documentationKey = "documentation";
 
 ParameterInformation::
 	ParameterInformation(variant<String, array<Number, 2>> label,
@@ -432,92 +480,98 @@ ParameterInformation::
 ParameterInformation::ParameterInformation(){};
 ParameterInformation::~ParameterInformation(){};
 
-void ParameterInformation::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ParameterInformation::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// label:
-	setterMap.emplace(
+	{
+		// Key
 		labelKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				label = str;
-				neededMap[labelKey] = true;
-			},
+			MemberSetter<&ParameterInformation::label>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& arr = label.emplace<array<Number, 2>>();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<ParameterInformation*>(object);
 
-				auto* maker = new LabelMaker(arr);
+				auto& arr = self.label.emplace<array<Number, 2>>();
 
-				maker->fillInitializer(handler->objectStack.top());
-
-				neededMap[labelKey] = true;
+				handler.pushMaker<LabelMaker>(arr);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// documentation?:
-	setterMap.emplace(
+	{
+		// Key
 		documentationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				documentation = str;
-			},
+			MemberSetter<&ParameterInformation::documentation>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto& obj = documentation.emplace().emplace<MarkupContent>();
+				auto& self = *static_cast<ParameterInformation*>(object);
+
+				auto& obj = self.documentation.emplace().emplace<MarkupContent>();
 
-				handler->pushInitializer();
-				obj.fillInitializer(handler->objectStack.top());
+				handler.pushObject(obj);
 			}
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor ParameterInformation::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(labelKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void ParameterInformation::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void ParameterInformation::partialWrite(JsonWriter &writer)
@@ -563,53 +617,56 @@ ParameterInformation::LabelMaker::
 	~LabelMaker()
 {};
 
-void ParameterInformation::LabelMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor ParameterInformation::LabelMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// [Number, Number]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		[this](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
-			parentArray.at(index++) = n;
+			auto& self = *static_cast<LabelMaker*>(object);
+
+			self.parentArray.at(self.index++) = n;
 		},
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void ParameterInformation::LabelMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String SignatureInformation::labelKey         = "label";
-const String SignatureInformation::documentationKey = "documentation";
-const String SignatureInformation::parametersKey    = "parameters";
+constexpr string_view SignatureInformation::labelKey         = "label";
+constexpr string_view SignatureInformation::documentationKey = "documentation";
+constexpr string_view SignatureInformation::parametersKey    = "parameters";
 
 SignatureInformation::SignatureInformation(String label,
 	optional<variant<String, MarkupContent>> documentation,
-	optional<vector<ParameterInformation>> parameters):
+	optional<Vector<ParameterInformation>> parameters):
 		label(label),
 		documentation(documentation),
 		parameters(parameters)
@@ -618,116 +675,128 @@ SignatureInformation::SignatureInformation(String label,
 SignatureInformation::SignatureInformation(){};
 SignatureInformation::~SignatureInformation(){};
 
-void SignatureInformation::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SignatureInformation::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// label:
-	setterMap.emplace(
+	{
+		// Key
 		labelKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				label = str;
-				neededMap[labelKey] = true;
-			},
+			MemberSetter<&SignatureInformation::label>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// documentation?:
-	setterMap.emplace(
+	{
+		// Key
 		documentationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				documentation = str;
-			},
+			MemberSetter<&SignatureInformation::documentation>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				documentation = MarkupContent();
+				auto& self = *static_cast<SignatureInformation*>(object);
 
-				handler->pushInitializer();
+				self.documentation = MarkupContent();
 
-				get<MarkupContent>(documentation.value()).
-					fillInitializer(handler->objectStack.top());
+				handler.pushObject(get<MarkupContent>(self.documentation.value()));
 			}
 		}
-	);
+	},
 
 	// parameters?:
-	setterMap.emplace(
+	{
+		// Key
 		parametersKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				parameters.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<SignatureInformation*>(object);
 
-				auto* maker = new ParametersMaker(parameters.value());
+				self.parameters.emplace();
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ParametersMaker>(self.parameters.value());
 			},
 
 			// Object
-			nullopt,
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor SignatureInformation::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(labelKey, 0);
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void SignatureInformation::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void SignatureInformation::partialWrite(JsonWriter &writer)
@@ -766,7 +835,7 @@ void SignatureInformation::partialWrite(JsonWriter &writer)
 }
 
 SignatureInformation::ParametersMaker::
-	ParametersMaker(vector<ParameterInformation> &parentArray):
+	ParametersMaker(Vector<ParameterInformation> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -775,55 +844,55 @@ SignatureInformation::ParametersMaker::
 {};
 
 
-void SignatureInformation::ParametersMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor SignatureInformation::ParametersMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// ParameterInformation[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& obj = parentArray.emplace_back();
+			auto& self = *static_cast<ParametersMaker*>(object);
+
+			auto& obj = self.parentArray.emplace_back();
 
-			handler->pushInitializer();
-			obj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(obj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void SignatureInformation::ParametersMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String SignatureHelp::signaturesKey      = "signatures";
-const String SignatureHelp::activeSignatureKey = "activeSignature";
-const String SignatureHelp::activeParameterKey = "activeParameter";
+constexpr string_view SignatureHelp::signaturesKey      = "signatures";
+constexpr string_view SignatureHelp::activeSignatureKey = "activeSignature";
+constexpr string_view SignatureHelp::activeParameterKey = "activeParameter";
 
-SignatureHelp::SignatureHelp(vector<SignatureInformation> signatures,
+SignatureHelp::SignatureHelp(Vector<SignatureInformation> signatures,
 	optional<Number> activeSignature,
 	optional<Number> activeParameter):
 		signatures(signatures),
@@ -834,107 +903,119 @@ SignatureHelp::SignatureHelp(vector<SignatureInformation> signatures,
 SignatureHelp::SignatureHelp(){};
 SignatureHelp::~SignatureHelp(){};
 
-void SignatureHelp::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SignatureHelp::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// signatures:
-	setterMap.emplace(
+	{
+		// Key
 		signaturesKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				handler->pushInitializer();
+				auto& self = *static_cast<SignatureHelp*>(object);
 
-				auto* maker = new SignaturesMaker(signatures);
-
-				maker->fillInitializer(handler->objectStack.top());
-
-				neededMap[signaturesKey] = true;
+				handler.pushMaker<SignaturesMaker>(self.signatures);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// activeSignature?:
-	setterMap.emplace(
+	{
+		// Key
 		activeSignatureKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
-			{
-				activeSignature = n;
-			},
+			MemberSetter<&SignatureHelp::activeSignature>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// activeParameter?:
-	setterMap.emplace(
+	{
+		// Key
 		activeParameterKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
-			{
-				activeParameter = n;
-			},
+			MemberSetter<&SignatureHelp::activeParameter>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor SignatureHelp::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(signaturesKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void SignatureHelp::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void SignatureHelp::partialWrite(JsonWriter &writer)
@@ -965,7 +1046,7 @@ void SignatureHelp::partialWrite(JsonWriter &writer)
 
 
 SignatureHelp::SignaturesMaker::
-	SignaturesMaker(vector<SignatureInformation> &parentArray):
+	SignaturesMaker(Vector<SignatureInformation> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -974,60 +1055,60 @@ SignatureHelp::SignaturesMaker::
 {};
 
 
-void SignatureHelp::SignaturesMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor SignatureHelp::SignaturesMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// SignatureInfomation[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[this, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& obj = parentArray.emplace_back();
+			auto& self = *static_cast<SignaturesMaker*>(object);
+
+			auto& obj = self.parentArray.emplace_back();
 
-			handler->pushInitializer();
-			obj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(obj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void SignatureHelp::SignaturesMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String SignatureHelpContext::
+constexpr string_view SignatureHelpContext::
 	triggerKindKey         = "triggerKind";
 
-const String SignatureHelpContext::
+constexpr string_view SignatureHelpContext::
 	triggerCharacterKey    = "triggerCharacter";
 
-const String SignatureHelpContext::
+constexpr string_view SignatureHelpContext::
 	isRetriggerKey         = "isRetrigger";
 
-const String SignatureHelpContext::
+constexpr string_view SignatureHelpContext::
 	activeSignatureHelpKey = "activeSignatureHelp";
 
 SignatureHelpContext::
@@ -1044,147 +1125,161 @@ SignatureHelpContext::
 SignatureHelpContext::SignatureHelpContext(){};
 SignatureHelpContext::~SignatureHelpContext(){};
 
-void SignatureHelpContext::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SignatureHelpContext::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// SignatureHelpTriggerKind:
-	setterMap.emplace(
+	{
+		// Key
 		triggerKindKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
+			[](void* object, JsonHandler&, Number n)
 			{
+				auto& self = *static_cast<SignatureHelpContext*>(object);
+
 				if(holds_alternative<int>(n))
 				{
 					int i = get<int>(n);
 
-					triggerKind = (SignatureHelpTriggerKind)i;
+					self.triggerKind = (SignatureHelpTriggerKind)i;
 
-					neededMap[triggerKindKey] = true;
 				}
 				else
 				{
-					// Exception or something
 				}
 			},
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// triggerCharacter?:
-	setterMap.emplace(
+	{
+		// Key
 		triggerCharacterKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				triggerCharacter = str;
-			},
+			MemberSetter<&SignatureHelpContext::triggerCharacter>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// isRetrigger:
-	setterMap.emplace(
+	{
+		// Key
 		isRetriggerKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this, &neededMap](Boolean b)
-			{
-				isRetrigger = b;
-				neededMap[isRetriggerKey] = true;
-			},
+			MemberSetter<&SignatureHelpContext::isRetrigger>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// activeSignatureHelp?:
-	setterMap.emplace(
+	{
+		// Key
 		activeSignatureHelpKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				activeSignatureHelp.emplace();
-
-				handler->pushInitializer();
-				activeSignatureHelp->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&SignatureHelpContext::activeSignatureHelp>::fromObject
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(triggerKindKey, 0);
-	neededMap.emplace(isRetriggerKey, 0);
+constexpr ObjectDescriptor SignatureHelpContext::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void SignatureHelpContext::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String SignatureHelpParams::contextKey = "context";
+constexpr string_view SignatureHelpParams::contextKey = "context";
 
 SignatureHelpParams::SignatureHelpParams(TextDocumentIdentifier textDocument,
 	Position position,
@@ -1198,50 +1293,64 @@ SignatureHelpParams::SignatureHelpParams(TextDocumentIdentifier textDocument,
 SignatureHelpParams::SignatureHelpParams(){};
 SignatureHelpParams::~SignatureHelpParams(){};
 
-void SignatureHelpParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor SignatureHelpParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// context?:
-	setterMap.emplace(
+	{
+		// Key
 		contextKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				context.emplace();
+			MemberSetter<&SignatureHelpParams::context>::fromObject
+		}
+	}
+};
 
-				handler->pushInitializer();
-				context->fillInitializer(handler->objectStack.top());
-			}
+constexpr ObjectDescriptor SignatureHelpParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<SignatureHelpParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<SignatureHelpParams, WorkDoneProgressParams>
 		}
-	);
+	}
+};
 
-	// This
-	initializer.object = this;
+void SignatureHelpParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
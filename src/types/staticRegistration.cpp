@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String StaticRegistrationOptions::idKey = "id";
+constexpr string_view StaticRegistrationOptions::idKey = "id";
 
 StaticRegistrationOptions::StaticRegistrationOptions(optional<String> id):
 	id(id)
@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String TextDocumentIdentifier::uriKey = "uri";
+constexpr string_view TextDocumentIdentifier::uriKey = "uri";
 
 TextDocumentIdentifier::TextDocumentIdentifier(DocumentUri uri):
 	uri(uri)
@@ -30,46 +30,54 @@ TextDocumentIdentifier::TextDocumentIdentifier(DocumentUri uri):
 TextDocumentIdentifier::TextDocumentIdentifier(){};
 TextDocumentIdentifier::~TextDocumentIdentifier(){};
 
-void TextDocumentIdentifier::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TextDocumentIdentifier::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// uri:
-	setterMap.emplace(
+	{
+		// Key
 		uriKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				uri = str;
-				neededMap[uriKey] = true;
-			},
+			MemberSetter<&TextDocumentIdentifier::uri>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor TextDocumentIdentifier::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(uriKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void TextDocumentIdentifier::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void TextDocumentIdentifier::partialWrite(JsonWriter &writer)
@@ -80,7 +88,7 @@ void TextDocumentIdentifier::partialWrite(JsonWriter &writer)
 }
 
 
-const String VersionedTextDocumentIdentifier::versionKey = "version";
+constexpr string_view VersionedTextDocumentIdentifier::versionKey = "version";
 
 VersionedTextDocumentIdentifier::
 	VersionedTextDocumentIdentifier(DocumentUri uri,
@@ -92,54 +100,60 @@ VersionedTextDocumentIdentifier::
 VersionedTextDocumentIdentifier::VersionedTextDocumentIdentifier(){};
 VersionedTextDocumentIdentifier::~VersionedTextDocumentIdentifier(){};
 
-void VersionedTextDocumentIdentifier::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor VersionedTextDocumentIdentifier::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parent
-	TextDocumentIdentifier::fillInitializer(initializer);
-
-	// Value setters
-
 	// version:
-	setterMap.emplace(
+	{
+		// Key
 		versionKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				version = n;
-				neededMap[versionKey] = true;
-			},
+			MemberSetter<&VersionedTextDocumentIdentifier::version>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			[this, &neededMap]()
-			{
-				version = Null();
-				neededMap[versionKey] = true;
-			},
+			MemberSetter<&VersionedTextDocumentIdentifier::version>::fromNull,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor VersionedTextDocumentIdentifier::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(versionKey, 0);
+	// Parents
+	{
+		{
+			&TextDocumentIdentifier::descriptor,
+			upcast<VersionedTextDocumentIdentifier, TextDocumentIdentifier>
+		}
+	}
+};
 
-	// This
-	initializer.object = this;
+void VersionedTextDocumentIdentifier::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void VersionedTextDocumentIdentifier::partialWrite(JsonWriter &writer)
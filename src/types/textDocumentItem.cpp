@@ -21,10 +21,10 @@ namespace clsp
 
 using namespace std;
 
-const String TextDocumentItem::uriKey        = "uri";
-const String TextDocumentItem::languageIdKey = "languageId";
-const String TextDocumentItem::versionKey    = "version";
-const String TextDocumentItem::textKey       = "text";
+constexpr string_view TextDocumentItem::uriKey        = "uri";
+constexpr string_view TextDocumentItem::languageIdKey = "languageId";
+constexpr string_view TextDocumentItem::versionKey    = "version";
+constexpr string_view TextDocumentItem::textKey       = "text";
 
 TextDocumentItem::TextDocumentItem(DocumentUri uri,
 	String languageId,
@@ -39,133 +39,144 @@ TextDocumentItem::TextDocumentItem(DocumentUri uri,
 TextDocumentItem::TextDocumentItem(){};
 TextDocumentItem::~TextDocumentItem(){};
 
-void TextDocumentItem::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TextDocumentItem::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// uri:
-	setterMap.emplace(
+	{
+		// Key
 		uriKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				uri = str;
-				neededMap[uriKey] = true;
-			},
+			MemberSetter<&TextDocumentItem::uri>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// languageId:
-	setterMap.emplace(
+	{
+		// Key
 		languageIdKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				languageId = str;
-				neededMap[languageIdKey] = true;
-			},
+			MemberSetter<&TextDocumentItem::languageId>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// version:
-	setterMap.emplace(
+	{
+		// Key
 		versionKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
-			{
-				version = n;
-				neededMap[versionKey] = true;
-			},
+			MemberSetter<&TextDocumentItem::version>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// text:
-	setterMap.emplace(
+	{
+		// Key
 		textKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				text = str;
-				neededMap[textKey] = true;
-			},
+			MemberSetter<&TextDocumentItem::text>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor TextDocumentItem::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(uriKey, 0);
-	neededMap.emplace(languageIdKey, 0);
-	neededMap.emplace(versionKey, 0);
-	neededMap.emplace(textKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void TextDocumentItem::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void TextDocumentItem::partialWrite(JsonWriter &writer)
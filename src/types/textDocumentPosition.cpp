@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String TextDocumentPositionParams::textDocumentKey = "textDocument";
-const String TextDocumentPositionParams::positionKey     = "position";
+constexpr string_view TextDocumentPositionParams::textDocumentKey = "textDocument";
+constexpr string_view TextDocumentPositionParams::positionKey     = "position";
 
 TextDocumentPositionParams::TextDocumentPositionParams(
 	TextDocumentIdentifier textDocument,
@@ -34,83 +34,84 @@ TextDocumentPositionParams::TextDocumentPositionParams(
 TextDocumentPositionParams::TextDocumentPositionParams(){};
 TextDocumentPositionParams::~TextDocumentPositionParams(){};
 
-void TextDocumentPositionParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TextDocumentPositionParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&TextDocumentPositionParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// position:
-	setterMap.emplace(
+	{
+		// Key
 		positionKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
+			MemberSetter<&TextDocumentPositionParams::position>::fromObject
+		}
+	}
+};
 
-				position.fillInitializer(handler->objectStack.top());
+constexpr ObjectDescriptor TextDocumentPositionParams::descriptor =
+{
+	// Fields
+	fields,
 
-				neededMap[positionKey] = true;
-			}
-		}
-	);
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(positionKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void TextDocumentPositionParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
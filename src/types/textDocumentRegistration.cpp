@@ -21,7 +21,7 @@ namespace clsp
 
 using namespace std;
 
-const String TextDocumentRegistrationOptions::documentSelectorKey = "documentSelector";
+constexpr string_view TextDocumentRegistrationOptions::documentSelectorKey = "documentSelector";
 
 
 TextDocumentRegistrationOptions::
@@ -21,11 +21,11 @@ namespace clsp
 
 using namespace std;
 
-const String TextDocumentSyncOptions::openCloseKey         = "openClose";
-const String TextDocumentSyncOptions::changeKey            = "change";
-const String TextDocumentSyncOptions::willSaveKey          = "willSave";
-const String TextDocumentSyncOptions::willSaveWaitUntilKey = "willSaveWaitUntil";
-const String TextDocumentSyncOptions::saveKey              = "save";
+constexpr string_view TextDocumentSyncOptions::openCloseKey         = "openClose";
+constexpr string_view TextDocumentSyncOptions::changeKey            = "change";
+constexpr string_view TextDocumentSyncOptions::willSaveKey          = "willSave";
+constexpr string_view TextDocumentSyncOptions::willSaveWaitUntilKey = "willSaveWaitUntil";
+constexpr string_view TextDocumentSyncOptions::saveKey              = "save";
 
 
 TextDocumentSyncOptions::TextDocumentSyncOptions(optional<Boolean> openClose,
@@ -83,16 +83,16 @@ void TextDocumentSyncOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String TextDocumentSyncClientCapabilities::
+constexpr string_view TextDocumentSyncClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String TextDocumentSyncClientCapabilities::
+constexpr string_view TextDocumentSyncClientCapabilities::
 	willSaveKey            = "willSave";
 
-const String TextDocumentSyncClientCapabilities::
+constexpr string_view TextDocumentSyncClientCapabilities::
 	willSaveWaitUntilKey   = "willSaveWaitUntil";
 
-const String TextDocumentSyncClientCapabilities::
+constexpr string_view TextDocumentSyncClientCapabilities::
 	didSaveKey             = "didSave";
 
 
@@ -110,119 +110,144 @@ TextDocumentSyncClientCapabilities::
 TextDocumentSyncClientCapabilities::TextDocumentSyncClientCapabilities(){};
 TextDocumentSyncClientCapabilities::~TextDocumentSyncClientCapabilities(){};
 
-void TextDocumentSyncClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TextDocumentSyncClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&TextDocumentSyncClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// willSave?:
-	setterMap.emplace(
+	{
+		// Key
 		willSaveKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				willSave = b;
-			},
+			MemberSetter<&TextDocumentSyncClientCapabilities::willSave>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
+
 	// willSaveWaitUntil?:
-	setterMap.emplace(
+	{
+		// Key
 		willSaveWaitUntilKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				willSaveWaitUntil = b;
-			},
+			MemberSetter<&TextDocumentSyncClientCapabilities::willSaveWaitUntil>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
+
 	// didSave?:
-	setterMap.emplace(
+	{
+		// Key
 		didSaveKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				didSave = b;
-			},
+			MemberSetter<&TextDocumentSyncClientCapabilities::didSave>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
-	// This
-	initializer.object = this;
+	}
+};
+
+constexpr ObjectDescriptor TextDocumentSyncClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void TextDocumentSyncClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 }
@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String TextEdit::rangeKey   = "range";
-const String TextEdit::newTextKey = "newText";
+constexpr string_view TextEdit::rangeKey   = "range";
+constexpr string_view TextEdit::newTextKey = "newText";
 
 TextEdit::TextEdit(Range range, String newText):
 	range(range),
@@ -32,80 +32,84 @@ TextEdit::TextEdit(Range range, String newText):
 TextEdit::TextEdit(){};
 TextEdit::~TextEdit(){};
 
-void TextEdit::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TextEdit::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// range:
-	setterMap.emplace(
+	{
+		// Key
 		rangeKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-
-				range.fillInitializer(handler->objectStack.top());
-
-				neededMap[rangeKey] = true;
-			}
+			MemberSetter<&TextEdit::range>::fromObject
 		}
-	);
+	},
 
 	// newText:
-	setterMap.emplace(
+	{
+		// Key
 		newTextKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				newText = str;
-				neededMap[newTextKey] = true;
-			},
+			MemberSetter<&TextEdit::newText>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor TextEdit::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(rangeKey, 0);
-	neededMap.emplace(newTextKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void TextEdit::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void TextEdit::partialWrite(JsonWriter &writer)
@@ -120,11 +124,11 @@ void TextEdit::partialWrite(JsonWriter &writer)
 }
 
 
-const String TextDocumentEdit::textDocumentKey = "textDocument";
-const String TextDocumentEdit::editsKey        = "edits";
+constexpr string_view TextDocumentEdit::textDocumentKey = "textDocument";
+constexpr string_view TextDocumentEdit::editsKey        = "edits";
 
 TextDocumentEdit::TextDocumentEdit(VersionedTextDocumentIdentifier textDocument,
-	vector<TextEdit> edits):
+	Vector<TextEdit> edits):
 		textDocument(textDocument),
 		edits(edits)
 {};
@@ -132,84 +136,90 @@ TextDocumentEdit::TextDocumentEdit(VersionedTextDocumentIdentifier textDocument,
 TextDocumentEdit::TextDocumentEdit(){};
 TextDocumentEdit::~TextDocumentEdit(){};
 
-void TextDocumentEdit::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TextDocumentEdit::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&TextDocumentEdit::textDocument>::fromObject
 		}
-	);
+	},
 
 	// edits:
-	setterMap.emplace(
+	{
+		// Key
 		editsKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler, &neededMap]()
+			[](void* object, JsonHandler& handler)
 			{
-				auto* maker = new EditsMaker;
-				maker->parent = this;
-
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
+				auto& self = *static_cast<TextDocumentEdit*>(object);
 
-				neededMap[editsKey] = true;
+				auto& maker = handler.pushMaker<EditsMaker>();
+				maker.parent = &self;
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(editsKey, 0);
+constexpr ObjectDescriptor TextDocumentEdit::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void TextDocumentEdit::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void TextDocumentEdit::partialWrite(JsonWriter &writer)
@@ -228,48 +238,47 @@ void TextDocumentEdit::partialWrite(JsonWriter &writer)
 	writer.EndArray();
 }
 
-void TextDocumentEdit::EditsMaker::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor TextDocumentEdit::EditsMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& extraSetter = initializer.extraSetter;
-	auto& Vector = parent->edits;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// TextEdit[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		[&Vector, handler]()
+		[](void* object, JsonHandler& handler)
 		{
-			auto& obj = Vector.emplace_back();
+			auto& self = *static_cast<EditsMaker*>(object);
+
+			auto& obj = self.parent->edits.emplace_back();
 
-			handler->pushInitializer();
-			obj.fillInitializer(handler->objectStack.top());
+			handler.pushObject(obj);
 		}
-	};
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void TextDocumentEdit::EditsMaker::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
@@ -21,10 +21,10 @@ namespace clsp
 
 using namespace std;
 
-const String TypeDefinitionClientCapabilities::
+constexpr string_view TypeDefinitionClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String TypeDefinitionClientCapabilities::
+constexpr string_view TypeDefinitionClientCapabilities::
 	linkSupportKey         = "linkSupport";
 
 TypeDefinitionClientCapabilities::
@@ -37,69 +37,85 @@ TypeDefinitionClientCapabilities::
 TypeDefinitionClientCapabilities::TypeDefinitionClientCapabilities(){};
 TypeDefinitionClientCapabilities::~TypeDefinitionClientCapabilities(){};
 
-void TypeDefinitionClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor TypeDefinitionClientCapabilities::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&TypeDefinitionClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// linkSupport?:
-	setterMap.emplace(
+	{
+		// Key
 		linkSupportKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				linkSupport = b;
-			},
+			MemberSetter<&TypeDefinitionClientCapabilities::linkSupport>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor TypeDefinitionClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void TypeDefinitionClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 TypeDefinitionRegistrationOptions::
@@ -136,12 +152,36 @@ TypeDefinitionParams::TypeDefinitionParams(TextDocumentIdentifier textDocument,
 TypeDefinitionParams::TypeDefinitionParams(){};
 TypeDefinitionParams::~TypeDefinitionParams(){};
 
-void TypeDefinitionParams::fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor TypeDefinitionParams::descriptor =
 {
+	// Fields
+	nullptr,
+
+	// Extra setter
+	{},
+
 	// Parents
-	TextDocumentPositionParams::fillInitializer(initializer);
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
+	{
+		{
+			&TextDocumentPositionParams::descriptor,
+			upcast<TypeDefinitionParams, TextDocumentPositionParams>
+		},
+
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<TypeDefinitionParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<TypeDefinitionParams, PartialResultParams>
+		}
+	}
+};
+
+void TypeDefinitionParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
@@ -21,8 +21,8 @@ namespace clsp
 
 using namespace std;
 
-const String WillSaveTextDocumentParams::textDocumentKey = "textDocument";
-const String WillSaveTextDocumentParams::reasonKey       = "reason";
+constexpr string_view WillSaveTextDocumentParams::textDocumentKey = "textDocument";
+constexpr string_view WillSaveTextDocumentParams::reasonKey       = "reason";
 
 WillSaveTextDocumentParams::
 	WillSaveTextDocumentParams(TextDocumentIdentifier textDocument,
@@ -34,89 +34,96 @@ WillSaveTextDocumentParams::
 WillSaveTextDocumentParams::WillSaveTextDocumentParams(){};
 WillSaveTextDocumentParams::~WillSaveTextDocumentParams(){};
 
-void WillSaveTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WillSaveTextDocumentParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// textDocument:
-	setterMap.emplace(
+	{
+		// Key
 		textDocumentKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler, &neededMap]()
-			{
-				handler->pushInitializer();
-				textDocument.fillInitializer(handler->objectStack.top());
-
-				neededMap[textDocumentKey] = true;
-			}
+			MemberSetter<&WillSaveTextDocumentParams::textDocument>::fromObject
 		}
-	);
+	},
 
 	// reason:
-	setterMap.emplace(
+	{
+		// Key
 		reasonKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this, &neededMap](Number n)
+			[](void* object, JsonHandler&, Number n)
 			{
+				auto& self = *static_cast<WillSaveTextDocumentParams*>(object);
+
 				if(holds_alternative<int>(n))
 				{
-					reason = TextDocumentSaveReason(get<int>(n));
+					self.reason = TextDocumentSaveReason(get<int>(n));
 
-					neededMap[reasonKey] = true;
 				}
 				else
 				{
-					// TODO
-					// Execption or something
 				}
-
 			},
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WillSaveTextDocumentParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(textDocumentKey, 0);
-	neededMap.emplace(reasonKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void WillSaveTextDocumentParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
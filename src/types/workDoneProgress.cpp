@@ -24,10 +24,10 @@ using namespace std;
 
 const pair<String, String> WorkDoneProgressBegin::kind = {"kind", "begin"};
 
-const String WorkDoneProgressBegin::titleKey       = "title";
-const String WorkDoneProgressBegin::cancellableKey = "cancellable";
-const String WorkDoneProgressBegin::messageKey     = "message";
-const String WorkDoneProgressBegin::percentageKey  = "percentage";
+constexpr string_view WorkDoneProgressBegin::titleKey       = "title";
+constexpr string_view WorkDoneProgressBegin::cancellableKey = "cancellable";
+constexpr string_view WorkDoneProgressBegin::messageKey     = "message";
+constexpr string_view WorkDoneProgressBegin::percentageKey  = "percentage";
 
 WorkDoneProgressBegin::WorkDoneProgressBegin(String title,
 	optional<Boolean> cancellable,
@@ -42,127 +42,144 @@ WorkDoneProgressBegin::WorkDoneProgressBegin(String title,
 WorkDoneProgressBegin::WorkDoneProgressBegin(){};
 WorkDoneProgressBegin::~WorkDoneProgressBegin(){};
 
-void WorkDoneProgressBegin::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkDoneProgressBegin::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// title:
-	setterMap.emplace(
+	{
+		// Key
 		titleKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				title = str;
-				neededMap[titleKey] = true;
-			},
+			MemberSetter<&WorkDoneProgressBegin::title>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// cancellable?:
-	setterMap.emplace(
+	{
+		// Key
 		cancellableKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				cancellable = b;
-			},
+			MemberSetter<&WorkDoneProgressBegin::cancellable>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// message?:
-	setterMap.emplace(
+	{
+		// Key
 		messageKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				message = str;
-			},
+			MemberSetter<&WorkDoneProgressBegin::message>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// percentage?:
-	setterMap.emplace(
+	{
+		// Key
 		percentageKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
-			{
-				percentage = n;
-			},
+			MemberSetter<&WorkDoneProgressBegin::percentage>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkDoneProgressBegin::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(titleKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void WorkDoneProgressBegin::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void WorkDoneProgressBegin::partialWrite(JsonWriter &writer)
@@ -200,9 +217,9 @@ void WorkDoneProgressBegin::partialWrite(JsonWriter &writer)
 
 const pair<String, String> WorkDoneProgressReport::kind = {"kind", "report"};
 
-const String WorkDoneProgressReport::cancellableKey = "cancellable";
-const String WorkDoneProgressReport::messageKey     = "message";
-const String WorkDoneProgressReport::percentageKey  = "percentage";
+constexpr string_view WorkDoneProgressReport::cancellableKey = "cancellable";
+constexpr string_view WorkDoneProgressReport::messageKey     = "message";
+constexpr string_view WorkDoneProgressReport::percentageKey  = "percentage";
 
 WorkDoneProgressReport::WorkDoneProgressReport(optional<Boolean> cancellable,
 	optional<String> message,
@@ -215,95 +232,114 @@ WorkDoneProgressReport::WorkDoneProgressReport(optional<Boolean> cancellable,
 WorkDoneProgressReport::WorkDoneProgressReport(){};
 WorkDoneProgressReport::~WorkDoneProgressReport(){};
 
-void WorkDoneProgressReport::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkDoneProgressReport::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// cancellable?:
-	setterMap.emplace(
+	{
+		// Key
 		cancellableKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				cancellable = b;
-			},
+			MemberSetter<&WorkDoneProgressReport::cancellable>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// message?:
-	setterMap.emplace(
+	{
+		// Key
 		messageKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				message = str;
-			},
+			MemberSetter<&WorkDoneProgressReport::message>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// percentage?:
-	setterMap.emplace(
+	{
+		// Key
 		percentageKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			[this](Number n)
-			{
-				percentage = n;
-			},
+			MemberSetter<&WorkDoneProgressReport::percentage>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkDoneProgressReport::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void WorkDoneProgressReport::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void WorkDoneProgressReport::partialWrite(JsonWriter &writer)
@@ -337,7 +373,7 @@ void WorkDoneProgressReport::partialWrite(JsonWriter &writer)
 
 const pair<String, String> WorkDoneProgressEnd::kind = {"kind", "end"};
 
-const String WorkDoneProgressEnd::messageKey = "message";
+constexpr string_view WorkDoneProgressEnd::messageKey = "message";
 
 WorkDoneProgressEnd::WorkDoneProgressEnd(optional<String> message):
 	message(message)
@@ -346,41 +382,54 @@ WorkDoneProgressEnd::WorkDoneProgressEnd(optional<String> message):
 WorkDoneProgressEnd::WorkDoneProgressEnd(){};
 WorkDoneProgressEnd::~WorkDoneProgressEnd(){};
 
-void WorkDoneProgressEnd::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkDoneProgressEnd::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// message?:
-	setterMap.emplace(
+	{
+		// Key
 		messageKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				message = str;
-			},
+			MemberSetter<&WorkDoneProgressEnd::message>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkDoneProgressEnd::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void WorkDoneProgressEnd::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void WorkDoneProgressEnd::partialWrite(JsonWriter &writer)
@@ -397,7 +446,7 @@ void WorkDoneProgressEnd::partialWrite(JsonWriter &writer)
 	}
 }
 
-const String WorkDoneProgressParams::workDoneTokenKey = "workDoneToken";
+constexpr string_view WorkDoneProgressParams::workDoneTokenKey = "workDoneToken";
 
 WorkDoneProgressParams::
 	WorkDoneProgressParams(optional<ProgressToken> workDoneToken):
@@ -407,48 +456,58 @@ WorkDoneProgressParams::
 WorkDoneProgressParams::WorkDoneProgressParams(){};
 WorkDoneProgressParams::~WorkDoneProgressParams(){};
 
-void WorkDoneProgressParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkDoneProgressParams::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// workDoneToken?:
-	setterMap.emplace(
+	{
+		// Key
 		workDoneTokenKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				workDoneToken = str;
-			},
+			MemberSetter<&WorkDoneProgressParams::workDoneToken>::fromString,
 
 			// Number
-			[this](Number n)
-			{
-				workDoneToken = n;
-			},
+			MemberSetter<&WorkDoneProgressParams::workDoneToken>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkDoneProgressParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void WorkDoneProgressParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String WorkDoneProgressOptions::workDoneProgressKey = "workDoneProgress";
+constexpr string_view WorkDoneProgressOptions::workDoneProgressKey = "workDoneProgress";
 
 WorkDoneProgressOptions::
 	WorkDoneProgressOptions(optional<Boolean> workDoneProgress):
@@ -469,7 +528,7 @@ void WorkDoneProgressOptions::partialWrite(JsonWriter &writer)
 }
 
 
-const String WorkDoneProgressCreateParams::tokenKey = "token";
+constexpr string_view WorkDoneProgressCreateParams::tokenKey = "token";
 
 WorkDoneProgressCreateParams::WorkDoneProgressCreateParams(ProgressToken token):
 	token(token)
@@ -495,7 +554,7 @@ void WorkDoneProgressCreateParams::partialWrite(JsonWriter &writer)
 }
 
 
-const String WorkDoneProgressCancelParams::tokenKey = "token";
+constexpr string_view WorkDoneProgressCancelParams::tokenKey = "token";
 
 WorkDoneProgressCancelParams::WorkDoneProgressCancelParams(ProgressToken token):
 	token(token)
@@ -504,51 +563,59 @@ WorkDoneProgressCancelParams::WorkDoneProgressCancelParams(ProgressToken token):
 WorkDoneProgressCancelParams::WorkDoneProgressCancelParams(){};
 WorkDoneProgressCancelParams::~WorkDoneProgressCancelParams(){};
 
-void WorkDoneProgressCancelParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkDoneProgressCancelParams::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// token:
-	setterMap.emplace(
+	{
+		// Key
 		tokenKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				token = str;
-				neededMap[tokenKey] = true;
-			},
+			MemberSetter<&WorkDoneProgressCancelParams::token>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkDoneProgressCancelParams::descriptor =
+{
+	// Fields
+	fields,
 
-	// Needed members
-	neededMap.emplace(tokenKey, 0);
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void WorkDoneProgressCancelParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
-const String ProgressParams::tokenKey = "token";
-const String ProgressParams::valueKey = "value";
+constexpr string_view ProgressParams::tokenKey = "token";
+constexpr string_view ProgressParams::valueKey = "value";
 
 ProgressParams::ProgressParams(ProgressToken token,
 	variant<WorkDoneProgressBegin,
@@ -561,86 +628,89 @@ ProgressParams::ProgressParams(ProgressToken token,
 ProgressParams::ProgressParams(){};
 ProgressParams::~ProgressParams(){};
 
-void ProgressParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ProgressParams::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// token:
-	setterMap.emplace(
+	{
+		// Key
 		tokenKey,
-		ValueSetter{
-			// String
-			[this, &neededMap](String str)
-			{
-				token = str;
 
-				neededMap[tokenKey] = true;
-			},
+		// Required
+		true,
 
-			// Number
-			[this, &neededMap](Number n)
-			{
-				token = n;
+		// Setter
+		{
+			// String
+			MemberSetter<&ProgressParams::token>::fromString,
 
-				neededMap[tokenKey] = true;
-			},
+			// Number
+			MemberSetter<&ProgressParams::token>::fromNumber,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// value:
-	setterMap.emplace(
+	{
+		// Key
 		valueKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				handler->pushInitializer();
-
-				auto maker = new ValueMaker(*this);
+				auto& self = *static_cast<ProgressParams*>(object);
 
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ValueMaker>(self);
 			}
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor ProgressParams::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// Needed members
-	neededMap.emplace(tokenKey, 0);
-	neededMap.emplace(valueKey, 0);
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void ProgressParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 
@@ -651,69 +721,49 @@ ProgressParams::ValueMaker::ValueMaker(ProgressParams &parent):
 ProgressParams::ValueMaker::~ValueMaker(){};
 
 
-void ProgressParams::ValueMaker::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor ProgressParams::ValueMaker::fields[] =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
+	// kind:
+	{
+		// Key
+		"kind",
 
-	// Value setters
+		// Required
+		false,
 
-	// kind:
-	setterMap.emplace(
-		"kind"s,
-		ValueSetter{
+		// Setter
+		{
 			// String
-			[this, handler, &initializer](String str)
+			[](void* object, JsonHandler& handler, String&& str)
 			{
-				map<String, function<void()>> kindMap =
-				{
-					{
-						WorkDoneProgressBegin::kind.second,
-						[this, &initializer]()
-						{
-							parent.value = WorkDoneProgressBegin();
-
-							get<WorkDoneProgressBegin>(parent.value).
-								fillInitializer(initializer);
-						}
-					},
-					{
-						WorkDoneProgressReport::kind.second,
-						[this, &initializer]()
-						{
-							parent.value = WorkDoneProgressReport();
-
-							get<WorkDoneProgressReport>(parent.value).
-								fillInitializer(initializer);
-						}
-					},
-					{
-						WorkDoneProgressEnd::kind.second,
-						[this, &initializer]()
-						{
-							parent.value = WorkDoneProgressEnd();
-
-							get<WorkDoneProgressEnd>(parent.value).
-								fillInitializer(initializer);
-						}
-					}
-				};
+				auto& self = *static_cast<ValueMaker*>(object);
 
-				auto ProgressMaker = kindMap.find(str);
-
-				if(ProgressMaker != kindMap.end())// if the kind is in the map
+				auto makeProgress = [&self, &handler](auto progress)
 				{
-					ProgressMaker->second();
+					using Progress = decltype(progress);
+
+					self.parent.value = move(progress);
 
-					// No more data to the cache
-					initializer.extraSetter.reset();
+					// The ValueMaker stays as the owner of the
+					// ObjectInitializer
+					get<Progress>(self.parent.value).
+						fillInitializer(handler.objectStack.top());
 
 					// Reparse data from the cache
-					cache.reParse(*handler);
+					self.cache.reParse(handler);
+				};
+
+				if(str == WorkDoneProgressBegin::kind.second)
+				{
+					makeProgress(WorkDoneProgressBegin());
+				}
+				else if(str == WorkDoneProgressReport::kind.second)
+				{
+					makeProgress(WorkDoneProgressReport());
+				}
+				else if(str == WorkDoneProgressEnd::kind.second)
+				{
+					makeProgress(WorkDoneProgressEnd());
 				}
 				else
 				{
@@ -722,27 +772,90 @@ void ProgressParams::ValueMaker::fillInitializer(ObjectInitializer& initializer)
 			},
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt,
+			nullptr
 		}
-	);
+	}
+};
 
-	// cache
-	cache.fillInitializer(initializer);
+constexpr ObjectDescriptor ProgressParams::ValueMaker::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	// The values recieved before kind: go to the cache
+	{
+		// String
+		[](void* object, JsonHandler& handler, String&& str)
+		{
+			auto& self = *static_cast<ValueMaker*>(object);
+
+			GenericObject::descriptor.extraSetter.
+				setString(&self.cache, handler, move(str));
+		},
+
+		// Number
+		[](void* object, JsonHandler& handler, Number n)
+		{
+			auto& self = *static_cast<ValueMaker*>(object);
+
+			GenericObject::descriptor.extraSetter.
+				setNumber(&self.cache, handler, n);
+		},
+
+		// Boolean
+		[](void* object, JsonHandler& handler, Boolean b)
+		{
+			auto& self = *static_cast<ValueMaker*>(object);
+
+			GenericObject::descriptor.extraSetter.
+				setBoolean(&self.cache, handler, b);
+		},
+
+		// Null
+		[](void* object, JsonHandler& handler)
+		{
+			auto& self = *static_cast<ValueMaker*>(object);
+
+			GenericObject::descriptor.extraSetter.setNull(&self.cache, handler);
+		},
+
+		// Array
+		[](void* object, JsonHandler& handler)
+		{
+			auto& self = *static_cast<ValueMaker*>(object);
+
+			GenericObject::descriptor.extraSetter.setArray(&self.cache, handler);
+		},
+
+		// Object
+		[](void* object, JsonHandler& handler)
+		{
+			auto& self = *static_cast<ValueMaker*>(object);
+
+			GenericObject::descriptor.extraSetter.setObject(&self.cache, handler);
+		}
+	},
+
+	// Parents
+	{}
+};
+
+void ProgressParams::ValueMaker::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 void ProgressParams::partialWrite(JsonWriter &writer)
@@ -23,14 +23,14 @@ namespace clsp
 
 using namespace std;
 
-const String WorkspaceEdit::changesKey         = "changes";
-const String WorkspaceEdit::documentChangesKey = "documentChanges";
+constexpr string_view WorkspaceEdit::changesKey         = "changes";
+constexpr string_view WorkspaceEdit::documentChangesKey = "documentChanges";
 
 WorkspaceEdit::WorkspaceEdit(optional<Changes> changes,
 	optional<
 		variant<
-			vector<TextDocumentEdit>,
-			vector<
+			Vector<TextDocumentEdit>,
+			Vector<
 				variant<TextDocumentEdit, CreateFile, RenameFile, DeleteFile>
 			>
 		>
@@ -56,7 +56,7 @@ void WorkspaceEdit::partialWrite(JsonWriter &writer)
 	{
 		writer.Key(documentChangesKey);
 		visit(overload(
-			[&writer](vector<TextDocumentEdit>& vec)
+			[&writer](Vector<TextDocumentEdit>& vec)
 			{
 				writer.StartArray();
 				for(auto& i: vec)
@@ -65,7 +65,7 @@ void WorkspaceEdit::partialWrite(JsonWriter &writer)
 				}
 				writer.EndArray();
 			},
-			[&writer](vector<variant<TextDocumentEdit,
+			[&writer](Vector<variant<TextDocumentEdit,
 				CreateFile,
 				RenameFile,
 				DeleteFile>>& vec)
@@ -180,7 +180,7 @@ const FailureHandlingKind FailureHandlingKind::Abort = Kind::Abort,
 	FailureHandlingKind::Undo                        = Kind::Undo;
 
 
-WorkspaceEdit::Changes::Changes(map<DocumentUri, vector<TextEdit>> changes):
+WorkspaceEdit::Changes::Changes(Map<DocumentUri, Vector<TextEdit>> changes):
 	changes(changes)
 {};
 
@@ -188,18 +188,18 @@ WorkspaceEdit::Changes::Changes(){};
 WorkspaceEdit::Changes::~Changes(){};
 
 
-const String WorkspaceEditClientCapabilities::
+constexpr string_view WorkspaceEditClientCapabilities::
 	documentChangesKey    = "documentChanges";
 
-const String WorkspaceEditClientCapabilities::
+constexpr string_view WorkspaceEditClientCapabilities::
 	resourceOperationsKey = "resourceOperations";
 
-const String WorkspaceEditClientCapabilities::
+constexpr string_view WorkspaceEditClientCapabilities::
 	failureHandlingKey    = "failureHandling";
 
 WorkspaceEditClientCapabilities::
 	WorkspaceEditClientCapabilities(optional<Boolean> documentChanges,
-		optional<vector<ResourceOperationKind>> resourceOperations,
+		optional<Vector<ResourceOperationKind>> resourceOperations,
 		optional<FailureHandlingKind> failureHandling):
 			documentChanges(documentChanges),
 			resourceOperations(resourceOperations),
@@ -209,108 +209,126 @@ WorkspaceEditClientCapabilities::
 WorkspaceEditClientCapabilities::WorkspaceEditClientCapabilities(){};
 WorkspaceEditClientCapabilities::~WorkspaceEditClientCapabilities(){};
 
-void WorkspaceEditClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkspaceEditClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// documentChanges?:
-	setterMap.emplace(
+	{
+		// Key
 		documentChangesKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				documentChanges = b;
-			},
+			MemberSetter<&WorkspaceEditClientCapabilities::documentChanges>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// resourceOperations?:
-	setterMap.emplace(
+	{
+		// Key
 		resourceOperationsKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				resourceOperations.emplace();
-
-				handler->pushInitializer();
+				auto& self = *static_cast<WorkspaceEditClientCapabilities*>(object);
 
-				auto* maker = new ResourceOperationsMaker(resourceOperations.value());
-
-				maker->fillInitializer(handler->objectStack.top());
+				self.resourceOperations.emplace();
 
+				handler.pushMaker<ResourceOperationsMaker>(
+					self.resourceOperations.value());
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// failureHandling?:
-	setterMap.emplace(
+	{
+		// Key
 		failureHandlingKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			[this](String str)
-			{
-				failureHandling = str;
-			},
+			MemberSetter<&WorkspaceEditClientCapabilities::failureHandling>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkspaceEditClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
 
-	// This
-	initializer.object = this;
+void WorkspaceEditClientCapabilities::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 WorkspaceEditClientCapabilities::ResourceOperationsMaker::
-	ResourceOperationsMaker(vector<ResourceOperationKind> &parentArray):
+	ResourceOperationsMaker(Vector<ResourceOperationKind> &parentArray):
 		parentArray(parentArray)
 {};
 
@@ -318,43 +336,47 @@ WorkspaceEditClientCapabilities::ResourceOperationsMaker::
 	~ResourceOperationsMaker()
 {};
 
-void WorkspaceEditClientCapabilities::ResourceOperationsMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor WorkspaceEditClientCapabilities::ResourceOperationsMaker::
+	descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// ResourceOperationKind[]
-	extraSetter =
 	{
 		// String
-		[this](String str)
+		[](void* object, JsonHandler&, String&& str)
 		{
-			parentArray.emplace_back(str);
+			auto& self = *static_cast<ResourceOperationsMaker*>(object);
+
+			self.parentArray.emplace_back(move(str));
 		},
 
 		// Number
-		nullopt,
+		nullptr,
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void WorkspaceEditClientCapabilities::ResourceOperationsMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
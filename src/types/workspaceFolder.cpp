@@ -21,9 +21,9 @@ namespace clsp
 
 using namespace std;
 
-const String WorkspaceFoldersServerCapabilities::
+constexpr string_view WorkspaceFoldersServerCapabilities::
 	supportedKey           = "supported";
-const String WorkspaceFoldersServerCapabilities::
+constexpr string_view WorkspaceFoldersServerCapabilities::
 	changeNotificationsKey = "changeNotifications";
 
 WorkspaceFoldersServerCapabilities::
@@ -63,8 +63,8 @@ void WorkspaceFoldersServerCapabilities::partialWrite(JsonWriter &writer)
 }
 
 
-const String WorkspaceFolder::uriKey  = "uri";
-const String WorkspaceFolder::nameKey = "name";
+constexpr string_view WorkspaceFolder::uriKey  = "uri";
+constexpr string_view WorkspaceFolder::nameKey = "name";
 
 WorkspaceFolder::WorkspaceFolder(DocumentUri uri, String name):
 	uri(uri),
@@ -75,75 +75,84 @@ WorkspaceFolder::WorkspaceFolder(){};
 WorkspaceFolder::~WorkspaceFolder(){};
 
 
-void WorkspaceFolder::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkspaceFolder::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Value setters
-
 	// uri:
-	setterMap.emplace(
+	{
+		// Key
 		uriKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				uri = str;
-				neededMap[uriKey] = true;
-			},
+			MemberSetter<&WorkspaceFolder::uri>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// name:
-	setterMap.emplace(
+	{
+		// Key
 		nameKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				name = str;
-				neededMap[nameKey] = true;
-			},
+			MemberSetter<&WorkspaceFolder::name>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(uriKey, 0);
-	neededMap.emplace(nameKey, 0);
+constexpr ObjectDescriptor WorkspaceFolder::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{}
+};
+
+void WorkspaceFolder::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
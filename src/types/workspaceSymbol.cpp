@@ -21,10 +21,10 @@ namespace clsp
 
 using namespace std;
 
-const String WorkspaceSymbolClientCapabilities::
+constexpr string_view WorkspaceSymbolClientCapabilities::
 	dynamicRegistrationKey = "dynamicRegistration";
 
-const String WorkspaceSymbolClientCapabilities::
+constexpr string_view WorkspaceSymbolClientCapabilities::
 	symbolKindKey          = "symbolKind";
 
 WorkspaceSymbolClientCapabilities::
@@ -37,130 +37,156 @@ WorkspaceSymbolClientCapabilities::
 WorkspaceSymbolClientCapabilities::WorkspaceSymbolClientCapabilities(){};
 WorkspaceSymbolClientCapabilities::~WorkspaceSymbolClientCapabilities(){};
 
-void WorkspaceSymbolClientCapabilities::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkspaceSymbolClientCapabilities::fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// dynamicRegistration?:
-	setterMap.emplace(
+	{
+		// Key
 		dynamicRegistrationKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			[this](Boolean b)
-			{
-				dynamicRegistration = b;
-			},
+			MemberSetter<&WorkspaceSymbolClientCapabilities::dynamicRegistration>::fromBoolean,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	},
 
 	// symbolKind?:
-	setterMap.emplace(
+	{
+		// Key
 		symbolKindKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			[this, handler]()
-			{
-				symbolKind.emplace();
-
-				handler->pushInitializer();
-				symbolKind->fillInitializer(handler->objectStack.top());
-			}
+			MemberSetter<&WorkspaceSymbolClientCapabilities::symbolKind>::fromObject
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkspaceSymbolClientCapabilities::descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void WorkspaceSymbolClientCapabilities::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String WorkspaceSymbolClientCapabilities::SymbolKind::
+constexpr string_view WorkspaceSymbolClientCapabilities::SymbolKind::
 	valueSetKey = "valueSet";
 
 WorkspaceSymbolClientCapabilities::SymbolKind::
-	SymbolKind(optional<vector<clsp::SymbolKind>> valueSet):
+	SymbolKind(optional<Vector<clsp::SymbolKind>> valueSet):
 		valueSet(valueSet)
 {};
 
 WorkspaceSymbolClientCapabilities::SymbolKind::SymbolKind(){};
 WorkspaceSymbolClientCapabilities::SymbolKind::~SymbolKind(){};
 
-void WorkspaceSymbolClientCapabilities::SymbolKind::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkspaceSymbolClientCapabilities::SymbolKind::
+	fields[] =
 {
-	auto* handler = initializer.handler;
-
-	auto& setterMap = initializer.setterMap;
-
-	// Value setters
-
 	// valueSet?:
-	setterMap.emplace(
+	{
+		// Key
 		valueSetKey,
-		ValueSetter{
+
+		// Required
+		false,
+
+		// Setter
+		{
 			// String
-			nullopt,
+			nullptr,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			[this, handler]()
+			[](void* object, JsonHandler& handler)
 			{
-				valueSet.emplace();
+				auto& self = *static_cast<SymbolKind*>(object);
 
-				auto* maker = new ValueSetMaker(*this);
+				self.valueSet.emplace();
 
-				handler->pushInitializer();
-				maker->fillInitializer(handler->objectStack.top());
+				handler.pushMaker<ValueSetMaker>(self);
 			},
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
+
+constexpr ObjectDescriptor WorkspaceSymbolClientCapabilities::SymbolKind::
+	descriptor =
+{
+	// Fields
+	fields,
+
+	// Extra setter
+	{},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void WorkspaceSymbolClientCapabilities::SymbolKind::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 WorkspaceSymbolClientCapabilities::SymbolKind::ValueSetMaker::
@@ -172,31 +198,28 @@ WorkspaceSymbolClientCapabilities::SymbolKind::ValueSetMaker::
 	~ValueSetMaker()
 {};
 
-void WorkspaceSymbolClientCapabilities::SymbolKind::ValueSetMaker::
-	fillInitializer(ObjectInitializer& initializer)
+constexpr ObjectDescriptor WorkspaceSymbolClientCapabilities::SymbolKind::
+	ValueSetMaker::descriptor =
 {
-	// ObjectMaker
-	initializer.objectMaker = unique_ptr<ObjectT>(this);
-
-	auto& extraSetter = initializer.extraSetter;
-	auto& Vector = parent.valueSet.value();
-
-	// Value setters
+	// Fields
+	nullptr,
 
+	// Extra setter
 	// SymbolKind[]
-	extraSetter =
 	{
 		// String
-		nullopt,
+		nullptr,
 
 		// Number
-		[&Vector](Number n)
+		[](void* object, JsonHandler&, Number n)
 		{
+			auto& self = *static_cast<ValueSetMaker*>(object);
+
 			if(holds_alternative<int>(n))
 			{
 				int i = get<int>(n);
 
-				Vector.emplace_back((clsp::SymbolKind)i);
+				self.parent.valueSet->emplace_back((clsp::SymbolKind)i);
 			}
 
 			// Nothing is added by default
@@ -204,23 +227,29 @@ void WorkspaceSymbolClientCapabilities::SymbolKind::ValueSetMaker::
 		},
 
 		// Boolean
-		nullopt,
+		nullptr,
 
 		// Null
-		nullopt,
+		nullptr,
 
 		// Array
-		nullopt,
+		nullptr,
 
 		// Object
-		nullopt
-	};
+		nullptr
+	},
 
-	// This
-	initializer.object = this;
+	// Parents
+	{}
+};
+
+void WorkspaceSymbolClientCapabilities::SymbolKind::ValueSetMaker::
+	fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
-const String WorkspaceSymbolParams::queryKey = "query";
+constexpr string_view WorkspaceSymbolParams::queryKey = "query";
 
 WorkspaceSymbolParams::WorkspaceSymbolParams(
 	optional<ProgressToken> workDoneToken,
@@ -234,50 +263,64 @@ WorkspaceSymbolParams::WorkspaceSymbolParams(
 WorkspaceSymbolParams::WorkspaceSymbolParams(){};
 WorkspaceSymbolParams::~WorkspaceSymbolParams(){};
 
-void WorkspaceSymbolParams::fillInitializer(ObjectInitializer& initializer)
+constexpr FieldDescriptor WorkspaceSymbolParams::fields[] =
 {
-	auto& setterMap = initializer.setterMap;
-	auto& neededMap = initializer.neededMap;
-
-	// Parents
-	WorkDoneProgressParams::fillInitializer(initializer);
-	PartialResultParams::fillInitializer(initializer);
-
-	// Value setters
-
 	// query:
-	setterMap.emplace(
+	{
+		// Key
 		queryKey,
-		ValueSetter{
+
+		// Required
+		true,
+
+		// Setter
+		{
 			// String
-			[this, &neededMap](String str)
-			{
-				query = str;
-				neededMap[queryKey] = true;
-			},
+			MemberSetter<&WorkspaceSymbolParams::query>::fromString,
 
 			// Number
-			nullopt,
+			nullptr,
 
 			// Boolean
-			nullopt,
+			nullptr,
 
 			// Null
-			nullopt,
+			nullptr,
 
 			// Array
-			nullopt,
+			nullptr,
 
 			// Object
-			nullopt
+			nullptr
 		}
-	);
+	}
+};
 
-	// Needed members
-	neededMap.emplace(queryKey, 0);
+constexpr ObjectDescriptor WorkspaceSymbolParams::descriptor =
+{
+	// Fields
+	fields,
 
-	// This
-	initializer.object = this;
+	// Extra setter
+	{},
+
+	// Parents
+	{
+		{
+			&WorkDoneProgressParams::descriptor,
+			upcast<WorkspaceSymbolParams, WorkDoneProgressParams>
+		},
+
+		{
+			&PartialResultParams::descriptor,
+			upcast<WorkspaceSymbolParams, PartialResultParams>
+		}
+	}
+};
+
+void WorkspaceSymbolParams::fillInitializer(ObjectInitializer& initializer)
+{
+	initializer.bind(this, descriptor);
 }
 
 }
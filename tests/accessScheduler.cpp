@@ -0,0 +1,244 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <libclsp/server/accessScheduler.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// An AccessScheduler with its pool
+struct Handlers
+{
+	ThreadPool pool;
+	PriorityScheduler scheduler;
+	TaskGroup group;
+	AccessScheduler access;
+
+	Handlers(size_t workers):
+		pool(workers),
+		scheduler(pool, chrono::milliseconds(50), 1),
+		group(pool),
+		access(scheduler, group)
+	{};
+};
+
+/// Waits until a flag is set
+static void waitFor(const atomic<bool>& flag)
+{
+	while(!flag)
+	{
+		this_thread::yield();
+	}
+}
+
+/// The writes of a document run in the order they were submitted, and after
+/// the reads before them
+static void testWriteOrder()
+{
+	Handlers handlers(8);
+
+	mutex orderMutex;
+	string order;
+
+	atomic<bool> open{false};
+
+	// The reads hold the document until the writes were submitted
+	for(char name: string("rs"))
+	{
+		handlers.access.submit([&, name]()
+		{
+			waitFor(open);
+
+			lock_guard lock(orderMutex);
+			order += name;
+		}, Priority::normal, Access::read, String("file:///a"));
+	}
+
+	for(char name: string("abcdefgh"))
+	{
+		handlers.access.submit([&, name]()
+		{
+			lock_guard lock(orderMutex);
+			order += name;
+		}, Priority::normal, Access::write, String("file:///a"));
+	}
+
+	open = true;
+
+	handlers.group.wait();
+
+	CHECK(order == "rsabcdefgh" || order == "srabcdefgh");
+}
+
+/// Reads of a document run together, and so do the handlers of different
+/// documents
+static void testParallel()
+{
+	Handlers handlers(4);
+
+	atomic<size_t> running{0};
+
+	// Each handler only ends when the other one is running
+	auto together = [&running]()
+	{
+		running++;
+
+		while(running < 2)
+		{
+			this_thread::yield();
+		}
+	};
+
+	handlers.access.submit(together, Priority::normal, Access::read,
+		String("file:///a"));
+	handlers.access.submit(together, Priority::normal, Access::read,
+		String("file:///a"));
+
+	handlers.group.wait();
+
+	running = 0;
+
+	handlers.access.submit(together, Priority::normal, Access::write,
+		String("file:///a"));
+	handlers.access.submit(together, Priority::normal, Access::write,
+		String("file:///b"));
+
+	handlers.group.wait();
+}
+
+/// A handler of the workspace waits for the handlers of every document
+/// before it, and the ones after it wait for it
+static void testWorkspace()
+{
+	Handlers handlers(8);
+
+	mutex orderMutex;
+	string order;
+
+	atomic<bool> open{false};
+
+	auto record = [&](char name)
+	{
+		return [&, name]()
+		{
+			waitFor(open);
+
+			lock_guard lock(orderMutex);
+			order += name;
+		};
+	};
+
+	handlers.access.submit(record('a'), Priority::normal, Access::write,
+		String("file:///a"));
+	handlers.access.submit(record('b'), Priority::normal, Access::read,
+		String("file:///b"));
+	handlers.access.submit(record('W'), Priority::normal, Access::write,
+		nullopt);
+	handlers.access.submit(record('c'), Priority::normal, Access::read,
+		String("file:///c"));
+
+	open = true;
+
+	handlers.group.wait();
+
+	CHECK(order == "abWc" || order == "baWc");
+}
+
+/// Many random handlers never run at the same time as one they conflict
+/// with
+static void testExclusion()
+{
+	Handlers handlers(8);
+
+	// The running readers and writers of each document, "" is the workspace
+	mutex usersMutex;
+	map<string, pair<size_t, size_t>> users;
+
+	atomic<size_t> conflicts{0};
+
+	mt19937 random(1);
+
+	for(size_t i = 0; i < 5000; i++)
+	{
+		string document = random() % 5 == 0 ?
+			string() :
+			string(1, (char)('a' + random() % 3));
+
+		bool write = random() % 3 == 0;
+
+		auto check = [&users, &conflicts, document, write]()
+		{
+			// Anything conflicts with a write, and a write with anything
+			for(auto& [used, count]: users)
+			{
+				bool overlaps = document.empty() || used.empty() ||
+					used == document;
+
+				if(overlaps && (count.first > 0 || (write && count.second > 0)))
+				{
+					conflicts++;
+				}
+			}
+		};
+
+		handlers.access.submit([&, document, write, check]()
+		{
+			{
+				lock_guard lock(usersMutex);
+
+				check();
+
+				auto& count = users[document];
+				(write ? count.first : count.second)++;
+			}
+
+			this_thread::sleep_for(chrono::microseconds(10));
+
+			lock_guard lock(usersMutex);
+
+			auto& count = users[document];
+			(write ? count.first : count.second)--;
+		},
+		Priority::normal,
+		write ? Access::write : Access::read,
+		document.empty() ? nullopt : optional<String>(document));
+	}
+
+	handlers.group.wait();
+
+	CHECK(conflicts == 0);
+}
+
+int main()
+{
+	testWriteOrder();
+	testParallel();
+	testWorkspace();
+	testExclusion();
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <thread>
+
+#include <libclsp/server/cancellationToken.hpp>
+#include <libclsp/types/responseMessage.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// Copies share the flag, and the first reason stays
+static void testReasons()
+{
+	CancellationToken token;
+	CancellationToken copy = token;
+
+	CHECK(!token.isCancelled());
+	token.throwIfCancelled();
+
+	copy.cancel();
+
+	CHECK(token.isCancelled());
+	CHECK(token.reason() == ErrorCodes::RequestCancelled);
+
+	// A change after the cancellation doesn't change the answer
+	token.supersede();
+
+	CHECK(copy.reason() == ErrorCodes::RequestCancelled);
+
+	CancellationToken superseded;
+
+	superseded.supersede();
+	superseded.cancel();
+
+	CHECK(superseded.reason() == ErrorCodes::ContentModified);
+	CHECK(superseded.error().code == ErrorCodes::ContentModified);
+	CHECK(token.error().code == ErrorCodes::RequestCancelled);
+}
+
+/// A cancelled handler stops with the error of its token
+static void testThrow()
+{
+	CancellationToken token;
+
+	token.supersede();
+
+	bool thrown = false;
+
+	try
+	{
+		token.throwIfCancelled();
+	}
+	catch(const ResponseError& error)
+	{
+		thrown = error.code == ErrorCodes::ContentModified;
+	}
+
+	CHECK(thrown);
+}
+
+/// The current token is the one of the innermost scope of the thread
+static void testScopes()
+{
+	CancellationToken outer;
+	CancellationToken inner;
+
+	inner.cancel();
+
+	CHECK(!CancellationToken::current().isCancelled());
+
+	{
+		CancellationScope outerScope(outer);
+
+		CHECK(!CancellationToken::current().isCancelled());
+
+		{
+			CancellationScope innerScope(inner);
+
+			CHECK(CancellationToken::current().isCancelled());
+
+			// Other threads have their own
+			thread([]()
+			{
+				CHECK(!CancellationToken::current().isCancelled());
+			}).join();
+		}
+
+		CHECK(!CancellationToken::current().isCancelled());
+
+		// A copy that a subtask keeps sees a later cancellation
+		CancellationToken subtask = CancellationToken::current();
+
+		outer.supersede();
+
+		CHECK(subtask.reason() == ErrorCodes::ContentModified);
+	}
+
+	CHECK(!CancellationToken::current().isCancelled());
+}
+
+int main()
+{
+	testReasons();
+	testThrow();
+	testScopes();
+
+	return 0;
+}
@@ -0,0 +1,33 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+/// Ends the test if a condition is false, with where it was checked
+#define CHECK(condition) \
+	do \
+	{ \
+		if(!(condition)) \
+		{ \
+			fprintf(stderr, "%s:%d: CHECK(%s) failed\n", \
+				__FILE__, __LINE__, #condition); \
+			exit(1); \
+		} \
+	} \
+	while(false)
@@ -0,0 +1,202 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <unistd.h>
+
+#include <libclsp/server.hpp>
+#include <libclsp/types.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// Adds the Content-Length header to a json
+static string frame(const string& json)
+{
+	return "Content-Length: " + to_string(json.size()) + "\r\n\r\n" + json;
+}
+
+/// A didChange of a document with one change.
+/// A change without a range has the full text.
+static string didChange(const string& uri,
+	int version,
+	const string& text,
+	int start = -1,
+	int end = -1)
+{
+	string range;
+
+	if(start >= 0)
+	{
+		range = R"("range":{"start":{"line":0,"character":)" +
+			to_string(start) + R"(},"end":{"line":0,"character":)" +
+			to_string(end) + "}},";
+	}
+
+	return frame(
+		R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":{)"
+		R"("textDocument":{"uri":")" + uri + R"(","version":)" +
+		to_string(version) + R"(},"contentChanges":[{)" + range +
+		R"("text":")" + text + R"("}]}})");
+}
+
+/// The documents as the handlers see them, with one line each
+struct Documents
+{
+	mutex documentsMutex;
+
+	map<string, string> texts;
+
+	map<string, int> versions;
+
+	/// The didChange notifications that the handler got
+	size_t changes = 0;
+
+	/// The text of file:///a when the hover ran
+	string hovered;
+
+	void change(DidChangeTextDocumentParams& params)
+	{
+		lock_guard lock(documentsMutex);
+
+		string uri(params.textDocument.uri.data(),
+			params.textDocument.uri.size());
+
+		string& text = texts[uri];
+
+		for(auto& event: params.contentChanges)
+		{
+			string eventText(event.text.data(), event.text.size());
+
+			if(!event.range.has_value())
+			{
+				text = eventText;
+				continue;
+			}
+
+			size_t start = get<int>(event.range->start.character);
+			size_t end   = get<int>(event.range->end.character);
+
+			text.replace(start, end - start, eventText);
+		}
+
+		versions[uri] = get<int>(get<Number>(params.textDocument.version));
+
+		changes++;
+	}
+};
+
+int main()
+{
+	// A handler that never runs fails by the alarm
+	alarm(30);
+
+	Server server;
+
+	server.coalesceChanges = true;
+
+	Documents documents;
+
+	server.addCapability(Methods::initialize.handle(
+		[](InitializeParams&)
+		{
+			return InitializeResult();
+		}));
+
+	server.addCapability(Methods::textDocumentDidChange.handle(
+		[&documents](DidChangeTextDocumentParams& params)
+		{
+			documents.change(params);
+		}));
+
+	server.addCapability(Methods::textDocumentHover.handle(
+		[&documents](HoverParams&) -> variant<Hover, Null>
+		{
+			lock_guard lock(documents.documentsMutex);
+
+			documents.hovered = documents.texts["file:///a"];
+
+			return Null();
+		}));
+
+	// The whole input is queued before the server starts, so the changes
+	// that follow each other are merged
+	string input =
+		frame(R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{)"
+			R"("processId":null,"rootUri":null,"capabilities":{}}})") +
+		didChange("file:///a", 1, "hello") +
+		didChange("file:///a", 2, " world", 5, 5) +
+		// Another document stops the merge
+		didChange("file:///b", 1, "other") +
+		didChange("file:///a", 3, "HELLO", 0, 5) +
+		// So does a request, it sees the changes before it
+		frame(R"({"jsonrpc":"2.0","id":2,"method":"textDocument/hover",)"
+			R"("params":{"textDocument":{"uri":"file:///a"},)"
+			R"("position":{"line":0,"character":0}}})") +
+		didChange("file:///a", 4, "reset! ", 0, 0) +
+		// The full text drops the changes before it
+		didChange("file:///a", 5, "reset") +
+		didChange("file:///a", 6, "!", 5, 5) +
+		didChange("file:///a", 7, "R", 0, 1) +
+		frame(R"({"jsonrpc":"2.0","method":"exit"})");
+
+	int in[2];
+	int out[2];
+
+	CHECK(pipe(in) == 0);
+	CHECK(pipe(out) == 0);
+
+	// It fits in the buffer of the pipe
+	CHECK(write(in[1], input.data(), input.size()) == (ssize_t)input.size());
+
+	// It returns after the exit notification
+	server.startIO(in[0], out[1]);
+
+	close(out[1]);
+
+	string output;
+	char buffer[4096];
+	ssize_t n;
+
+	while((n = read(out[0], buffer, sizeof(buffer))) > 0)
+	{
+		output.append(buffer, n);
+	}
+
+	lock_guard lock(documents.documentsMutex);
+
+	CHECK(documents.texts["file:///a"] == "Reset!");
+	CHECK(documents.texts["file:///b"] == "other");
+	CHECK(documents.versions["file:///a"] == 7);
+	CHECK(documents.versions["file:///b"] == 1);
+	CHECK(documents.hovered == "HELLO world");
+
+	// At least the merges that the other messages stop
+	CHECK(documents.changes >= 4 && documents.changes <= 8);
+
+	CHECK(output.find(R"("id":2)") != string::npos);
+
+	close(in[0]);
+	close(in[1]);
+	close(out[0]);
+
+	return 0;
+}
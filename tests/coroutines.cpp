@@ -0,0 +1,220 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include <libclsp/server.hpp>
+#include <libclsp/server/task.hpp>
+#include <libclsp/types.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// Adds the Content-Length header to a json
+static string frame(const string& json)
+{
+	return "Content-Length: " + to_string(json.size()) + "\r\n\r\n" + json;
+}
+
+/// A client that answers the configuration requests of the server
+class Client
+{
+private:
+	/// The input of the server
+	int input;
+
+	/// The output of the server
+	int output;
+
+	mutex inputMutex;
+
+	thread readerThread;
+
+	/// Reads the messages of the server
+	void readMessages()
+	{
+		string pending;
+		char buffer[4096];
+		ssize_t n;
+
+		while((n = read(output, buffer, sizeof(buffer))) > 0)
+		{
+			pending.append(buffer, n);
+
+			size_t headerEnd;
+
+			while((headerEnd = pending.find("\r\n\r\n")) != string::npos)
+			{
+				size_t length = stoul(pending.substr(16, headerEnd - 16));
+
+				if(pending.size() < headerEnd + 4 + length)
+				{
+					break;
+				}
+
+				receive(pending.substr(headerEnd + 4, length));
+
+				pending.erase(0, headerEnd + 4 + length);
+			}
+		}
+	}
+
+	/// Answers a request or keeps a response
+	void receive(const string& json)
+	{
+		if(json.find("\"method\":\"workspace/configuration\"") != string::npos)
+		{
+			size_t id = json.find("\"id\":") + 5;
+
+			configurationRequests++;
+
+			send(R"({"jsonrpc":"2.0","id":)" +
+				json.substr(id, json.find_first_of(",}", id) - id) +
+				R"(,"result":[{"answer":42}]})");
+		}
+		else if(json.find("\"id\":2") != string::npos)
+		{
+			{
+				lock_guard lock(hoverMutex);
+				hover = json;
+			}
+
+			send(R"({"jsonrpc":"2.0","method":"exit"})");
+		}
+	}
+
+public:
+	/// The response of the hover
+	string hover;
+
+	mutex hoverMutex;
+
+	atomic<size_t> configurationRequests{0};
+
+	Client(int input, int output):
+		input(input),
+		output(output),
+		readerThread(&Client::readMessages, this)
+	{};
+
+	virtual ~Client()
+	{
+		readerThread.join();
+	}
+
+	void send(const string& json)
+	{
+		lock_guard lock(inputMutex);
+
+		string message = frame(json);
+
+		CHECK(write(input, message.data(), message.size()) ==
+			(ssize_t)message.size());
+	}
+};
+
+int main()
+{
+	// A coroutine that never resumes fails by the alarm
+	alarm(30);
+
+	Server server;
+
+	atomic<size_t> steps{0};
+
+	server.addCapability(Methods::initialize.handle(
+		[](InitializeParams&)
+		{
+			return InitializeResult();
+		}));
+
+	server.addCapability(handleTask(Methods::textDocumentHover,
+		[&server, &steps](HoverParams&) -> Task<variant<Hover, Null>>
+		{
+			co_await yieldTo(server);
+			steps++;
+
+			co_await sleepFor(server, chrono::milliseconds(5));
+			steps++;
+
+			Vector<ConfigurationItem> items;
+
+			items.emplace_back(nullopt, String("test"));
+
+			ClientResponse response = co_await server.sendRequest(
+				Capability::workspaceConfiguration,
+				any(ConfigurationParams(move(items))));
+			steps++;
+
+			if(response.error.has_value())
+			{
+				throw *response.error;
+			}
+
+			CHECK(response.result.has_value());
+			CHECK(any_cast<Array&>(*response.result).size() == 1);
+
+			co_return Hover(MarkupContent(MarkupKind::PlainText, "configured"),
+				nullopt);
+		}));
+
+	int input[2];
+	int output[2];
+
+	CHECK(pipe(input) == 0);
+	CHECK(pipe(output) == 0);
+
+	{
+		Client client(input[1], output[0]);
+
+		client.send(
+			R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{)"
+			R"("processId":null,"rootUri":null,"capabilities":{}}})");
+
+		client.send(
+			R"({"jsonrpc":"2.0","id":2,"method":"textDocument/hover",)"
+			R"("params":{"textDocument":{"uri":"file:///test.cpp"},)"
+			R"("position":{"line":0,"character":0}}})");
+
+		// It returns after the exit notification
+		server.startIO(input[0], output[1]);
+
+		// The client reads until the output ends
+		close(output[1]);
+
+		CHECK(steps == 3);
+		CHECK(client.configurationRequests == 1);
+
+		lock_guard lock(client.hoverMutex);
+
+		CHECK(client.hover.find("\"result\"") != string::npos);
+		CHECK(client.hover.find("configured") != string::npos);
+	}
+
+	close(input[0]);
+	close(input[1]);
+	close(output[0]);
+
+	return 0;
+}
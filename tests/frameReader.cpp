@@ -0,0 +1,167 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <libclsp/server/frameReader.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// A reader of an input in memory, at most some bytes each time
+class MemoryReader: public FrameReader
+{
+private:
+	string input;
+
+	size_t offset = 0;
+
+	size_t readSize;
+
+protected:
+	ssize_t readSome(char* buffer, size_t length) override
+	{
+		CHECK(inChunk(buffer, length));
+
+		size_t n = min({length, readSize, input.size() - offset});
+
+		memcpy(buffer, input.data() + offset, n);
+
+		offset += n;
+
+		return n;
+	}
+
+public:
+	MemoryReader(string input, size_t readSize):
+		FrameReader(-1),
+		input(move(input)),
+		readSize(readSize)
+	{};
+};
+
+/// A message with its header
+static string frame(const string& json)
+{
+	return "Content-Length: " + to_string(json.size()) + "\r\n\r\n" + json;
+}
+
+/// Reads every message of an input
+static vector<string> readAll(string input, size_t readSize)
+{
+	MemoryReader reader(move(input), readSize);
+
+	vector<string> messages;
+
+	while(reader.read() > 0)
+	{
+		while(auto message = reader.next())
+		{
+			CHECK(message->data[message->length] == '\0');
+
+			messages.emplace_back(message->data, message->length);
+		}
+	}
+
+	CHECK(!reader.failed());
+
+	return messages;
+}
+
+/// A json of some length
+static string json(size_t length, char fill)
+{
+	return "\"" + string(length - 2, fill) + "\"";
+}
+
+/// A message bigger than a chunk grows the chunk to fit it exactly, so it
+/// ends with the chunk
+static void testMessageOfChunkSize()
+{
+	string big   = json(2 * FrameReader::defaultChunkSize, 'a');
+	string small = json(16, 'b');
+
+	auto messages = readAll(frame(big) + frame(small), FrameReader::defaultChunkSize);
+
+	CHECK(messages.size() == 2);
+	CHECK(messages[0] == big);
+	CHECK(messages[1] == small);
+}
+
+/// Messages that fill the first chunk exactly
+static void testMessagesThatFillTheChunk()
+{
+	vector<string> sent;
+	string input;
+
+	// Small messages and a last one that ends with the chunk
+	while(input.size() + 1024 < FrameReader::defaultChunkSize)
+	{
+		sent.push_back(json(256, 'd'));
+		input += frame(sent.back());
+	}
+
+	size_t left   = FrameReader::defaultChunkSize - input.size();
+	size_t length = left - frame("").size();
+
+	// The digits of the length are part of the header
+	while(frame(json(length, 'e')).size() > left)
+	{
+		length--;
+	}
+
+	sent.push_back(json(length, 'e'));
+	input += frame(sent.back());
+
+	CHECK(input.size() == FrameReader::defaultChunkSize);
+
+	sent.push_back(json(16, 'f'));
+	input += frame(sent.back());
+
+	CHECK(readAll(input, FrameReader::defaultChunkSize) == sent);
+}
+
+/// Messages split across reads of every size
+static void testSplitMessages()
+{
+	vector<string> sent;
+	string input;
+
+	for(size_t i = 2; i < 300; i += 7)
+	{
+		sent.push_back(json(i, 'g'));
+		input += frame(sent.back());
+	}
+
+	for(size_t readSize: {1, 2, 3, 17, 4096})
+	{
+		CHECK(readAll(input, readSize) == sent);
+	}
+}
+
+int main()
+{
+	testMessageOfChunkSize();
+	testMessagesThatFillTheChunk();
+	testSplitMessages();
+
+	return 0;
+}
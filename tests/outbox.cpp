@@ -0,0 +1,151 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <libclsp/server/outbox.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// The messages that are queued, in the order of the writer
+static string popAll(Outbox<string>& outbox)
+{
+	string order;
+	string message;
+
+	outbox.close();
+
+	while(outbox.pop(message))
+	{
+		order += message;
+	}
+
+	return order;
+}
+
+/// A newer message with a key replaces the queued one in its place
+static void testKeyReplacement()
+{
+	Outbox<string> outbox;
+
+	outbox.push("a", Priority::normal, 1, "file:///a");
+	outbox.push("b", Priority::normal, 1, "file:///b");
+	outbox.push("c", Priority::normal, 1);
+	outbox.push("A", Priority::normal, 3, "file:///a");
+	outbox.push("d", Priority::normal, 1);
+	outbox.push("B", Priority::normal, 5, "file:///b");
+
+	CHECK(outbox.pendingBytes() == 3 + 5 + 1 + 1);
+	CHECK(popAll(outbox) == "ABcd");
+	CHECK(outbox.pendingBytes() == 0);
+}
+
+/// A key that was taken by the writer is queued again at the end
+static void testKeyAfterPop()
+{
+	Outbox<string> outbox;
+	string message;
+
+	outbox.push("a", Priority::normal, 1, "token");
+	outbox.push("b", Priority::normal, 1);
+
+	CHECK(outbox.pop(message) && message == "a");
+
+	outbox.push("A", Priority::normal, 1, "token");
+	outbox.push("c", Priority::normal, 1);
+	outbox.push("Z", Priority::normal, 1, "token");
+
+	CHECK(popAll(outbox) == "bZc");
+}
+
+/// A lane is only taken when the ones before it are empty, and a key
+/// replaces its message in the lane where it was queued
+static void testLanes()
+{
+	Outbox<string> outbox;
+
+	outbox.push("b", Priority::background, 1);
+	outbox.push("n", Priority::normal, 1, "key");
+	outbox.push("i", Priority::interactive, 1);
+	outbox.push("N", Priority::interactive, 1, "key");
+	outbox.push("j", Priority::interactive, 1);
+
+	CHECK(popAll(outbox) == "ijNb");
+}
+
+/// The producers wait while the queued bytes are over the limit
+static void testThrottle()
+{
+	Outbox<string> outbox;
+
+	// Under the limit it doesn't wait
+	outbox.push("a", Priority::normal, 10);
+	outbox.throttle(10);
+	outbox.throttle(0);
+
+	outbox.push("b", Priority::normal, 10);
+
+	atomic<bool> passed{false};
+
+	thread producer([&outbox, &passed]()
+	{
+		outbox.throttle(10);
+		passed = true;
+	});
+
+	this_thread::sleep_for(chrono::milliseconds(20));
+
+	CHECK(!passed);
+
+	string message;
+
+	CHECK(outbox.pop(message) && message == "a");
+
+	producer.join();
+
+	CHECK(passed);
+	CHECK(outbox.pendingBytes() == 10);
+
+	// Closing wakes a producer that waits
+	outbox.push("c", Priority::normal, 10);
+
+	thread closed([&outbox]()
+	{
+		outbox.throttle(10);
+	});
+
+	this_thread::sleep_for(chrono::milliseconds(20));
+
+	CHECK(popAll(outbox) == "bc");
+
+	closed.join();
+}
+
+int main()
+{
+	testKeyReplacement();
+	testKeyAfterPop();
+	testLanes();
+	testThrottle();
+
+	return 0;
+}
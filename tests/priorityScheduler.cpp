@@ -0,0 +1,214 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <libclsp/server/priorityScheduler.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// Runs tasks in a scheduler and writes the order in which they ran
+struct Recorder
+{
+	PriorityScheduler& scheduler;
+
+	mutex orderMutex;
+	string order;
+
+	atomic<size_t> submitted{0};
+	atomic<size_t> finished{0};
+
+	Recorder(PriorityScheduler& scheduler):
+		scheduler(scheduler)
+	{};
+
+	/// A task that writes its name
+	void submit(char name, Priority priority)
+	{
+		submitted++;
+
+		scheduler.submit([this, name]()
+		{
+			{
+				lock_guard lock(orderMutex);
+				order += name;
+			}
+
+			finished++;
+		}, priority);
+	}
+
+	/// Blocks the workers with tasks until the returned flag is set
+	shared_ptr<atomic<bool>> block(size_t workers)
+	{
+		auto open    = make_shared<atomic<bool>>(false);
+		auto running = make_shared<atomic<size_t>>(0);
+
+		for(size_t i = 0; i < workers; i++)
+		{
+			submitted++;
+
+			scheduler.submit([this, open, running]()
+			{
+				(*running)++;
+
+				while(!*open)
+				{
+					this_thread::yield();
+				}
+
+				finished++;
+			}, Priority::normal);
+		}
+
+		while(*running < workers)
+		{
+			this_thread::yield();
+		}
+
+		return open;
+	}
+
+	/// Waits for every task
+	void wait()
+	{
+		while(finished < submitted)
+		{
+			this_thread::yield();
+		}
+	}
+};
+
+/// With every worker reserved a background request doesn't run while an
+/// interactive one waits
+static void testEveryWorkerReserved()
+{
+	ThreadPool pool(1);
+	PriorityScheduler scheduler(pool, chrono::hours(1), 1);
+	Recorder recorder(scheduler);
+
+	auto open = recorder.block(1);
+
+	recorder.submit('b', Priority::background);
+	recorder.submit('i', Priority::interactive);
+
+	*open = true;
+	recorder.wait();
+
+	CHECK(recorder.order == "ib");
+
+	// Alone, it still runs
+	recorder.submit('b', Priority::background);
+	recorder.wait();
+
+	CHECK(recorder.order == "ibb");
+}
+
+/// An old background request goes before newer normal ones, never before
+/// an interactive one
+static void testAging()
+{
+	ThreadPool pool(1);
+	PriorityScheduler scheduler(pool, chrono::milliseconds(1), 0);
+	Recorder recorder(scheduler);
+
+	auto open = recorder.block(1);
+
+	recorder.submit('b', Priority::background);
+
+	this_thread::sleep_for(chrono::milliseconds(20));
+
+	recorder.submit('n', Priority::normal);
+	recorder.submit('i', Priority::interactive);
+
+	*open = true;
+	recorder.wait();
+
+	CHECK(recorder.order == "ibn");
+}
+
+/// Without aging the order is by priority and then by input
+static void testPriorities()
+{
+	ThreadPool pool(1);
+	PriorityScheduler scheduler(pool, chrono::hours(1), 0);
+	Recorder recorder(scheduler);
+
+	auto open = recorder.block(1);
+
+	recorder.submit('b', Priority::background);
+	recorder.submit('n', Priority::normal);
+	recorder.submit('i', Priority::interactive);
+	recorder.submit('m', Priority::normal);
+	recorder.submit('j', Priority::interactive);
+
+	*open = true;
+	recorder.wait();
+
+	CHECK(recorder.order == "ijnmb");
+}
+
+/// Background requests don't use the reserved workers
+static void testBackgroundLimit()
+{
+	ThreadPool pool(3);
+	PriorityScheduler scheduler(pool, chrono::hours(1), 1);
+
+	atomic<size_t> running{0};
+	atomic<size_t> most{0};
+	atomic<size_t> finished{0};
+
+	for(size_t i = 0; i < 32; i++)
+	{
+		scheduler.submit([&]()
+		{
+			size_t now = ++running;
+
+			for(size_t seen = most; seen < now && !most.compare_exchange_weak(seen, now);)
+			{
+			}
+
+			this_thread::sleep_for(chrono::microseconds(200));
+
+			running--;
+			finished++;
+		}, Priority::background);
+	}
+
+	while(finished < 32)
+	{
+		this_thread::yield();
+	}
+
+	CHECK(most <= 2);
+}
+
+int main()
+{
+	testEveryWorkerReserved();
+	testAging();
+	testPriorities();
+	testBackgroundLimit();
+
+	return 0;
+}
@@ -0,0 +1,204 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <libclsp/server/requestTable.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// The method of an integer id, to check that the entry is the right one
+static MethodId methodOf(int id)
+{
+	return (MethodId)id * 7 + 1;
+}
+
+/// Every id that wasn't erased is found after the others move back
+static void testProbing()
+{
+	RequestTable table;
+	map<int, MethodId> expected;
+
+	mt19937 random(5489);
+	uniform_int_distribution<int> ids(-2000, 2000);
+
+	for(size_t i = 0; i < 20000; i++)
+	{
+		int id = ids(random);
+
+		if(random() % 3 == 0)
+		{
+			optional<RequestTable::Entry> erased = table.erase(Number(id));
+
+			auto found = expected.find(id);
+
+			CHECK(erased.has_value() == (found != expected.end()));
+
+			if(found != expected.end())
+			{
+				CHECK(erased->method == found->second);
+				expected.erase(found);
+			}
+		}
+		else
+		{
+			table.insert(Number(id), {methodOf(id) + (MethodId)i, nullopt});
+			expected[id] = methodOf(id) + (MethodId)i;
+		}
+	}
+
+	for(int id = -2000; id <= 2000; id++)
+	{
+		auto found = expected.find(id);
+
+		CHECK(table.contains(Number(id)) == (found != expected.end()));
+
+		optional<RequestTable::Entry> entry = table.find(Number(id));
+
+		CHECK(entry.has_value() == (found != expected.end()));
+
+		if(entry.has_value())
+		{
+			CHECK(entry->method == found->second);
+		}
+	}
+}
+
+/// The ids made by issue() that don't fit in their slot go to the shards
+static void testIssuedFallback()
+{
+	RequestTable table;
+
+	// The last ones share the slots of the first ones
+	vector<int> ids;
+
+	for(int i = 0; i < 300; i++)
+	{
+		ids.push_back(table.issue(methodOf(i)));
+	}
+
+	for(int i = 0; i < 300; i++)
+	{
+		CHECK(ids[i] == i + 1);
+		CHECK(table.contains(Number(ids[i])));
+		CHECK(table.find(Number(ids[i]))->method == methodOf(i));
+	}
+
+	// The ones in the shards are erased first, then the ones in the slots
+	for(int i = 299; i >= 0; i--)
+	{
+		optional<RequestTable::Entry> entry = table.erase(Number(ids[i]));
+
+		CHECK(entry.has_value());
+		CHECK(entry->method == methodOf(i));
+
+		CHECK(!table.contains(Number(ids[i])));
+		CHECK(!table.erase(Number(ids[i])).has_value());
+	}
+
+	// A stale id doesn't match the new id of its slot
+	int id = table.issue(methodOf(1000));
+
+	CHECK(id == 301);
+	CHECK(!table.find(Number(301 - 256)).has_value());
+	CHECK(!table.contains(Number(301 - 256)));
+	CHECK(!table.erase(Number(301 - 256)).has_value());
+	CHECK(table.erase(Number(301))->method == methodOf(1000));
+
+	// Ids that issue() never makes
+	CHECK(!table.find(Number(0)).has_value());
+	CHECK(!table.find(Number(-1)).has_value());
+}
+
+/// Strings and numbers that aren't integers are kept apart from the integers
+static void testOtherIds()
+{
+	RequestTable table;
+
+	table.insert(String("1"), {1, nullopt});
+	table.insert(Number(1.5), {2, nullopt});
+	table.insert(Number(1), {3, nullopt});
+
+	CHECK(table.find(String("1"))->method == 1);
+	CHECK(table.find(Number(1.5))->method == 2);
+	CHECK(table.find(Number(1))->method == 3);
+
+	// A second insert replaces the request
+	table.insert(String("1"), {4, nullopt});
+	table.insert(Number(1.5), {5, nullopt});
+
+	CHECK(table.erase(String("1"))->method == 4);
+	CHECK(table.erase(Number(1.5))->method == 5);
+
+	CHECK(!table.contains(String("1")));
+	CHECK(!table.contains(Number(1.5)));
+	CHECK(!table.contains(String("2")));
+	CHECK(table.contains(Number(1)));
+}
+
+/// Many threads issue and erase ids, each one finds its own
+static void testConcurrentIssue()
+{
+	RequestTable table;
+	vector<thread> threads;
+
+	for(size_t t = 0; t < 4; t++)
+	{
+		threads.emplace_back([&table, t]()
+		{
+			vector<int> ids;
+
+			for(size_t round = 0; round < 50; round++)
+			{
+				for(size_t i = 0; i < 100; i++)
+				{
+					ids.push_back(table.issue((MethodId)t));
+				}
+
+				for(int id: ids)
+				{
+					optional<RequestTable::Entry> entry = table.erase(Number(id));
+
+					CHECK(entry.has_value());
+					CHECK(entry->method == (MethodId)t);
+				}
+
+				ids.clear();
+			}
+		});
+	}
+
+	for(thread& t: threads)
+	{
+		t.join();
+	}
+}
+
+int main()
+{
+	testProbing();
+	testIssuedFallback();
+	testOtherIds();
+	testConcurrentIssue();
+
+	return 0;
+}
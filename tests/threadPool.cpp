@@ -0,0 +1,177 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <libclsp/server/threadPool.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// The tasks that are left run before the pool is destroyed
+static void testSubmit()
+{
+	atomic<size_t> ran{0};
+
+	{
+		ThreadPool pool(4);
+
+		CHECK(pool.size() == 4);
+		CHECK(ThreadPool::current() == nullptr);
+
+		for(size_t i = 0; i < 1000; i++)
+		{
+			pool.submit([&ran, &pool]()
+			{
+				CHECK(ThreadPool::current() == &pool);
+				ran++;
+			}, i);
+		}
+	}
+
+	CHECK(ran == 1000);
+}
+
+/// The sum of a range, split in subtasks that wait for their halves
+static uint64_t sum(ThreadPool& pool, uint64_t begin, uint64_t end)
+{
+	if(end - begin <= 16)
+	{
+		uint64_t total = 0;
+
+		for(uint64_t i = begin; i < end; i++)
+		{
+			total += i;
+		}
+
+		return total;
+	}
+
+	uint64_t middle = begin + (end - begin) / 2;
+	uint64_t left   = 0;
+	uint64_t right  = 0;
+
+	TaskGroup group(pool);
+
+	group.fork([&pool, &left, begin, middle]()
+	{
+		left = sum(pool, begin, middle);
+	});
+
+	group.fork([&pool, &right, middle, end]()
+	{
+		right = sum(pool, middle, end);
+	});
+
+	group.wait();
+
+	return left + right;
+}
+
+/// Tasks that wait for their subtasks run them meanwhile, so even one
+/// worker doesn't deadlock
+static void testNestedWait()
+{
+	for(size_t workers: {1, 2, 8})
+	{
+		ThreadPool pool(workers);
+		TaskGroup group(pool);
+
+		uint64_t total = 0;
+
+		group.fork([&pool, &total]()
+		{
+			total = sum(pool, 0, 4096);
+		});
+
+		group.wait();
+
+		CHECK(total == (uint64_t)4096 * 4095 / 2);
+	}
+}
+
+/// wait() throws the exception of a task after the others finish
+static void testException()
+{
+	ThreadPool pool(4);
+	TaskGroup group(pool);
+
+	atomic<size_t> ran{0};
+
+	for(size_t i = 0; i < 100; i++)
+	{
+		group.fork([&ran, i]()
+		{
+			ran++;
+
+			if(i == 50)
+			{
+				throw runtime_error("task 50");
+			}
+		});
+	}
+
+	bool thrown = false;
+
+	try
+	{
+		group.wait();
+	}
+	catch(const runtime_error& error)
+	{
+		thrown = string(error.what()) == "task 50";
+	}
+
+	CHECK(thrown);
+	CHECK(ran == 100);
+}
+
+/// A task that was added runs in the group when it's called
+static void testAdd()
+{
+	ThreadPool pool(2);
+	TaskGroup group(pool);
+
+	atomic<bool> ran{false};
+
+	function<void()> task = group.add([&ran]()
+	{
+		ran = true;
+	});
+
+	CHECK(!ran);
+
+	pool.submit(move(task));
+
+	group.wait();
+
+	CHECK(ran);
+}
+
+int main()
+{
+	testSubmit();
+	testNestedWait();
+	testException();
+	testAdd();
+
+	return 0;
+}
@@ -0,0 +1,175 @@
+// A C++17 library for language servers.
+// Copyright © 2019-2020 otreblan
+//
+// libclsp is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// libclsp is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with libclsp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <libclsp/server/timerWheel.hpp>
+
+#include <check.hpp>
+
+using namespace std;
+using namespace clsp;
+
+/// The ticks are so long that the clock doesn't reach the second one while
+/// the test runs, the tests move the wheel with the times they pass to
+/// advance(). The delays of the whole wheel still fit in the clock.
+constexpr chrono::minutes tick(1);
+
+/// The ticks of the last level
+constexpr uint64_t wheelTicks = (uint64_t)1 << 24;
+
+/// A wheel that is advanced to fake times
+struct FakeWheel
+{
+	TimerWheel wheel;
+
+	/// Tick 0 of the wheel, a moment after its start
+	TimerWheel::Clock::time_point origin;
+
+	FakeWheel():
+		wheel(tick),
+		origin(TimerWheel::Clock::now())
+	{};
+
+	void advanceTo(uint64_t ticks)
+	{
+		wheel.advance(origin + ticks * tick);
+	}
+};
+
+/// A timer of a delay scheduled at a tick runs in the tick of its expiry,
+/// after falling through the levels
+static void checkExpiry(uint64_t at, uint64_t delay)
+{
+	FakeWheel fake;
+
+	// A timer that keeps the wheel live, so advance() walks every tick
+	fake.wheel.schedule(wheelTicks * tick, [](){});
+
+	fake.advanceTo(at);
+
+	size_t runs = 0;
+
+	fake.wheel.schedule(delay * tick, [&runs](){ runs++; });
+
+	fake.advanceTo(at + delay - 1);
+
+	CHECK(runs == 0);
+
+	fake.advanceTo(at + delay);
+
+	CHECK(runs == 1);
+}
+
+/// The delays around the length of every level, from ticks around the
+/// start of the slots of every level
+static void testCascadeBoundaries()
+{
+	vector<uint64_t> ticks = {0, 1, 62, 63, 64, 65, 100, 4095, 4096, 4097,
+		262143, 262144, 262145};
+
+	vector<uint64_t> delays = {1, 2, 63, 64, 65, 127, 128, 129, 4095, 4096,
+		4097, 4159, 262143, 262144, 262145, 266240};
+
+	for(uint64_t at: ticks)
+	{
+		for(uint64_t delay: delays)
+		{
+			checkExpiry(at, delay);
+		}
+	}
+
+	checkExpiry(0, wheelTicks - 1);
+	checkExpiry(12345, wheelTicks - 1);
+}
+
+/// A delay longer than the wheel is shortened to its last tick
+static void testLongDelay()
+{
+	FakeWheel fake;
+
+	fake.advanceTo(777);
+
+	bool ran = false;
+
+	fake.wheel.schedule(2 * wheelTicks * tick, [&ran](){ ran = true; });
+
+	fake.advanceTo(777 + wheelTicks - 2);
+
+	CHECK(!ran);
+
+	fake.advanceTo(777 + wheelTicks - 1);
+
+	CHECK(ran);
+	CHECK(fake.wheel.empty());
+}
+
+/// The timers of a tick run in the order they were scheduled, a cancelled
+/// one doesn't run, and a callback can schedule another timer
+static void testCancelAndReschedule()
+{
+	FakeWheel fake;
+
+	size_t armed = 0;
+
+	fake.wheel.armed = [&armed](){ armed++; };
+
+	string order;
+
+	fake.wheel.schedule(100 * tick, [&order](){ order += 'a'; });
+
+	auto cancelled = fake.wheel.schedule(100 * tick, [&order](){ order += 'x'; });
+
+	fake.wheel.schedule(100 * tick, [&order, &fake]()
+	{
+		order += 'b';
+
+		fake.wheel.schedule(tick, [&order](){ order += 'c'; });
+	});
+
+	CHECK(armed == 1);
+	CHECK(fake.wheel.cancel(cancelled));
+	CHECK(!fake.wheel.cancel(cancelled));
+
+	fake.advanceTo(100);
+
+	// The timer of the callback was the only live one, so it armed
+	CHECK(order == "ab");
+	CHECK(armed == 2);
+	CHECK(!fake.wheel.empty());
+
+	fake.advanceTo(101);
+
+	CHECK(order == "abc");
+	CHECK(fake.wheel.empty());
+
+	// An empty wheel arms again
+	fake.wheel.schedule(tick, [](){});
+
+	CHECK(armed == 3);
+}
+
+int main()
+{
+	testCascadeBoundaries();
+	testLongDelay();
+	testCancelAndReschedule();
+
+	return 0;
+}